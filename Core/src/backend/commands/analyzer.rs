@@ -3,10 +3,9 @@ use tauri::State;
 
 #[tauri::command]
 pub async fn analyze_fname(state: State<'_, AppState>, id: u32) -> Result<String, String> {
-    let process = state.process.lock().unwrap().clone().ok_or("No process attached")?;
+    let process = state.process.load_full().ok_or("No process attached")?;
 
-    let name_pool_guard = state.name_pool.lock().unwrap();
-    let name_pool = name_pool_guard.as_ref().ok_or("FNamePool not yet parsed. Please parse GUObjectArray first.")?;
+    let name_pool = state.name_pool.load_full().ok_or("FNamePool not yet parsed. Please parse GUObjectArray first.")?;
 
     name_pool.get_name(&process, id).map_err(|e| format!("Failed to read FName {}: {}", id, e))
 }
@@ -39,17 +38,9 @@ pub struct RawObjectInfo {
 pub async fn analyze_object(state: State<'_, AppState>, address_str: String) -> Result<RawObjectInfo, String> {
     let addr = usize::from_str_radix(address_str.trim_start_matches("0x"), 16).map_err(|_| "Invalid hex address format")?;
 
-    let process = state.process.lock().unwrap().clone().ok_or("No process attached")?;
-    let pool_guard = state.name_pool.lock().map_err(|_| "Lock failed")?;
-    let name_pool = pool_guard.as_ref().ok_or("Name pool not initialized")?;
-    let offsets = {
-        let ac_lock = state.auto_config.lock().unwrap();
-        if let Some(ac) = ac_lock.as_ref() {
-            ac.offsets.clone()
-        } else {
-            crate::backend::unreal::offsets::UEOffset::default()
-        }
-    };
+    let process = state.process.load_full().ok_or("No process attached")?;
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not initialized")?;
+    let offsets = state.offsets();
 
     // Helper to format pointers elegantly
     let ptr_fmt = |val: usize| {
@@ -61,16 +52,16 @@ pub async fn analyze_object(state: State<'_, AppState>, address_str: String) ->
     };
 
     // --- Check both caches ---
-    let obj_mgr = &state.object_manager;
-    let in_cache_by_address = obj_mgr.cache_by_address.contains_key(&addr);
+    let obj_mgr = &state.objects();
+    let in_cache_by_address = obj_mgr.contains(addr);
 
     // Read ID early so we can check cache_by_id
     let id = process.memory.try_read::<i32>(addr.wrapping_add(offsets.id)).unwrap_or(0);
-    let in_cache_by_id = obj_mgr.cache_by_id.contains_key(&id);
+    let in_cache_by_id = obj_mgr.contains_id(id);
 
     // If not in address cache, attempt try_save_object to parse and cache it
     if !in_cache_by_address {
-        obj_mgr.try_save_object(addr, &process, name_pool, &offsets, 0, 5, false);
+        obj_mgr.try_save_object(addr, &process, &name_pool, &offsets, 0, 5);
     }
 
     let class_ptr = process.memory.try_read_pointer(addr.wrapping_add(offsets.class)).unwrap_or(0);
@@ -93,9 +84,9 @@ pub async fn analyze_object(state: State<'_, AppState>, address_str: String) ->
     let mut depth = 0;
     while current_outer > 0x10000 && depth < 10 {
         let out_name_id = process.memory.try_read::<i32>(current_outer.wrapping_add(offsets.fname_index)).unwrap_or(0);
-        if let Ok(n) = name_pool.get_name(&process, out_name_id as u32) {
+        if let Ok(n) = name_pool.name(&process, out_name_id as u32) {
             if !n.is_empty() && n != "None" {
-                path.push(n);
+                path.push(n.to_string());
             }
         }
         current_outer = process.memory.try_read_pointer(current_outer.wrapping_add(offsets.outer)).unwrap_or(0);
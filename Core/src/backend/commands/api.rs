@@ -1,13 +1,20 @@
+use crate::backend::commands::instance::PropertyWrite;
 use crate::backend::state::AppState;
 use axum::{
+    extract::ws::{Message, WebSocket, WebSocketUpgrade},
     extract::State as AxumState,
+    http::header,
+    response::{IntoResponse, Response},
     routing::{get, post},
     Json, Router,
 };
 use serde::{Deserialize, Serialize};
 use serde_json::{json, Value};
-use std::collections::HashMap;
-use tauri::{AppHandle, Manager};
+use std::collections::{BTreeMap, HashMap};
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::sync::{Arc, Mutex};
+use tauri::{AppHandle, Emitter, Manager};
+use tokio::sync::broadcast;
 use tower_http::cors::{Any, CorsLayer};
 
 #[derive(Clone)]
@@ -28,65 +35,35 @@ pub struct WriteResponse {
     pub error: Option<String>,
 }
 
+#[derive(Deserialize)]
+pub struct BatchWriteRequest {
+    pub writes: Vec<WriteRequest>,
+}
+
+#[derive(Serialize)]
+pub struct BatchWriteResponse {
+    pub results: Vec<WriteResponse>,
+}
+
 #[tauri::command]
 pub async fn sync_api_config(app: tauri::AppHandle, config: Value) -> Result<(), String> {
     let state = app.state::<AppState>();
-    if let Ok(mut lock) = state.api_config.lock() {
-        *lock = Some(config);
+    // Compile once here so polls don't re-walk the config
+    let plan = ReadPlan::compile(&config);
+    // An unchanged plan keeps its Arc, so the sampler goes on diffing instead of pushing a full frame
+    if state.api_plan.load().as_deref() != Some(&plan) {
+        state.api_plan.store(Some(Arc::new(plan)));
     }
+    state.api_config.store(Some(Arc::new(config)));
     Ok(())
 }
 
 #[tauri::command]
 pub async fn fetch_api_live_values(app: tauri::AppHandle) -> Result<HashMap<String, String>, String> {
     let state = app.state::<AppState>();
-
-    let config_val = {
-        let lock = match state.api_config.lock() {
-            Ok(l) => l,
-            Err(_) => return Err("Failed to lock config".into()),
-        };
-        match lock.as_ref() {
-            Some(c) => c.clone(),
-            None => return Err("No API config synced".into()),
-        }
-    };
-
-    let mut values_map = HashMap::new();
-
-    let proc_guard = match state.process.lock() {
-        Ok(l) => l,
-        Err(_) => return Err("Process lock failed".into()),
-    };
-    let proc = match proc_guard.as_ref() {
-        Some(p) => p,
-        None => return Err("Process not attached".into()),
-    };
-
-    if let Some(groups) = config_val.as_object() {
-        for (_id, group) in groups {
-            if let Some(data_array) = group.get("data").and_then(|v| v.as_array()) {
-                for class_data in data_array {
-                    if let Some(params) = class_data.get("parameters").and_then(|v| v.as_array()) {
-                        for param in params {
-                            let prop_type = param.get("property_type").and_then(|v| v.as_str()).unwrap_or("");
-                            let memory_address_str = param.get("memory_address").and_then(|v| v.as_str()).unwrap_or("0");
-
-                            let addr_result = usize::from_str_radix(memory_address_str.trim_start_matches("0x"), 16);
-                            if let Ok(addr) = addr_result {
-                                if addr > 0x10000 && !prop_type.to_lowercase().contains("structproperty") && !prop_type.to_lowercase().contains("scriptstruct") {
-                                    let val_str = read_primitive_value(&proc, addr, prop_type);
-                                    values_map.insert(memory_address_str.to_string(), val_str);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    Ok(values_map)
+    let plan = current_plan(&state)?;
+    let sample = plan.sample(&state)?;
+    Ok(plan.live_values(&sample))
 }
 
 #[tauri::command]
@@ -94,7 +71,7 @@ pub async fn start_api_server(app: tauri::AppHandle, port: u16) -> Result<(), St
     let state = ApiServerState { app_handle: app.clone() };
 
     let cors = CorsLayer::new().allow_origin(Any).allow_methods(Any).allow_headers(Any);
-    let app_router = Router::new().route("/api/data", get(data_handler)).route("/api/write", post(write_handler)).layer(cors).with_state(state);
+    let app_router = Router::new().route("/api/data", get(data_handler)).route("/api/stream", get(stream_handler)).route("/api/write", post(write_handler)).route("/api/write/batch", post(write_batch_handler)).route("/api/metrics", get(metrics_handler)).layer(cors).with_state(state);
 
     let addr = format!("0.0.0.0:{}", port);
     let listener = match tokio::net::TcpListener::bind(&addr).await {
@@ -103,6 +80,7 @@ pub async fn start_api_server(app: tauri::AppHandle, port: u16) -> Result<(), St
     };
 
     println!("[API] Server listening on {}", addr);
+    LiveStream::ensure_sampler(app.clone());
 
     tauri::async_runtime::spawn(async move {
         if let Err(e) = axum::serve(listener, app_router).await {
@@ -113,187 +91,551 @@ pub async fn start_api_server(app: tauri::AppHandle, port: u16) -> Result<(), St
     Ok(())
 }
 
-fn insert_value_at_path(map: &mut serde_json::Map<String, Value>, path: &str, value: Value) {
+// ═══════════════════════════════════════════════════════════════
+//  ReadPlan — the synced API config compiled for polling
+//  Parameters are typed once, sorted by address and coalesced into a few ranges;
+//  the /api/data response is a prebuilt skeleton with one slot per parameter.
+// ═══════════════════════════════════════════════════════════════
+
+/// Neighbouring parameters closer than this share one read
+const PLAN_MAX_GAP: usize = 0x100;
+const PLAN_MAX_RANGE: usize = 0x10000;
+
+#[derive(Clone, Copy, PartialEq)]
+enum ValueKind {
+    Bool,
+    I8,
+    I16,
+    I32,
+    F32,
+    F64,
+    Pointer,
+}
+
+impl ValueKind {
+    fn parse(property_type: &str) -> Self {
+        let t = property_type.to_lowercase();
+        if t.contains("bool") {
+            Self::Bool
+        } else if t.contains("int8") {
+            Self::I8
+        } else if t.contains("int16") {
+            Self::I16
+        } else if t.contains("int") || t.contains("uint32") {
+            Self::I32
+        } else if t.contains("float") {
+            Self::F32
+        } else if t.contains("double") {
+            Self::F64
+        } else {
+            // Unknown or object pointer etc
+            Self::Pointer
+        }
+    }
+
+    fn size(self) -> usize {
+        match self {
+            Self::Bool | Self::I8 => 1,
+            Self::I16 => 2,
+            Self::I32 | Self::F32 => 4,
+            Self::F64 | Self::Pointer => 8,
+        }
+    }
+
+    /// `raw` holds the little-endian value, zero-filled when the read failed
+    fn format(self, raw: [u8; 8]) -> String {
+        match self {
+            Self::Bool => (if raw[0] > 0 { "True" } else { "False" }).into(),
+            Self::I8 => (raw[0] as i8).to_string(),
+            Self::I16 => i16::from_le_bytes([raw[0], raw[1]]).to_string(),
+            Self::I32 => i32::from_le_bytes([raw[0], raw[1], raw[2], raw[3]]).to_string(),
+            Self::F32 => format!("{:.3}", f32::from_le_bytes([raw[0], raw[1], raw[2], raw[3]])),
+            Self::F64 => format!("{:.3}", f64::from_le_bytes(raw)),
+            Self::Pointer => format!("0x{:X}", u64::from_le_bytes(raw)),
+        }
+    }
+}
+
+/// How /api/data types a value (decided by the property type name, as before)
+#[derive(Clone, Copy, PartialEq)]
+enum JsonKind {
+    Number,
+    Bool,
+    Text,
+}
+
+#[derive(PartialEq)]
+struct PlannedParam {
+    address: usize,
+    kind: ValueKind,
+    json: JsonKind,
+    instance: String,
+    path: String,
+    /// The UI's memory_address string, the key of fetch_api_live_values
+    memory_address: String,
+    /// Struct parameters only appear in /api/data
+    is_struct: bool,
+}
+
+#[derive(PartialEq)]
+struct ReadRange {
+    start: usize,
+    len: usize,
+    /// params_by_address[first..last] lie in this range
+    first: usize,
+    last: usize,
+}
+
+#[derive(PartialEq)]
+enum Node {
+    Object(BTreeMap<String, Node>),
+    Literal(Value),
+    Slot(usize),
+}
+
+/// Where /api/write sends a value, as tracked by the UI
+#[derive(PartialEq)]
+struct WriteTarget {
+    memory_address: String,
+    property_type: String,
+}
+
+#[derive(PartialEq)]
+pub struct ReadPlan {
+    params: Vec<PlannedParam>,
+    /// (instanceName, full_path) -> first tracked parameter with that path and a resolved address
+    write_targets: HashMap<(String, String), WriteTarget>,
+    params_by_address: Vec<usize>,
+    ranges: Vec<ReadRange>,
+    skeleton: Node,
+}
+
+impl ReadPlan {
+    pub fn compile(config: &Value) -> Self {
+        let mut params = Vec::new();
+        let mut write_targets = HashMap::new();
+        let mut response = BTreeMap::new();
+
+        if let Some(groups) = config.as_object() {
+            for (_id, group) in groups {
+                let instance_name = group.get("instanceName").and_then(|v| v.as_str()).unwrap_or("Unknown");
+                let instance_addr_str = group.get("instanceAddress").and_then(|v| v.as_str()).unwrap_or("N/A");
+                let mut properties_tree = BTreeMap::new();
+
+                for class_data in group.get("data").and_then(|v| v.as_array()).into_iter().flatten() {
+                    for param in class_data.get("parameters").and_then(|v| v.as_array()).into_iter().flatten() {
+                        let prop_name = param.get("property_name").and_then(|v| v.as_str()).unwrap_or("");
+                        let full_path = param.get("full_path").and_then(|v| v.as_str()).unwrap_or(prop_name);
+                        let prop_type = param.get("property_type").and_then(|v| v.as_str()).unwrap_or("");
+                        let memory_address_str = param.get("memory_address").and_then(|v| v.as_str()).unwrap_or("0");
+
+                        // A match without an address doesn't claim the path; a later one with an address can still take it
+                        let write_address = param.get("memory_address").and_then(|v| v.as_str()).unwrap_or("");
+                        if !write_address.is_empty() && write_address != "0" && write_address != "0x0" {
+                            let write_key = (group.get("instanceName").and_then(|v| v.as_str()).unwrap_or("").to_string(), param.get("full_path").and_then(|v| v.as_str()).unwrap_or("").to_string());
+                            write_targets.entry(write_key).or_insert_with(|| WriteTarget { memory_address: write_address.to_string(), property_type: prop_type.to_string() });
+                        }
+
+                        let Ok(address) = usize::from_str_radix(memory_address_str.trim_start_matches("0x"), 16) else { continue };
+                        if address <= 0x10000 {
+                            insert_node_at_path(&mut properties_tree, full_path, Node::Literal(json!("Invalid Address")));
+                            continue;
+                        }
+
+                        let tlower = prop_type.to_lowercase();
+                        let json = if tlower.contains("int") || tlower.contains("float") || tlower.contains("double") {
+                            JsonKind::Number
+                        } else if tlower.contains("bool") {
+                            JsonKind::Bool
+                        } else {
+                            JsonKind::Text
+                        };
+                        let is_struct = tlower.contains("structproperty") || tlower.contains("scriptstruct");
+
+                        insert_node_at_path(&mut properties_tree, full_path, Node::Slot(params.len()));
+                        params.push(PlannedParam { address, kind: ValueKind::parse(prop_type), json, instance: instance_name.to_string(), path: full_path.to_string(), memory_address: memory_address_str.to_string(), is_struct });
+                    }
+                }
+
+                let mut instance_data = BTreeMap::new();
+                instance_data.insert("instanceAddress".to_string(), Node::Literal(json!(instance_addr_str)));
+                instance_data.insert("properties".to_string(), Node::Object(properties_tree));
+                response.insert(instance_name.to_string(), Node::Object(instance_data));
+            }
+        }
+
+        let mut params_by_address: Vec<usize> = (0..params.len()).collect();
+        params_by_address.sort_by_key(|&i| params[i].address);
+
+        let mut ranges: Vec<ReadRange> = Vec::new();
+        for (pos, &i) in params_by_address.iter().enumerate() {
+            let (start, end) = (params[i].address, params[i].address.saturating_add(params[i].kind.size()));
+            match ranges.last_mut() {
+                Some(r) if start <= (r.start + r.len).saturating_add(PLAN_MAX_GAP) && end - r.start <= PLAN_MAX_RANGE => {
+                    r.len = r.len.max(end - r.start);
+                    r.last = pos + 1;
+                }
+                _ => ranges.push(ReadRange { start, len: end - start, first: pos, last: pos + 1 }),
+            }
+        }
+
+        Self { params, write_targets, params_by_address, ranges, skeleton: Node::Object(response) }
+    }
+
+    /// Raw bytes of every parameter: one read per range
+    fn sample(&self, state: &AppState) -> Result<Vec<[u8; 8]>, String> {
+        let mut raw = vec![[0u8; 8]; self.params.len()];
+        let proc = state.process.load_full().ok_or("Process not attached")?;
+
+        for range in &self.ranges {
+            let members = &self.params_by_address[range.first..range.last];
+            // The range is read into the thread's scratch buffer and copied out per parameter
+            let bulk = proc.memory.read_with(range.start, range.len, |data| {
+                if data.len() < range.len {
+                    return false;
+                }
+                for &i in members {
+                    let param = &self.params[i];
+                    let size = param.kind.size();
+                    raw[i][..size].copy_from_slice(&data[param.address - range.start..param.address - range.start + size]);
+                }
+                true
+            });
+            if bulk != Some(true) {
+                // The range spans an unreadable page: read each parameter on its own (zero on failure, as before)
+                for &i in members {
+                    let param = &self.params[i];
+                    let out = &mut raw[i][..param.kind.size()];
+                    if !proc.memory.read_into(param.address, out) {
+                        out.fill(0);
+                    }
+                }
+            }
+        }
+        Ok(raw)
+    }
+
+    fn live_values(&self, raw: &[[u8; 8]]) -> HashMap<String, String> {
+        self.params.iter().zip(raw).filter(|(p, _)| !p.is_struct).map(|(p, &r)| (p.memory_address.clone(), p.kind.format(r))).collect()
+    }
+
+    fn typed_value(&self, i: usize, val_str: &str) -> Value {
+        match self.params[i].json {
+            JsonKind::Number => val_str.parse::<f64>().map(|num| json!(num)).unwrap_or_else(|_| json!(val_str)),
+            JsonKind::Bool => json!(val_str.to_lowercase() == "true"),
+            JsonKind::Text => json!(val_str),
+        }
+    }
+
+    fn change(&self, i: usize, raw: [u8; 8]) -> LiveChange {
+        let param = &self.params[i];
+        let text = param.kind.format(raw);
+        LiveChange { instance: param.instance.clone(), path: param.path.clone(), memory_address: param.memory_address.clone(), value: self.typed_value(i, &text), text }
+    }
+
+    /// /api/data body, serialized in one pass over the skeleton
+    fn render(&self, raw: &[[u8; 8]]) -> String {
+        let mut out = String::with_capacity(64 + self.params.len() * 32);
+        self.render_node(&self.skeleton, raw, &mut out);
+        out
+    }
+
+    fn render_node(&self, node: &Node, raw: &[[u8; 8]], out: &mut String) {
+        match node {
+            Node::Object(map) => {
+                out.push('{');
+                for (k, (key, child)) in map.iter().enumerate() {
+                    if k > 0 {
+                        out.push(',');
+                    }
+                    out.push_str(&Value::from(key.as_str()).to_string());
+                    out.push(':');
+                    self.render_node(child, raw, out);
+                }
+                out.push('}');
+            }
+            Node::Literal(value) => out.push_str(&value.to_string()),
+            Node::Slot(i) => {
+                let val_str = self.params[*i].kind.format(raw[*i]);
+                out.push_str(&self.typed_value(*i, &val_str).to_string());
+            }
+        }
+    }
+}
+
+fn insert_node_at_path(map: &mut BTreeMap<String, Node>, path: &str, value: Node) {
     let parts: Vec<&str> = path.split('.').collect();
     let mut current = map;
     for (i, part) in parts.iter().enumerate() {
         if i == parts.len() - 1 {
-            current.insert(part.to_string(), value.clone());
+            current.insert(part.to_string(), value);
             break;
         }
 
         // If the current entry exists but isn't an object (e.g. it was tracked as a struct string itself),
         // we need to overwrite it with an object to allow nesting.
-        let entry = current.entry(part.to_string()).or_insert_with(|| json!({}));
-        if !entry.is_object() {
-            *entry = json!({});
+        let entry = current.entry(part.to_string()).or_insert_with(|| Node::Object(BTreeMap::new()));
+        if !matches!(entry, Node::Object(_)) {
+            *entry = Node::Object(BTreeMap::new());
         }
 
-        current = entry.as_object_mut().unwrap();
+        let Node::Object(next) = entry else { unreachable!() };
+        current = next;
     }
 }
 
-fn read_primitive_value(proc: &crate::backend::os::process::Process, address: usize, property_type: &str) -> String {
-    let t = property_type.to_lowercase();
-    if t.contains("bool") {
-        let val = proc.memory.try_read::<u8>(address).unwrap_or(0);
-        if val > 0 {
-            "True".into()
-        } else {
-            "False".into()
-        }
-    } else if t.contains("int8") {
-        proc.memory.try_read::<i8>(address).unwrap_or(0).to_string()
-    } else if t.contains("int16") {
-        proc.memory.try_read::<i16>(address).unwrap_or(0).to_string()
-    } else if t.contains("int") || t.contains("uint32") {
-        proc.memory.try_read::<i32>(address).unwrap_or(0).to_string()
-    } else if t.contains("float") {
-        let val = proc.memory.try_read::<f32>(address).unwrap_or(0.0);
-        format!("{:.3}", val)
-    } else if t.contains("double") {
-        let val = proc.memory.try_read::<f64>(address).unwrap_or(0.0);
-        format!("{:.3}", val)
-    } else {
-        // Unknown or object pointer etc
-        let ptr = proc.memory.try_read_pointer(address).unwrap_or(0);
-        format!("0x{:X}", ptr)
-    }
+fn current_plan(state: &AppState) -> Result<Arc<ReadPlan>, String> {
+    state.api_plan.load_full().ok_or_else(|| "No API config synced".to_string())
 }
 
-async fn data_handler(AxumState(state): AxumState<ApiServerState>) -> Json<Value> {
+async fn data_handler(AxumState(state): AxumState<ApiServerState>) -> Response {
     let app_state = state.app_handle.state::<AppState>();
 
-    let config_val = {
-        let lock = match app_state.api_config.lock() {
-            Ok(l) => l,
-            Err(_) => return Json(json!({"error": "Failed to lock config"})),
-        };
-        match lock.as_ref() {
-            Some(c) => c.clone(),
-            None => return Json(json!({"error": "No API config synced"})),
-        }
-    };
+    let result = current_plan(&app_state).and_then(|plan| match app_state.live_stream.fresh_body(&plan) {
+        // The sampler read this plan within the last few ticks: no extra remote reads per client
+        Some(body) => Ok(body.as_str().to_string()),
+        None => Ok(plan.render(&plan.sample(&app_state)?)),
+    });
+    match result {
+        Ok(body) => ([(header::CONTENT_TYPE, "application/json")], body).into_response(),
+        Err(e) => Json(json!({ "error": e })).into_response(),
+    }
+}
 
-    let mut response_map = serde_json::Map::new();
+// ═══════════════════════════════════════════════════════════════
+//  LiveStream — one sampler for every live-value consumer
+//  Each tick reads the plan once, diffs the raw values against the previous tick and
+//  pushes only the changed parameters: to WebSocket clients on /api/stream and to the
+//  UI as the "api-live-values" event. A plan change (re-sync) pushes a full frame.
+// ═══════════════════════════════════════════════════════════════
+
+const DEFAULT_STREAM_INTERVAL_MS: u64 = 100;
+/// Ticks after which the sampler's snapshot is no longer served by /api/data
+const SNAPSHOT_MAX_AGE_TICKS: u32 = 4;
+/// ...and never older than this, however slow the stream interval is set
+const SNAPSHOT_MAX_AGE: std::time::Duration = std::time::Duration::from_millis(250);
+
+#[derive(Serialize, Clone)]
+pub struct LiveChange {
+    pub instance: String,
+    pub path: String,
+    pub memory_address: String,
+    /// Typed like /api/data
+    pub value: Value,
+    /// Formatted like fetch_api_live_values
+    pub text: String,
+}
 
-    let proc_guard = match app_state.process.lock() {
-        Ok(l) => l,
-        Err(_) => return Json(json!({"error": "Process lock failed"})),
-    };
-    let proc = match proc_guard.as_ref() {
-        Some(p) => p,
-        None => return Json(json!({"error": "Process not attached"})),
-    };
+#[derive(Serialize, Clone)]
+pub struct LiveFrame {
+    pub seq: u64,
+    pub full: bool,
+    pub changes: Vec<LiveChange>,
+}
 
-    if let Some(groups) = config_val.as_object() {
-        for (_id, group) in groups {
-            let instance_name = group.get("instanceName").and_then(|v| v.as_str()).unwrap_or("Unknown");
-            let instance_addr_str = group.get("instanceAddress").and_then(|v| v.as_str()).unwrap_or("N/A");
-
-            let mut instance_data = serde_json::Map::new();
-            instance_data.insert("instanceAddress".into(), json!(instance_addr_str));
-            let mut properties_tree = serde_json::Map::new();
-
-            if let Some(data_array) = group.get("data").and_then(|v| v.as_array()) {
-                for class_data in data_array {
-                    if let Some(params) = class_data.get("parameters").and_then(|v| v.as_array()) {
-                        for param in params {
-                            let prop_name = param.get("property_name").and_then(|v| v.as_str()).unwrap_or("");
-                            let full_path = param.get("full_path").and_then(|v| v.as_str()).unwrap_or(prop_name);
-                            let prop_type = param.get("property_type").and_then(|v| v.as_str()).unwrap_or("");
-                            let memory_address_str = param.get("memory_address").and_then(|v| v.as_str()).unwrap_or("0");
-
-                            let addr_result = usize::from_str_radix(memory_address_str.trim_start_matches("0x"), 16);
-                            if let Ok(addr) = addr_result {
-                                if addr > 0x10000 {
-                                    let val_str = read_primitive_value(&proc, addr, prop_type);
-                                    let mut actual_val: Value = json!(val_str);
-
-                                    let tlower = prop_type.to_lowercase();
-                                    if tlower.contains("int") || tlower.contains("float") || tlower.contains("double") {
-                                        if let Ok(num) = val_str.parse::<f64>() {
-                                            actual_val = json!(num);
-                                        }
-                                    } else if tlower.contains("bool") {
-                                        actual_val = json!(val_str.to_lowercase() == "true");
-                                    }
-
-                                    insert_value_at_path(&mut properties_tree, full_path, actual_val);
-                                } else {
-                                    insert_value_at_path(&mut properties_tree, full_path, json!("Invalid Address"));
-                                }
-                            }
-                        }
+struct LiveSnapshot {
+    seq: u64,
+    plan: Arc<ReadPlan>,
+    body: Arc<String>,
+    sampled_at: std::time::Instant,
+}
+
+pub struct LiveStream {
+    interval_ms: AtomicU64,
+    running: AtomicBool,
+    /// (seq, serialized LiveFrame), shared by all sockets
+    frames: broadcast::Sender<(u64, Arc<String>)>,
+    latest: Mutex<Option<LiveSnapshot>>,
+}
+
+impl LiveStream {
+    pub fn new() -> Self {
+        Self { interval_ms: AtomicU64::new(DEFAULT_STREAM_INTERVAL_MS), running: AtomicBool::new(false), frames: broadcast::channel(64).0, latest: Mutex::new(None) }
+    }
+
+    fn interval(&self) -> std::time::Duration {
+        std::time::Duration::from_millis(self.interval_ms.load(Ordering::Relaxed))
+    }
+
+    /// Latest /api/data body, if it was sampled from `plan` recently enough
+    fn fresh_body(&self, plan: &Arc<ReadPlan>) -> Option<Arc<String>> {
+        let latest = self.latest.lock().ok()?;
+        let snapshot = latest.as_ref()?;
+        (self.running.load(Ordering::Relaxed) && Arc::ptr_eq(&snapshot.plan, plan) && snapshot.sampled_at.elapsed() < (self.interval() * SNAPSHOT_MAX_AGE_TICKS).min(SNAPSHOT_MAX_AGE)).then(|| Arc::clone(&snapshot.body))
+    }
+
+    fn full_frame(&self) -> Option<(u64, String)> {
+        let latest = self.latest.lock().ok()?;
+        let snapshot = latest.as_ref()?;
+        Some((snapshot.seq, format!("{{\"seq\":{},\"full\":true,\"data\":{}}}", snapshot.seq, snapshot.body)))
+    }
+
+    /// Start the sampler thread once; later calls are no-ops
+    pub fn ensure_sampler(app: AppHandle) {
+        let state = app.state::<AppState>();
+        if state.live_stream.running.swap(true, Ordering::AcqRel) {
+            return;
+        }
+        std::thread::spawn(move || Self::run_sampler(app));
+    }
+
+    fn run_sampler(app: AppHandle) {
+        let mut previous: Option<(Arc<ReadPlan>, Vec<[u8; 8]>)> = None;
+        let mut seq = 0u64;
+
+        loop {
+            let state = app.state::<AppState>();
+            let stream = &state.live_stream;
+            std::thread::sleep(stream.interval());
+
+            let Ok(plan) = current_plan(&state) else {
+                previous = None;
+                continue;
+            };
+            let Ok(raw) = plan.sample(&state) else { continue };
+
+            let changed: Vec<usize> = match &previous {
+                Some((prev_plan, prev_raw)) if Arc::ptr_eq(prev_plan, &plan) => (0..raw.len()).filter(|&i| raw[i] != prev_raw[i]).collect(),
+                _ => (0..raw.len()).collect(),
+            };
+            let full = !matches!(&previous, Some((prev_plan, _)) if Arc::ptr_eq(prev_plan, &plan));
+
+            if changed.is_empty() && !full {
+                if let Ok(mut latest) = stream.latest.lock() {
+                    if let Some(snapshot) = latest.as_mut() {
+                        snapshot.sampled_at = std::time::Instant::now();
                     }
                 }
+                continue;
             }
 
-            instance_data.insert("properties".into(), json!(properties_tree));
-            response_map.insert(instance_name.to_string(), json!(instance_data));
+            seq += 1;
+            let frame = LiveFrame { seq, full, changes: changed.iter().map(|&i| plan.change(i, raw[i])).collect() };
+            if let Ok(mut latest) = stream.latest.lock() {
+                *latest = Some(LiveSnapshot { seq, plan: Arc::clone(&plan), body: Arc::new(plan.render(&raw)), sampled_at: std::time::Instant::now() });
+            }
+            if stream.frames.receiver_count() > 0 {
+                if let Ok(text) = serde_json::to_string(&frame) {
+                    let _ = stream.frames.send((seq, Arc::new(text)));
+                }
+            }
+            app.emit("api-live-values", &frame).ok();
+
+            previous = Some((plan, raw));
         }
     }
+}
 
-    Json(json!(response_map))
+#[tauri::command]
+pub async fn set_api_stream_interval(app: tauri::AppHandle, interval_ms: u64) -> Result<(), String> {
+    let state = app.state::<AppState>();
+    state.live_stream.interval_ms.store(interval_ms.clamp(10, 60_000), Ordering::Relaxed);
+    Ok(())
 }
 
-async fn write_handler(AxumState(state): AxumState<ApiServerState>, Json(payload): Json<WriteRequest>) -> Json<WriteResponse> {
+async fn stream_handler(ws: WebSocketUpgrade, AxumState(state): AxumState<ApiServerState>) -> Response {
     let app_state = state.app_handle.state::<AppState>();
+    let stream = Arc::clone(&app_state.live_stream);
+    ws.on_upgrade(move |socket| serve_stream(socket, stream))
+}
 
-    let config_val = {
-        let lock = match app_state.api_config.lock() {
-            Ok(l) => l,
-            Err(_) => return Json(WriteResponse { success: false, error: Some("Failed to lock config".into()) }),
-        };
-        match lock.as_ref() {
-            Some(c) => c.clone(),
-            None => return Json(WriteResponse { success: false, error: Some("No API config synced".into()) }),
+/// Full tree first, then deltas; a client that falls behind gets a fresh full frame
+async fn serve_stream(mut socket: WebSocket, stream: Arc<LiveStream>) {
+    let mut frames = stream.frames.subscribe();
+    let mut last_seq = 0;
+
+    if let Some((seq, full)) = stream.full_frame() {
+        if socket.send(Message::Text(full)).await.is_err() {
+            return;
         }
-    };
+        last_seq = seq;
+    }
 
-    let target_instance = payload.instance;
-    let target_path = payload.path;
-
-    let mut found_address = String::new();
-    let mut found_type = String::new();
-
-    if let Some(groups) = config_val.as_object() {
-        for (_id, group) in groups {
-            let instance_name = group.get("instanceName").and_then(|v| v.as_str()).unwrap_or("");
-            if instance_name == target_instance {
-                if let Some(data_array) = group.get("data").and_then(|v| v.as_array()) {
-                    for class_data in data_array {
-                        if let Some(params) = class_data.get("parameters").and_then(|v| v.as_array()) {
-                            for param in params {
-                                let fpath = param.get("full_path").and_then(|v| v.as_str()).unwrap_or("");
-                                if fpath == target_path {
-                                    found_address = param.get("memory_address").and_then(|v| v.as_str()).unwrap_or("").to_string();
-                                    found_type = param.get("property_type").and_then(|v| v.as_str()).unwrap_or("").to_string();
-                                    break;
-                                }
-                            }
-                        }
-                        if !found_address.is_empty() {
-                            break;
-                        }
-                    }
+    loop {
+        match frames.recv().await {
+            Ok((seq, text)) => {
+                if seq <= last_seq {
+                    continue;
+                }
+                if socket.send(Message::Text(text.as_str().to_string())).await.is_err() {
+                    break;
                 }
+                last_seq = seq;
             }
-            if !found_address.is_empty() {
-                break;
+            Err(broadcast::error::RecvError::Lagged(_)) => {
+                let Some((seq, full)) = stream.full_frame() else { continue };
+                if socket.send(Message::Text(full)).await.is_err() {
+                    break;
+                }
+                last_seq = seq;
             }
+            Err(broadcast::error::RecvError::Closed) => break,
         }
     }
+}
 
-    if found_address.is_empty() || found_address == "0" || found_address == "0x0" {
-        return Json(WriteResponse { success: false, error: Some("Parameter not tracked or invalid memory address".into()) });
-    }
+async fn write_handler(AxumState(state): AxumState<ApiServerState>, Json(payload): Json<WriteRequest>) -> Json<WriteResponse> {
+    let app_state = state.app_handle.state::<AppState>();
+    let result = apply_writes(&app_state, std::slice::from_ref(&payload)).pop();
+    Json(result.unwrap_or(WriteResponse { success: false, error: Some("No write performed".into()) }))
+}
+
+async fn write_batch_handler(AxumState(state): AxumState<ApiServerState>, Json(payload): Json<BatchWriteRequest>) -> Json<BatchWriteResponse> {
+    let app_state = state.app_handle.state::<AppState>();
+    Json(BatchWriteResponse { results: apply_writes(&app_state, &payload.writes) })
+}
+
+async fn metrics_handler(AxumState(state): AxumState<ApiServerState>) -> Json<crate::backend::commands::metrics::RuntimeMetrics> {
+    Json(crate::backend::commands::metrics::collect(&state.app_handle.state::<AppState>()))
+}
+
+/// Resolve paths through the plan's write index, encode every value, then hand the whole set to Memory::write_batch
+/// so protection changes (when needed at all) happen once per page
+fn apply_writes(state: &AppState, writes: &[WriteRequest]) -> Vec<WriteResponse> {
+    let fail = |e: String| WriteResponse { success: false, error: Some(e) };
+    let plan = match current_plan(state) {
+        Ok(plan) => plan,
+        Err(e) => return writes.iter().map(|_| fail(e.clone())).collect(),
+    };
 
-    // Since found_address is the absolute memory address already computed by the UI, we specify "0" offset for write_instance_property
-    let res = crate::backend::commands::instance::write_instance_property(app_state, found_address, "0".to_string(), found_type, payload.value).await;
+    let mut errors: Vec<Option<String>> = vec![None; writes.len()];
+    let mut resolved = Vec::new();
+    for (i, write) in writes.iter().enumerate() {
+        let target = plan.write_targets.get(&(write.instance.clone(), write.path.clone())).filter(|t| !t.memory_address.is_empty() && t.memory_address != "0" && t.memory_address != "0x0");
+        let Some(target) = target else {
+            errors[i] = Some("Parameter not tracked or invalid memory address".into());
+            continue;
+        };
+        // The tracked address is the absolute memory address already computed by the UI, so the offset is "0"
+        let parsed = usize::from_str_radix(target.memory_address.trim_start_matches("0x"), 16).map_err(|_| "Invalid address".to_string()).and_then(|addr| Ok((addr, PropertyWrite::parse("0", &target.property_type, &write.value)?)));
+        match parsed {
+            Ok((addr, value)) => resolved.push((i, addr, value)),
+            Err(e) => errors[i] = Some(e),
+        }
+    }
 
-    match res {
-        Ok(_) => Json(WriteResponse { success: true, error: None }),
-        Err(e) => Json(WriteResponse { success: false, error: Some(e) }),
+    if !resolved.is_empty() {
+        match state.process.load_full() {
+            Some(proc) => {
+                // Bit writes build on earlier writes to the same byte within this batch
+                let mut pending: HashMap<usize, u8> = HashMap::new();
+                let mut batch = Vec::with_capacity(resolved.len());
+                let mut owners = Vec::with_capacity(resolved.len());
+                for (i, addr, value) in resolved {
+                    let bytes = value.into_bytes(|| pending.get(&addr).copied().unwrap_or_else(|| proc.memory.read::<u8>(addr).unwrap_or(0)));
+                    for (k, b) in bytes.iter().enumerate() {
+                        pending.insert(addr + k, *b);
+                    }
+                    batch.push((addr, bytes));
+                    owners.push(i);
+                }
+                for (i, result) in owners.into_iter().zip(proc.memory.write_batch(&batch)) {
+                    errors[i] = result.err();
+                }
+            }
+            None => resolved.iter().for_each(|(i, _, _)| errors[*i] = Some("Process not attached".into())),
+        }
     }
+
+    errors.into_iter().map(|e| WriteResponse { success: e.is_none(), error: e }).collect()
 }
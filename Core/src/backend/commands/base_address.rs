@@ -1,14 +1,46 @@
-use crate::backend::state::AppState;
-use crate::backend::unreal::dumper::BaseAddressDumper;
+use crate::backend::os::process::Process;
+use crate::backend::os::scanner::{ScanBenchmark, Scanner};
+use crate::backend::state::{AppState, BaseAddresses};
+use crate::backend::unreal::build_cache::BuildCache;
+use crate::backend::unreal::dumper::{BaseAddressDumper, ResolvedBaseAddresses};
 use tauri::State;
 
+/// Resolve every base address with one module scan and cache whatever was found into state.
+/// The individual getters call this on a cache miss so the sequence FNamePool → GUObjectArray → GWorld scans once.
+fn resolve_and_cache(process: &Process, state: &AppState) -> ResolvedBaseAddresses {
+    let resolved = BaseAddressDumper::resolve_all(process);
+    let element_size = resolved.guobject_array.as_ref().ok().and_then(|&base| BaseAddressDumper::detect_element_size(process, base).ok());
+
+    // Merge into whatever is current, so a concurrent writer's fields are kept
+    state.base_addresses.rcu(|current| {
+        let mut ba = BaseAddresses::clone(current);
+        if let Ok(addr) = resolved.fname_pool {
+            ba.fname_pool = Some(addr);
+        }
+        if let (Ok(addr), Some(size)) = (&resolved.guobject_array, element_size) {
+            ba.guobject_array = Some(*addr);
+            ba.guobject_element_size = Some(size);
+        }
+        if let Ok(addr) = resolved.gworld {
+            ba.gworld = Some(addr);
+        }
+        ba
+    });
+    if let (Ok(_), Some(size)) = (&resolved.guobject_array, element_size) {
+        println!("  -> GUObjectArray ElementSize = 0x{:X}", size);
+    }
+    BuildCache::store_base_addresses(process, &state.base_addresses.load());
+    resolved
+}
+
 #[tauri::command]
 pub fn get_fname_pool_address(state: State<'_, AppState>) -> Result<usize, String> {
-    let process_state = state.process.lock().unwrap();
+    let process_state = state.process.load_full();
     if let Some(process) = process_state.as_ref() {
-        let addr = BaseAddressDumper::get_fname_pool(process)?;
-        state.base_addresses.lock().unwrap().fname_pool = Some(addr);
-        Ok(addr)
+        if let Some(addr) = state.base_addresses.load().fname_pool {
+            return Ok(addr);
+        }
+        resolve_and_cache(process, &state).fname_pool
     } else {
         Err("No process attached".to_string())
     }
@@ -16,12 +48,16 @@ pub fn get_fname_pool_address(state: State<'_, AppState>) -> Result<usize, Strin
 
 #[tauri::command]
 pub fn get_guobject_array_address(state: State<'_, AppState>) -> Result<usize, String> {
-    let process_state = state.process.lock().unwrap();
+    let process_state = state.process.load_full();
     if let Some(process) = process_state.as_ref() {
-        let (addr, element_size) = BaseAddressDumper::get_guobject_array_with_element_size(process)?;
-        let mut ba = state.base_addresses.lock().unwrap();
-        ba.guobject_array = Some(addr);
-        ba.guobject_element_size = Some(element_size);
+        if let Some(addr) = state.base_addresses.load().guobject_array {
+            return Ok(addr);
+        }
+        let addr = resolve_and_cache(process, &state).guobject_array?;
+        // The address resolved but the element size probe failed — surface that like the old single-target path did
+        if state.base_addresses.load().guobject_element_size.is_none() {
+            return Err(format!("GUObjectArray found at 0x{:X} but its element size could not be detected", addr));
+        }
         Ok(addr)
     } else {
         Err("No process attached".to_string())
@@ -30,11 +66,12 @@ pub fn get_guobject_array_address(state: State<'_, AppState>) -> Result<usize, S
 
 #[tauri::command]
 pub fn get_gworld_address(state: State<'_, AppState>) -> Result<usize, String> {
-    let process_state = state.process.lock().unwrap();
+    let process_state = state.process.load_full();
     if let Some(process) = process_state.as_ref() {
-        let addr = BaseAddressDumper::get_gworld(process)?;
-        state.base_addresses.lock().unwrap().gworld = Some(addr);
-        Ok(addr)
+        if let Some(addr) = state.base_addresses.load().gworld {
+            return Ok(addr);
+        }
+        resolve_and_cache(process, &state).gworld
     } else {
         Err("No process attached".to_string())
     }
@@ -42,28 +79,25 @@ pub fn get_gworld_address(state: State<'_, AppState>) -> Result<usize, String> {
 
 #[tauri::command]
 pub fn show_base_address(state: State<'_, AppState>) -> Result<String, String> {
-    let process_state = state.process.lock().unwrap();
+    let process_state = state.process.load_full();
     if let Some(process) = process_state.as_ref() {
         let mut result_chunks = Vec::new();
 
-        let fname_addr = BaseAddressDumper::get_fname_pool(process).map_err(|e| format!("Failed to get FNamePool: {}", e))?;
+        // One pass over the module for all three globals; results are cached into state as a side effect
+        let resolved = resolve_and_cache(process, &state);
+
+        let fname_addr = resolved.fname_pool.map_err(|e| format!("Failed to get FNamePool: {}", e))?;
         result_chunks.push(format!("[ FNamePool ] 0x{:X}", fname_addr));
 
-        let (guobj_addr, element_size) = BaseAddressDumper::get_guobject_array_with_element_size(process).map_err(|e| format!("Failed to get GUObjectArray: {}", e))?;
+        let guobj_addr = resolved.guobject_array.map_err(|e| format!("Failed to get GUObjectArray: {}", e))?;
+        if state.base_addresses.load().guobject_element_size.is_none() {
+            return Err(format!("Failed to get GUObjectArray: element size could not be detected at 0x{:X}", guobj_addr));
+        }
         result_chunks.push(format!("[ GUObject  ] 0x{:X}", guobj_addr));
 
-        let gworld_addr = BaseAddressDumper::get_gworld(process).map_err(|e| format!("Failed to get GWorld: {}\n", e))?;
+        let gworld_addr = resolved.gworld.map_err(|e| format!("Failed to get GWorld: {}\n", e))?;
         result_chunks.push(format!("[ GWorld    ] 0x{:X}", gworld_addr));
 
-        // Cache all resolved addresses into state
-        {
-            let mut ba = state.base_addresses.lock().unwrap();
-            ba.fname_pool = Some(fname_addr);
-            ba.guobject_array = Some(guobj_addr);
-            ba.guobject_element_size = Some(element_size);
-            ba.gworld = Some(gworld_addr);
-        }
-
         let combined_output = result_chunks.join("\n");
         println!("\n====== Base Addresses ======");
         println!("{}", combined_output);
@@ -77,7 +111,7 @@ pub fn show_base_address(state: State<'_, AppState>) -> Result<String, String> {
 
 #[tauri::command]
 pub fn get_ue_version(state: State<'_, AppState>) -> Result<String, String> {
-    let process_state = state.process.lock().unwrap();
+    let process_state = state.process.load_full();
     if let Some(process) = process_state.as_ref() {
         match process.get_ue_version() {
             Ok(version) => {
@@ -97,3 +131,27 @@ pub fn get_ue_version(state: State<'_, AppState>) -> Result<String, String> {
         Err("No process attached".to_string())
     }
 }
+
+/// Compare the vectorized AOB matcher against the legacy loop on the attached process's main module.
+/// Measured over the module's readable regions, the ones the scanner walks, so guard or unreadable pages don't fail it.
+#[tauri::command]
+pub fn benchmark_signature_scan(state: State<'_, AppState>, signature: String, iterations: usize) -> Result<ScanBenchmark, String> {
+    let process_state = state.process.load_full();
+    if let Some(process) = process_state.as_ref() {
+        let module_end = process.main_module_base.saturating_add(process.main_module_size);
+        let buffers: Vec<Vec<u8>> = Scanner::readable_regions(&process.memory, process.main_module_base, module_end).iter().filter_map(|r| process.memory.read_bytes(r.base, r.size).ok()).collect();
+        if buffers.is_empty() {
+            return Err("No readable region in the main module".to_string());
+        }
+        let result = Scanner::benchmark(&buffers, &signature, iterations)?;
+
+        println!("\n====== Signature Scan Benchmark ======");
+        println!("[ Engine ] {}  [ Module ] {} MB in {} regions  [ Matches ] {}", result.engine, result.buffer_size / (1024 * 1024), result.regions, result.matches);
+        println!("[ Naive ] {:.3} ms  [ Vectorized ] {:.3} ms  [ Speedup ] {:.1}x", result.naive_ms, result.vectorized_ms, result.speedup);
+        println!("======================================\n");
+
+        Ok(result)
+    } else {
+        Err("No process attached".to_string())
+    }
+}
@@ -0,0 +1,198 @@
+use crate::backend::commands::search::{global_search_rows, instance_handles};
+use crate::backend::os::process::Process;
+use crate::backend::os::profile::{StageProfile, StageTimer};
+use crate::backend::state::AppState;
+use crate::backend::unreal::autoconfig::AutoConfig;
+use crate::backend::unreal::dumper::BaseAddressDumper;
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::{GUObjectArray, ObjectManager};
+use crate::backend::unreal::offsets::UEOffset;
+use crate::backend::unreal::snapshot::Snapshot;
+use std::path::PathBuf;
+use std::sync::Arc;
+use std::time::Instant;
+use tauri::State;
+
+// ═══════════════════════════════════════════════════════════════
+//  Pipeline benchmark — every stage of a dump, timed and profiled
+//  The stages run against fresh pools and a fresh ObjectManager, so nothing
+//  already parsed into AppState is reused or disturbed. The target is a
+//  snapshot file (repeatable runs over the same bytes), a PID opened just
+//  for the run, or the attached process.
+// ═══════════════════════════════════════════════════════════════
+
+#[derive(Debug, Default, serde::Deserialize)]
+pub struct BenchRequest {
+    /// Replay a snapshot instead of reading a live process
+    pub snapshot_path: Option<String>,
+    /// Open this process for the run; the attached process is used otherwise
+    pub pid: Option<u32>,
+    /// What the search stages look for, and the class whose instances are collected (default "Actor")
+    pub query: Option<String>,
+    /// Also write the report here as JSON
+    pub output_path: Option<String>,
+}
+
+#[derive(Debug, serde::Serialize)]
+pub struct BenchReport {
+    pub version: String,
+    pub target: String,
+    pub threads: usize,
+    /// Built with `--features alloc-profile`; the allocation columns are empty otherwise
+    pub alloc_profile: bool,
+    pub total_ms: f64,
+    pub stages: Vec<StageProfile>,
+}
+
+/// Run scan → name pool → auto config → object array → search → packages and report what each stage cost.
+/// No progress events are emitted, so the live session's progress bars and counters are left alone.
+#[tauri::command]
+pub async fn run_pipeline_benchmark(state: State<'_, AppState>, request: BenchRequest) -> Result<BenchReport, String> {
+    let attached = state.process.load_full();
+    let known_bases = state.base_addresses.load_full();
+    let known_offsets = state.auto_config.load_full().map(|ac| ac.offsets.clone());
+    let output_path = request.output_path.clone();
+
+    let report = tauri::async_runtime::spawn_blocking(move || {
+        let start = Instant::now();
+        let query = request.query.clone().unwrap_or_else(|| "Actor".to_string());
+        let mut stages = Vec::new();
+
+        // ─── Target ───
+        let mut bases = (*known_bases).clone();
+        let mut offsets = known_offsets;
+        let (process, from_snapshot) = if let Some(path) = &request.snapshot_path {
+            let timer = StageTimer::start("open_snapshot");
+            let snapshot = Snapshot::open(&PathBuf::from(path));
+            let pages = snapshot.as_ref().map(|s| s.meta.page_count as u64).map_err(|e| e.clone());
+            stages.push(timer.finish(pages));
+            let snapshot = snapshot?;
+            let meta = &snapshot.meta;
+            bases.fname_pool = Some(meta.fname_pool);
+            bases.guobject_array = meta.guobject_array;
+            bases.guobject_element_size = meta.guobject_element_size;
+            bases.gworld = meta.gworld;
+            offsets = Some(meta.offsets.clone());
+            (Arc::new(Process { pid: 0, name: format!("{} (snapshot)", meta.process_name), exe_path: meta.exe_path.clone(), memory: snapshot.memory(), main_module_base: meta.main_module_base, main_module_size: meta.main_module_size }), true)
+        } else if let Some(pid) = request.pid {
+            let timer = StageTimer::start("open_process");
+            let opened = Process::open(pid, &format!("PID {}", pid));
+            stages.push(timer.finish(opened.as_ref().map(|_| 1).map_err(|e| e.clone())));
+            // Base addresses in state belong to the attached process, not this one
+            bases = Default::default();
+            offsets = None;
+            (Arc::new(opened?), false)
+        } else {
+            (attached.ok_or("No process attached, and neither a snapshot nor a PID was given")?, false)
+        };
+        let target = process.name.clone();
+
+        // ─── Base addresses ───
+        if from_snapshot {
+            // The main module is not part of a snapshot; its base addresses were recorded when it was taken
+            stages.push(StageTimer::skipped("scan_base_addresses", "snapshot carries its base addresses"));
+        } else {
+            let timer = StageTimer::start("scan_base_addresses");
+            let resolved = BaseAddressDumper::resolve_all(&process);
+            let mut found = 0;
+            if let Ok(addr) = resolved.fname_pool {
+                bases.fname_pool = Some(addr);
+                found += 1;
+            }
+            if let Ok(addr) = resolved.guobject_array {
+                bases.guobject_array = Some(addr);
+                bases.guobject_element_size = BaseAddressDumper::detect_element_size(&process, addr).ok();
+                found += 1;
+            }
+            if let Ok(addr) = resolved.gworld {
+                bases.gworld = Some(addr);
+                found += 1;
+            }
+            stages.push(timer.finish(if found > 0 { Ok(found) } else { Err("no base address resolved".to_string()) }));
+        }
+
+        // ─── FNamePool ───
+        let Some(fname_pool) = bases.fname_pool else {
+            stages.push(StageTimer::skipped("parse_pool", "FNamePool address unknown"));
+            return Ok(finish_report(target, start, stages));
+        };
+        let name_pool = FNamePool::new(fname_pool);
+        let timer = StageTimer::start("parse_pool");
+        let parsed = name_pool.parse_pool(&process, None);
+        let pool_ok = parsed.is_ok();
+        stages.push(timer.finish(parsed.map(|(_, names)| names as u64)));
+
+        let (Some(guobject), Some(element_size)) = (bases.guobject_array, bases.guobject_element_size) else {
+            stages.push(StageTimer::skipped("auto_config", "GUObjectArray address unknown"));
+            return Ok(finish_report(target, start, stages));
+        };
+        if !pool_ok {
+            stages.push(StageTimer::skipped("auto_config", "FNamePool did not parse"));
+            return Ok(finish_report(target, start, stages));
+        }
+
+        // ─── Offsets ───
+        let timer = StageTimer::start("auto_config");
+        let mut auto_config = AutoConfig::new();
+        let discovered = auto_config.scan_basic_offsets(&process, &name_pool, &ObjectManager::new(), guobject, element_size);
+        stages.push(timer.finish(discovered.map(|_| 1)));
+        // Offsets validated earlier (build cache, snapshot) keep the later stages comparable between runs
+        let offsets: UEOffset = offsets.unwrap_or(auto_config.offsets);
+
+        // ─── GUObjectArray ───
+        let obj_mgr = ObjectManager::new();
+        let timer = StageTimer::start("parse_array");
+        let parsed = GUObjectArray::new(guobject).parse_array(&process, &name_pool, &offsets, element_size, None, &obj_mgr, false);
+        stages.push(timer.finish(parsed.map(|count| count as u64)));
+        if obj_mgr.len() == 0 {
+            stages.push(StageTimer::skipped("search_index", "no objects parsed"));
+            return Ok(finish_report(target, start, stages));
+        }
+
+        // ─── Search ───
+        let timer = StageTimer::start("search_index");
+        obj_mgr.search_index(&name_pool, &process, &offsets);
+        stages.push(timer.finish(Ok(obj_mgr.len() as u64)));
+
+        for (stage, mode) in [("global_search_object", "Object"), ("global_search_member", "Member")] {
+            let timer = StageTimer::start(stage);
+            let rows = global_search_rows(&obj_mgr, &name_pool, &process, &offsets, &query, mode);
+            stages.push(timer.finish(Ok(rows.len() as u64)));
+        }
+
+        let timer = StageTimer::start("search_object_instances");
+        let class = obj_mgr.iter(&name_pool).find(|obj| obj.type_name() == "Class" && obj.name() == query).map(|obj| obj.address());
+        stages.push(timer.finish(match class {
+            Some(address) => Ok(instance_handles(&obj_mgr, &name_pool, address).len() as u64),
+            None => Err(format!("no Class named {}", query)),
+        }));
+
+        // ─── Packages ───
+        let timer = StageTimer::start("package_index");
+        let packages = obj_mgr.package_index(&name_pool).packages().count();
+        stages.push(timer.finish(Ok(packages as u64)));
+
+        Ok::<_, String>(finish_report(target, start, stages))
+    })
+    .await
+    .map_err(|e| e.to_string())??;
+
+    println!("\n====== Pipeline Benchmark ======");
+    println!("[ Target ] {}  [ Threads ] {}  [ Total ] {:.1} ms", report.target, report.threads, report.total_ms);
+    for stage in &report.stages {
+        let status = if stage.ok { "ok" } else { stage.note.as_deref().unwrap_or("failed") };
+        println!("[ {} ] {:.1} ms  items {}  reads {} ({} KB)  queries {}  [{}]", stage.name, stage.wall_ms, stage.items, stage.io.read_calls, stage.io.read_bytes / 1024, stage.io.query_calls, status);
+    }
+    println!("================================\n");
+
+    if let Some(path) = output_path {
+        let json = serde_json::to_string_pretty(&report).map_err(|e| e.to_string())?;
+        std::fs::write(&path, json).map_err(|e| format!("Failed to write {}: {}", path, e))?;
+        println!("[ Benchmark ] Report written to {}", path);
+    }
+    Ok(report)
+}
+
+fn finish_report(target: String, start: Instant, stages: Vec<StageProfile>) -> BenchReport {
+    BenchReport { version: env!("CARGO_PKG_VERSION").to_string(), target, threads: rayon::current_num_threads(), alloc_profile: cfg!(feature = "alloc-profile"), total_ms: start.elapsed().as_secs_f64() * 1000.0, stages }
+}
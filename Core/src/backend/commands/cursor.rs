@@ -0,0 +1,385 @@
+use crate::backend::commands::instance::{read_array_elements, InstancePropertyInfo};
+use crate::backend::commands::package::ObjectSummary;
+use crate::backend::commands::search::{global_search_rows, instance_handles, GlobalSearchResult, InstanceSearchResult};
+use crate::backend::os::process::Process;
+use crate::backend::state::AppState;
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::{ObjectHandle, ObjectManager, ObjectView};
+use crate::backend::unreal::offsets::UEOffset;
+use crate::backend::unreal::package_index::category_slot;
+use std::collections::VecDeque;
+use std::ops::Range;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Arc, Mutex};
+use tauri::State;
+
+// ═══════════════════════════════════════════════════════════════
+//  Result cursors — large results fetched a page at a time
+//  open_cursor runs the query once and keeps the result server-side under an id;
+//  the UI then asks for row ranges, as JSON (fetch_cursor_page) or packed into an
+//  ArrayBuffer (fetch_cursor_packed). Object lists hold handles, and array cursors
+//  hold only the array address, so rows become strings only when a page is asked for.
+//
+//  A page holds up to `limit` rows starting at `offset`; rows that vanished since the
+//  cursor was opened (evicted objects) are skipped and made up from further on, so the
+//  page says where the next one starts (`next`; the cursor is done once it reaches `total`).
+//
+//  Packed page layout (little-endian): u32 row count, u64 next offset, then per row each
+//  column in `columns` order — u64: 8 bytes, i32: 4, bool: 1, str: u32 byte length + UTF-8.
+// ═══════════════════════════════════════════════════════════════
+
+/// Oldest cursors are dropped past this many; a closed or dropped id just reads as expired
+const MAX_OPEN_CURSORS: usize = 32;
+/// Array cursors are not bounded by get_array_elements' 9999, but a garbage count must not be trusted either
+const MAX_ARRAY_CURSOR_ROWS: usize = 1 << 20;
+
+#[derive(Clone, Copy, serde::Serialize)]
+pub struct Column {
+    pub name: &'static str,
+    /// "u64" | "i32" | "bool" | "str"
+    pub kind: &'static str,
+}
+
+const fn column(name: &'static str, kind: &'static str) -> Column {
+    Column { name, kind }
+}
+
+/// Builds one packed page
+#[derive(Default)]
+pub struct PackedWriter {
+    out: Vec<u8>,
+}
+
+impl PackedWriter {
+    pub fn u64(&mut self, v: u64) {
+        self.out.extend_from_slice(&v.to_le_bytes());
+    }
+    pub fn i32(&mut self, v: i32) {
+        self.out.extend_from_slice(&v.to_le_bytes());
+    }
+    pub fn bool(&mut self, v: bool) {
+        self.out.push(v as u8);
+    }
+    pub fn str(&mut self, v: &str) {
+        self.out.extend_from_slice(&(v.len() as u32).to_le_bytes());
+        self.out.extend_from_slice(v.as_bytes());
+    }
+}
+
+/// A row type a cursor can return; COLUMNS lists what `pack` writes, in order
+pub trait CursorRow: serde::Serialize {
+    const COLUMNS: &'static [Column];
+    fn pack(&self, out: &mut PackedWriter);
+}
+
+impl CursorRow for ObjectSummary {
+    const COLUMNS: &'static [Column] = &[column("address", "u64"), column("name", "str"), column("full_name", "str"), column("type_name", "str")];
+    fn pack(&self, out: &mut PackedWriter) {
+        out.u64(self.address as u64);
+        out.str(&self.name);
+        out.str(&self.full_name);
+        out.str(&self.type_name);
+    }
+}
+
+impl CursorRow for InstanceSearchResult {
+    const COLUMNS: &'static [Column] = &[column("instance_address", "str"), column("object_name", "str")];
+    fn pack(&self, out: &mut PackedWriter) {
+        out.str(&self.instance_address);
+        out.str(&self.object_name);
+    }
+}
+
+impl CursorRow for GlobalSearchResult {
+    // member_name travels as "" when absent
+    const COLUMNS: &'static [Column] = &[column("package_name", "str"), column("object_name", "str"), column("type_name", "str"), column("address", "u64"), column("member_name", "str")];
+    fn pack(&self, out: &mut PackedWriter) {
+        out.str(&self.package_name);
+        out.str(&self.object_name);
+        out.str(&self.type_name);
+        out.u64(self.address as u64);
+        out.str(self.member_name.as_deref().unwrap_or(""));
+    }
+}
+
+impl CursorRow for InstancePropertyInfo {
+    const COLUMNS: &'static [Column] = &[
+        column("property_name", "str"),
+        column("property_type", "str"),
+        column("offset", "str"),
+        column("sub_type", "str"),
+        column("memory_address", "str"),
+        column("live_value", "str"),
+        column("is_object", "bool"),
+        column("object_instance_address", "str"),
+        column("object_class_address", "str"),
+        column("object_class_id", "str"),
+    ];
+    fn pack(&self, out: &mut PackedWriter) {
+        for s in [&self.property_name, &self.property_type, &self.offset, &self.sub_type, &self.memory_address, &self.live_value] {
+            out.str(s);
+        }
+        out.bool(self.is_object);
+        for s in [&self.object_instance_address, &self.object_class_address, &self.object_class_id] {
+            out.str(s);
+        }
+    }
+}
+
+/// A result held behind a cursor; `rows` materializes one range of it
+/// `range` is the requested page; the returned offset is where the page actually ended (past `range.end` when rows were skipped)
+trait ResultSet: Send + Sync {
+    fn len(&self) -> usize;
+    fn columns(&self) -> &'static [Column];
+    fn json(&self, range: Range<usize>) -> Result<(serde_json::Value, usize), String>;
+    fn packed(&self, range: Range<usize>) -> Vec<u8>;
+}
+
+fn to_json<T: CursorRow>(rows: &[T]) -> Result<serde_json::Value, String> {
+    serde_json::to_value(rows).map_err(|e| e.to_string())
+}
+
+fn to_packed<T: CursorRow>(rows: &[T], next: usize) -> Vec<u8> {
+    let mut out = PackedWriter::default();
+    out.out.extend_from_slice(&(rows.len() as u32).to_le_bytes());
+    out.u64(next as u64);
+    for row in rows {
+        row.pack(&mut out);
+    }
+    out.out
+}
+
+/// Rows computed up front (search results, already capped)
+struct Materialized<T>(Vec<T>);
+
+impl<T: CursorRow + Send + Sync> ResultSet for Materialized<T> {
+    fn len(&self) -> usize {
+        self.0.len()
+    }
+    fn columns(&self) -> &'static [Column] {
+        T::COLUMNS
+    }
+    fn json(&self, range: Range<usize>) -> Result<(serde_json::Value, usize), String> {
+        Ok((to_json(&self.0[range.clone()])?, range.end))
+    }
+    fn packed(&self, range: Range<usize>) -> Vec<u8> {
+        to_packed(&self.0[range.clone()], range.end)
+    }
+}
+
+/// Object handles, turned into rows per page
+struct HandleRows<T> {
+    handles: Vec<ObjectHandle>,
+    objects: Arc<ObjectManager>,
+    names: Arc<FNamePool>,
+    row: fn(&ObjectView<'_>) -> T,
+}
+
+impl<T: CursorRow> HandleRows<T> {
+    /// Up to `range.len()` rows from `range.start` on, and the offset after the last handle consumed. A handle evicted by a
+    /// resync since the cursor was opened drops out, and the page is backfilled from the handles after it.
+    fn rows(&self, range: Range<usize>) -> (Vec<T>, usize) {
+        let mut rows = Vec::with_capacity(range.len());
+        let mut next = range.start;
+        while rows.len() < range.len() && next < self.handles.len() {
+            if let Some(obj) = self.objects.view(self.handles[next], &self.names) {
+                rows.push((self.row)(&obj));
+            }
+            next += 1;
+        }
+        (rows, next)
+    }
+}
+
+impl<T: CursorRow> ResultSet for HandleRows<T> {
+    fn len(&self) -> usize {
+        self.handles.len()
+    }
+    fn columns(&self) -> &'static [Column] {
+        T::COLUMNS
+    }
+    fn json(&self, range: Range<usize>) -> Result<(serde_json::Value, usize), String> {
+        let (rows, next) = self.rows(range);
+        Ok((to_json(&rows)?, next))
+    }
+    fn packed(&self, range: Range<usize>) -> Vec<u8> {
+        let (rows, next) = self.rows(range);
+        to_packed(&rows, next)
+    }
+}
+
+/// TArray elements, read from the process per page
+struct ArrayRows {
+    process: Arc<Process>,
+    objects: Arc<ObjectManager>,
+    names: Arc<FNamePool>,
+    offsets: UEOffset,
+    array_address: usize,
+    inner_type: String,
+    count: usize,
+}
+
+impl ArrayRows {
+    fn rows(&self, range: Range<usize>) -> Vec<InstancePropertyInfo> {
+        read_array_elements(&self.process, &self.objects, &self.names, &self.offsets, self.array_address, &self.inner_type, range, self.count)
+    }
+}
+
+impl ResultSet for ArrayRows {
+    fn len(&self) -> usize {
+        self.count
+    }
+    fn columns(&self) -> &'static [Column] {
+        InstancePropertyInfo::COLUMNS
+    }
+    fn json(&self, range: Range<usize>) -> Result<(serde_json::Value, usize), String> {
+        Ok((to_json(&self.rows(range.clone()))?, range.end))
+    }
+    fn packed(&self, range: Range<usize>) -> Vec<u8> {
+        to_packed(&self.rows(range.clone()), range.end)
+    }
+}
+
+/// Open cursors, newest last
+pub struct ResultCursors {
+    next_id: AtomicU64,
+    open: Mutex<VecDeque<(u64, Arc<dyn ResultSet>)>>,
+}
+
+impl Default for ResultCursors {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl ResultCursors {
+    pub fn new() -> Self {
+        Self { next_id: AtomicU64::new(1), open: Mutex::new(VecDeque::new()) }
+    }
+
+    fn insert(&self, set: Arc<dyn ResultSet>) -> u64 {
+        let id = self.next_id.fetch_add(1, Ordering::Relaxed);
+        let mut open = self.open.lock().unwrap();
+        if open.len() >= MAX_OPEN_CURSORS {
+            open.pop_front();
+        }
+        open.push_back((id, set));
+        id
+    }
+
+    fn get(&self, id: u64) -> Result<Arc<dyn ResultSet>, String> {
+        self.open.lock().unwrap().iter().find(|(open_id, _)| *open_id == id).map(|(_, set)| Arc::clone(set)).ok_or_else(|| format!("Cursor {} has expired", id))
+    }
+
+    fn close(&self, id: u64) {
+        self.open.lock().unwrap().retain(|(open_id, _)| *open_id != id);
+    }
+
+    /// Results of a previous process or parse must not be paged after a re-attach
+    pub fn clear(&self) {
+        self.open.lock().unwrap().clear();
+    }
+}
+
+/// The queries a cursor can be opened on; field names as in the matching one-shot commands
+#[derive(serde::Deserialize)]
+#[serde(tag = "kind", rename_all = "snake_case")]
+pub enum CursorQuery {
+    /// get_objects
+    Objects { package_name: String, category: String },
+    /// global_search
+    GlobalSearch { query: String, search_mode: String },
+    /// search_object_instances
+    Instances { object_address: String },
+    /// get_array_elements
+    ArrayElements { array_address: String, inner_type: String, count: i32 },
+}
+
+#[derive(serde::Serialize)]
+pub struct CursorInfo {
+    pub id: u64,
+    pub total: usize,
+    pub columns: &'static [Column],
+}
+
+#[derive(serde::Serialize)]
+pub struct CursorPage {
+    pub id: u64,
+    pub total: usize,
+    pub offset: usize,
+    /// Offset of the following page
+    pub next: usize,
+    /// Nothing follows this page
+    pub done: bool,
+    pub rows: serde_json::Value,
+}
+
+fn parse_address(text: &str, what: &str) -> Result<usize, String> {
+    usize::from_str_radix(text.trim().to_lowercase().trim_start_matches("0x"), 16).map_err(|_| format!("Invalid {}", what))
+}
+
+/// Run `query` and keep its result for paging
+#[tauri::command]
+pub async fn open_cursor(state: State<'_, AppState>, query: CursorQuery) -> Result<CursorInfo, String> {
+    let obj_mgr = state.objects();
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not valid")?;
+    let offsets = state.offsets();
+
+    let set: Arc<dyn ResultSet> = match query {
+        CursorQuery::Objects { package_name, category } => {
+            let index = obj_mgr.package_index(&name_pool);
+            let handles = index.package(&package_name).zip(category_slot(&category)).map(|(package, slot)| package.category(slot).to_vec()).unwrap_or_default();
+            Arc::new(HandleRows { handles, objects: obj_mgr, names: name_pool, row: ObjectSummary::of })
+        }
+        CursorQuery::GlobalSearch { query, search_mode } => {
+            let process = state.process.load_full().ok_or("No process attached")?;
+            let rows = tauri::async_runtime::spawn_blocking(move || global_search_rows(&obj_mgr, &name_pool, &process, &offsets, &query, &search_mode)).await.map_err(|e| e.to_string())?;
+            Arc::new(Materialized(rows))
+        }
+        CursorQuery::Instances { object_address } => {
+            let class_address = parse_address(&object_address, "hex address format")?;
+            let (objects, names) = (Arc::clone(&obj_mgr), Arc::clone(&name_pool));
+            let handles = tauri::async_runtime::spawn_blocking(move || instance_handles(&objects, &names, class_address)).await.map_err(|e| e.to_string())?;
+            Arc::new(HandleRows { handles, objects: obj_mgr, names: name_pool, row: InstanceSearchResult::of })
+        }
+        CursorQuery::ArrayElements { array_address, inner_type, count } => {
+            let process = state.process.load_full().ok_or("Process not attached")?;
+            let array_address = parse_address(&array_address, "array address")?;
+            Arc::new(ArrayRows { process, objects: obj_mgr, names: name_pool, offsets, array_address, inner_type, count: (count.max(0) as usize).min(MAX_ARRAY_CURSOR_ROWS) })
+        }
+    };
+
+    let info = CursorInfo { id: 0, total: set.len(), columns: set.columns() };
+    Ok(CursorInfo { id: state.cursors.insert(set), ..info })
+}
+
+fn clamp_range(set: &dyn ResultSet, offset: usize, limit: usize) -> Range<usize> {
+    let total = set.len();
+    offset.min(total)..offset.saturating_add(limit).min(total)
+}
+
+/// Rows [offset, offset + limit) of a cursor as JSON
+#[tauri::command]
+pub async fn fetch_cursor_page(state: State<'_, AppState>, id: u64, offset: usize, limit: usize) -> Result<CursorPage, String> {
+    let set = state.cursors.get(id)?;
+    tauri::async_runtime::spawn_blocking(move || {
+        let range = clamp_range(set.as_ref(), offset, limit);
+        let (rows, next) = set.json(range.clone())?;
+        Ok(CursorPage { id, total: set.len(), offset: range.start, next, done: next >= set.len(), rows })
+    })
+    .await
+    .map_err(|e| e.to_string())?
+}
+
+/// Rows [offset, offset + limit) of a cursor in the packed layout; arrives in JS as an ArrayBuffer
+#[tauri::command]
+pub async fn fetch_cursor_packed(state: State<'_, AppState>, id: u64, offset: usize, limit: usize) -> Result<tauri::ipc::Response, String> {
+    let set = state.cursors.get(id)?;
+    let bytes = tauri::async_runtime::spawn_blocking(move || set.packed(clamp_range(set.as_ref(), offset, limit))).await.map_err(|e| e.to_string())?;
+    Ok(tauri::ipc::Response::new(bytes))
+}
+
+#[tauri::command]
+pub fn close_cursor(state: State<'_, AppState>, id: u64) {
+    state.cursors.close(id);
+}
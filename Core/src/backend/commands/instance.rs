@@ -1,4 +1,9 @@
+use crate::backend::os::process::Process;
 use crate::backend::state::AppState;
+use crate::backend::unreal::layout::{LayoutMember, MemberRole, ValueKind};
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::ObjectManager;
+use crate::backend::unreal::offsets::UEOffset;
 use tauri::State;
 
 #[derive(serde::Serialize)]
@@ -20,27 +25,18 @@ pub struct AddInspectorResponse {
 pub async fn add_inspector(state: State<'_, AppState>, instance_address: String) -> Result<AddInspectorResponse, String> {
     let inst_addr = usize::from_str_radix(instance_address.trim_start_matches("0x"), 16).map_err(|_| "Invalid address")?;
 
-    let process_lock = state.process.lock().map_err(|_| "Lock failed")?;
-    let proc = process_lock.as_ref().ok_or("Process not attached")?;
-    let obj_mgr = &state.object_manager;
+    let proc = state.process.load_full().ok_or("Process not attached")?;
+    let obj_mgr = &state.objects();
 
-    let name_pool_lock = state.name_pool.lock().map_err(|_| "Name pool lock failed")?;
-    let name_pool = name_pool_lock.as_ref().ok_or("Name pool not valid")?;
-    let offsets = {
-        let ac_lock = state.auto_config.lock().unwrap();
-        if let Some(ac) = ac_lock.as_ref() {
-            ac.offsets.clone()
-        } else {
-            crate::backend::unreal::offsets::UEOffset::default()
-        }
-    };
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not valid")?;
+    let offsets = state.offsets();
 
     let mut instance_id = "0".to_string();
     let mut instance_name = "Unknown".to_string();
 
-    if let Some(inst_obj) = obj_mgr.try_save_object(inst_addr, proc, name_pool, &offsets, 0, 5, false) {
-        instance_id = inst_obj.id.to_string();
-        instance_name = inst_obj.name.clone();
+    if let Some(inst_obj) = obj_mgr.try_save_object(inst_addr, &proc, &name_pool, &offsets, 0, 5) {
+        instance_id = inst_obj.id().to_string();
+        instance_name = inst_obj.name().to_string();
     }
 
     let mut hierarchy = Vec::new();
@@ -50,8 +46,8 @@ pub async fn add_inspector(state: State<'_, AppState>, instance_address: String)
 
     let mut safety = 0;
     while current_class_addr > 0x10000 && safety < 50 {
-        if let Some(class_obj) = obj_mgr.try_save_object(current_class_addr, proc, name_pool, &offsets, 0, 5, false) {
-            hierarchy.push(InspectorHierarchyNode { name: class_obj.name.clone(), type_name: class_obj.type_name.clone(), address: format!("0x{:X}", current_class_addr), id: class_obj.id.to_string() });
+        if let Some(class_obj) = obj_mgr.try_save_object(current_class_addr, &proc, &name_pool, &offsets, 0, 5) {
+            hierarchy.push(InspectorHierarchyNode { name: class_obj.name().to_string(), type_name: class_obj.type_name().to_string(), address: format!("0x{:X}", current_class_addr), id: class_obj.id().to_string() });
             // Unreal inheritance chain continues via SuperStruct at offset 0x40
             current_class_addr = proc.memory.try_read_pointer(current_class_addr.wrapping_add(0x40)).unwrap_or(0);
         } else {
@@ -77,342 +73,292 @@ pub struct InstancePropertyInfo {
     pub object_class_id: String,
 }
 
+/// `flatten`: include the members inherited from every SuperStruct, root class first (default: the class's own members,
+/// which is what the Inspector's per-class hierarchy nodes show)
 #[tauri::command]
-pub async fn get_instance_details(state: State<'_, AppState>, instance_address: String, class_address: String) -> Result<Vec<InstancePropertyInfo>, String> {
+pub async fn get_instance_details(state: State<'_, AppState>, instance_address: String, class_address: String, flatten: Option<bool>) -> Result<Vec<InstancePropertyInfo>, String> {
     let inst_addr = usize::from_str_radix(instance_address.trim_start_matches("0x"), 16).map_err(|_| "Invalid instance address")?;
     let class_addr = usize::from_str_radix(class_address.trim_start_matches("0x"), 16).map_err(|_| "Invalid class address")?;
 
-    let process_lock = state.process.lock().map_err(|_| "Lock failed")?;
-    let proc = process_lock.as_ref().ok_or("Process not attached")?;
+    let proc = state.process.load_full().ok_or("Process not attached")?;
 
-    let obj_mgr = &state.object_manager;
-    let pool_guard = state.name_pool.lock().map_err(|_| "Lock failed")?;
-    let name_pool = pool_guard.as_ref().ok_or("Name pool not initialized")?;
+    let obj_mgr = &state.objects();
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not initialized")?;
 
-    let offsets = {
-        let ac_lock = state.auto_config.lock().unwrap();
-        if let Some(ac) = ac_lock.as_ref() {
-            ac.offsets.clone()
-        } else {
-            crate::backend::unreal::offsets::UEOffset::default()
-        }
-    };
+    let offsets = state.offsets();
 
     // Validate class
-    if !obj_mgr.cache_by_address.contains_key(&class_addr) {
+    if !obj_mgr.contains(class_addr) {
         return Err("Class address not valid".to_string());
     }
 
-    let mut results = Vec::new();
+    let layout = obj_mgr.class_layout(class_addr, &proc, &name_pool, &offsets);
+    let instance = BulkBytes::read(&proc, inst_addr, layout.instance_span());
+    let members: Vec<&LayoutMember> = if flatten.unwrap_or(false) { layout.members().collect() } else { layout.own.iter().collect() };
 
-    // Walk the properties of the class
-    let mut child_addr = proc.memory.try_read_pointer(class_addr.wrapping_add(offsets.member)).unwrap_or(0);
-    let mut safety = 0;
-
-    while child_addr > 0x10000 && safety < 500 {
-        safety += 1;
+    Ok(members.into_iter().filter(|m| m.is_property).map(|m| decode_member(m, &instance, &proc, obj_mgr, &name_pool, &offsets)).collect())
+}
 
-        let child_name_id = proc.memory.try_read::<i32>(child_addr.wrapping_add(offsets.member_fname_index)).unwrap_or(0);
-        let child_name = name_pool.get_name(proc, child_name_id as u32).unwrap_or_default();
+/// One bulk read of a remote block (an instance, a page of array elements); anything outside it, or any block that
+/// could not be read whole, falls back to a direct read
+struct BulkBytes<'p> {
+    address: usize,
+    bytes: Vec<u8>,
+    proc: &'p Process,
+}
 
-        let child_type_ptr = proc.memory.try_read_pointer(child_addr.wrapping_add(offsets.member_type_offset)).unwrap_or(0);
-        let child_type_id = proc.memory.try_read::<i32>(child_type_ptr.wrapping_add(offsets.member_type)).unwrap_or(0);
-        let child_type = name_pool.get_name(proc, child_type_id as u32).unwrap_or_default();
+impl<'p> BulkBytes<'p> {
+    fn read(proc: &'p Process, address: usize, span: usize) -> Self {
+        let bytes = proc.memory.read_bytes(address, span).unwrap_or_default();
+        Self { address, bytes, proc }
+    }
 
-        let type_lower = child_type.to_lowercase();
-        if type_lower.contains("property") {
-            let offset_val = proc.memory.try_read::<i32>(child_addr.wrapping_add(offsets.offset)).unwrap_or(0) as usize;
+    fn get<T: Copy + Default>(&self, offset: usize) -> T {
+        let size = std::mem::size_of::<T>();
+        match self.bytes.get(offset..offset + size) {
+            // SAFETY: the slice is exactly size_of::<T>() bytes; T is plain data
+            Some(raw) => unsafe { std::ptr::read_unaligned(raw.as_ptr() as *const T) },
+            None => self.proc.memory.try_read::<T>(self.address.wrapping_add(offset)).unwrap_or_default(),
+        }
+    }
 
-            let mut sub_type = String::new();
-            let prop_0 = proc.memory.try_read_pointer(child_addr.wrapping_add(offsets.property)).unwrap_or(0);
-            let prop_8 = proc.memory.try_read_pointer(child_addr.wrapping_add(offsets.property.wrapping_add(8))).unwrap_or(0);
-            let type_obj = proc.memory.try_read_pointer(child_addr.wrapping_add(offsets.type_object)).unwrap_or(0);
+    fn pointer(&self, offset: usize) -> usize {
+        self.get::<u64>(offset) as usize
+    }
+}
 
-            // Resolve a class name from an address: check cache first, then read FNameIndex directly
-            let resolve_name = |addr: usize| -> String {
-                if addr < 0x10000 {
-                    return String::new();
-                }
-                if let Some(cached) = obj_mgr.cache_by_address.get(&addr) {
-                    if !cached.name.is_empty() && cached.name != "None" {
-                        return cached.name.clone();
-                    }
-                }
-                let name_id = proc.memory.try_read::<i32>(addr.wrapping_add(offsets.fname_index)).unwrap_or(0);
-                name_pool.get_name(proc, name_id as u32).unwrap_or_default()
-            };
-
-            let mut is_object = false;
-            let mut object_instance_address = String::new();
-            let mut object_class_address = String::new();
-            let mut object_class_id = String::new();
-            let mut unassigned_live_value: Option<String> = None;
-
-            if type_lower.contains("objectproperty") || type_lower.contains("classproperty") || type_lower.contains("softobjectproperty") || type_lower.contains("weakobjectproperty") || type_lower.contains("interfaceproperty") {
-                is_object = true;
-                // sub-type is the PropertyClass name: try prop_8 → prop_0 → type_obj
-                for &addr in &[prop_8, prop_0, type_obj] {
-                    let name = resolve_name(addr);
-                    if !name.is_empty() && !name.to_lowercase().contains("property") {
-                        sub_type = name;
-                        break;
-                    }
-                }
-                let actual_memory_addr = inst_addr.wrapping_add(offset_val);
-                let object_ptr = proc.memory.try_read_pointer(actual_memory_addr).unwrap_or(0);
-                if object_ptr > 0x10000 {
-                    if sub_type.to_lowercase() == "scriptstruct" {
-                        // For a UScriptStruct definition pointer (e.g. UDataTable::RowStruct),
-                        // the instance is actually not instantiated here, it's just the type metadata.
-                        // By passing the ScriptStruct as both instance and class, the UI will query the
-                        // layout properties correctly, and use the Struct's metadata block as dummy data safely.
-                        object_instance_address = format!("0x{:X}", object_ptr);
-                        object_class_address = format!("0x{:X}", object_ptr);
-                        if let Some(inst_obj) = obj_mgr.try_save_object(object_ptr, proc, name_pool, &offsets, 0, 5, false) {
-                            object_class_id = inst_obj.id.to_string();
-                            unassigned_live_value = Some(inst_obj.name.clone());
-                        }
-                    } else {
-                        object_instance_address = format!("0x{:X}", object_ptr);
-                        if let Some(inst_obj) = obj_mgr.try_save_object(object_ptr, proc, name_pool, &offsets, 0, 5, false) {
-                            let c_addr = proc.memory.try_read_pointer(object_ptr.wrapping_add(offsets.class)).unwrap_or(0);
-                            object_class_address = format!("0x{:X}", c_addr);
-                            if let Some(class_obj) = obj_mgr.try_save_object(c_addr, proc, name_pool, &offsets, 0, 5, false) {
-                                object_class_id = class_obj.id.to_string();
-                            }
-                            unassigned_live_value = Some(inst_obj.name.clone());
-                        }
+/// The Inspector row of `member` for one instance: the layout's static part plus the value read from `instance`
+fn decode_member(member: &LayoutMember, instance: &BulkBytes, proc: &Process, obj_mgr: &ObjectManager, name_pool: &FNamePool, offsets: &UEOffset) -> InstancePropertyInfo {
+    let offset_val = member.offset;
+    let actual_memory_addr = instance.address.wrapping_add(offset_val);
+
+    let mut is_object = false;
+    let mut object_instance_address = String::new();
+    let mut object_class_address = String::new();
+    let mut object_class_id = String::new();
+    let mut unassigned_live_value: Option<String> = None;
+
+    match member.role {
+        MemberRole::Object => {
+            is_object = true;
+            let object_ptr = instance.pointer(offset_val);
+            if object_ptr > 0x10000 {
+                object_instance_address = format!("0x{:X}", object_ptr);
+                if member.sub_type.eq_ignore_ascii_case("scriptstruct") {
+                    // For a UScriptStruct definition pointer (e.g. UDataTable::RowStruct),
+                    // the instance is actually not instantiated here, it's just the type metadata.
+                    // By passing the ScriptStruct as both instance and class, the UI will query the
+                    // layout properties correctly, and use the Struct's metadata block as dummy data safely.
+                    object_class_address = format!("0x{:X}", object_ptr);
+                    if let Some(inst_obj) = obj_mgr.try_save_object(object_ptr, proc, name_pool, offsets, 0, 5) {
+                        object_class_id = inst_obj.id().to_string();
+                        unassigned_live_value = Some(inst_obj.name().to_string());
                     }
-                }
-            } else if type_lower.contains("structproperty") || type_lower.contains("scriptstruct") {
-                is_object = true;
-                // StructProperty doesn't have a pointer to the instance memory, IT IS the instance memory
-                let actual_memory_addr = inst_addr.wrapping_add(offset_val);
-                object_instance_address = format!("0x{:X}", actual_memory_addr);
-
-                // Find the UScriptStruct class address
-                let mut script_struct_ptr = 0;
-                for &addr in &[prop_0, type_obj, prop_8] {
-                    let name = resolve_name(addr);
-                    if !name.is_empty() && !name.to_lowercase().contains("property") {
-                        sub_type = name;
-                        script_struct_ptr = addr;
-                        break;
+                } else if let Some(inst_obj) = obj_mgr.try_save_object(object_ptr, proc, name_pool, offsets, 0, 5) {
+                    // The saved row already carries ClassPrivate; no need to read it again
+                    let c_addr = inst_obj.class_ptr();
+                    object_class_address = format!("0x{:X}", c_addr);
+                    if let Some(class_obj) = obj_mgr.try_save_object(c_addr, proc, name_pool, offsets, 0, 5) {
+                        object_class_id = class_obj.id().to_string();
                     }
+                    unassigned_live_value = Some(inst_obj.name().to_string());
                 }
-
-                if script_struct_ptr > 0x10000 {
-                    object_class_address = format!("0x{:X}", script_struct_ptr);
-                    if let Some(class_obj) = obj_mgr.try_save_object(script_struct_ptr, proc, name_pool, &offsets, 0, 5, false) {
-                        object_class_id = class_obj.id.to_string();
-                    }
+            }
+        }
+        MemberRole::Struct => {
+            is_object = true;
+            // StructProperty doesn't have a pointer to the instance memory, IT IS the instance memory
+            object_instance_address = format!("0x{:X}", actual_memory_addr);
+            if member.struct_address > 0x10000 {
+                object_class_address = format!("0x{:X}", member.struct_address);
+                if let Some(class_obj) = obj_mgr.try_save_object(member.struct_address, proc, name_pool, offsets, 0, 5) {
+                    object_class_id = class_obj.id().to_string();
                 }
+            }
+            unassigned_live_value = Some(format!("Struct: {}", member.sub_type));
+        }
+        MemberRole::Plain => {}
+    }
 
-                unassigned_live_value = Some(format!("Struct: {}", sub_type));
-            } else if type_lower.contains("enumproperty") {
-                // EnumProperty stores enum type pointer at type_object (0x70)
-                sub_type = resolve_name(type_obj);
-            } else if type_lower.contains("arrayproperty") || type_lower.contains("setproperty") {
-                // Array/Set: Inner FProperty pointer is at prop_0 (offsets.property = 0x78)
-                if prop_0 > 0x10000 {
-                    let inner_type_ptr = proc.memory.try_read_pointer(prop_0.wrapping_add(offsets.member_type_offset)).unwrap_or(0);
-                    let inner_type_id = proc.memory.try_read::<i32>(inner_type_ptr.wrapping_add(offsets.member_type)).unwrap_or(0);
-                    if inner_type_id > 0 && inner_type_id < 2000000 {
-                        let inner_type_name = name_pool.get_name(proc, inner_type_id as u32).unwrap_or_default();
-                        if inner_type_name.to_lowercase().contains("property") {
-                            let mut prop_type_str = inner_type_name.replace("Property", "");
-                            if prop_type_str.to_lowercase().contains("object") || prop_type_str.to_lowercase().contains("class") {
-                                let inner_class_ptr = proc.memory.try_read_pointer(prop_0.wrapping_add(offsets.property)).unwrap_or(0);
-                                let name = resolve_name(inner_class_ptr);
-                                if !name.is_empty() {
-                                    prop_type_str = name;
-                                }
-                            }
-                            sub_type = prop_type_str;
-                        }
-                    }
-                }
-            } else if type_lower.contains("mapproperty") {
-                // Map: KeyProp at prop_0, ValueProp at prop_8
-                let mut parts = Vec::new();
-                for &ptr in &[prop_0, prop_8] {
-                    if ptr > 0x10000 {
-                        let type_ptr = proc.memory.try_read_pointer(ptr.wrapping_add(offsets.member_type_offset)).unwrap_or(0);
-                        let type_id = proc.memory.try_read::<i32>(type_ptr.wrapping_add(offsets.member_type)).unwrap_or(0);
-                        if type_id > 0 && type_id < 2000000 {
-                            let type_name = name_pool.get_name(proc, type_id as u32).unwrap_or_default();
-                            if type_name.to_lowercase().contains("property") {
-                                let mut part = type_name.replace("Property", "");
-                                if part.to_lowercase().contains("object") || part.to_lowercase().contains("class") {
-                                    let inner_ptr = proc.memory.try_read_pointer(ptr.wrapping_add(offsets.property)).unwrap_or(0);
-                                    let name = resolve_name(inner_ptr);
-                                    if !name.is_empty() {
-                                        part = name;
-                                    }
-                                }
-                                parts.push(part);
-                            }
-                        }
-                    }
-                }
-                if !parts.is_empty() {
-                    sub_type = parts.join(", ");
+    // Read Live Value intelligently based on core types
+    let live_value = if let Some(val) = unassigned_live_value {
+        val
+    } else {
+        match member.value {
+            ValueKind::Bool => if instance.get::<u8>(offset_val) & member.bit_mask > 0 { "True" } else { "False" }.to_string(),
+            ValueKind::Name => {
+                let name_str = name_pool.get_name(proc, instance.get::<i32>(offset_val) as u32).unwrap_or_default();
+                if name_str.is_empty() {
+                    "None".to_string()
+                } else {
+                    name_str
                 }
             }
-
-            if !child_name.is_empty() && !child_type.is_empty() {
-                let actual_memory_addr = inst_addr.wrapping_add(offset_val);
-
-                // Read Live Value intelligently based on core types
-                let live_value = if let Some(val) = unassigned_live_value {
-                    val
-                } else if type_lower.contains("boolproperty") {
-                    let bitmask = proc.memory.try_read::<u8>(child_addr.wrapping_add(offsets.bit_mask)).unwrap_or(0);
-                    let memory_byte = proc.memory.try_read::<u8>(actual_memory_addr).unwrap_or(0);
-                    let is_true = (memory_byte & bitmask) > 0;
-                    if is_true {
-                        "True".to_string()
-                    } else {
-                        "False".to_string()
-                    }
-                } else if type_lower.contains("nameproperty") {
-                    let name_id = proc.memory.try_read::<i32>(actual_memory_addr).unwrap_or(0);
-                    let name_str = name_pool.get_name(proc, name_id as u32).unwrap_or_default();
-                    if name_str.is_empty() {
-                        "None".to_string()
-                    } else {
-                        name_str
-                    }
-                } else if type_lower.contains("arrayproperty") {
-                    let array_data_ptr = proc.memory.try_read_pointer(actual_memory_addr).unwrap_or(0);
-                    let array_count = proc.memory.try_read::<i32>(actual_memory_addr.wrapping_add(0x8)).unwrap_or(0);
-                    let array_max = proc.memory.try_read::<i32>(actual_memory_addr.wrapping_add(0xC)).unwrap_or(0);
-
-                    if array_data_ptr > 0x10000 && array_count >= 0 && array_count <= array_max && array_max < 99999 {
-                        is_object = true; // Mark expandable
-                        object_instance_address = format!("0x{:X}", array_data_ptr);
-                        format!("Elements: {}", array_count)
-                    } else {
-                        "Empty Array".to_string()
-                    }
-                } else if type_lower.contains("mapproperty") || type_lower.contains("setproperty") {
-                    // Native TMap / TSet representation: pointer to data, element count, etc.
-                    let map_data_ptr = proc.memory.try_read_pointer(actual_memory_addr).unwrap_or(0);
-                    let map_count = proc.memory.try_read::<i32>(actual_memory_addr.wrapping_add(0x18)).unwrap_or(0); // TMap elements count usually at 0x18 based on FScriptMap
-                    if map_data_ptr > 0x10000 && map_count >= 0 && map_count < 99999 {
-                        is_object = true;
-                        object_instance_address = format!("0x{:X}", map_data_ptr);
-                        format!("Elements: {}", map_count)
-                    } else {
-                        "Empty Map".to_string()
-                    }
-                } else if type_lower.contains("intproperty") || type_lower.contains("int32") {
-                    proc.memory.try_read::<i32>(actual_memory_addr).unwrap_or(0).to_string()
-                } else if type_lower.contains("floatproperty") {
-                    format!("{:.3}", proc.memory.try_read::<f32>(actual_memory_addr).unwrap_or(0.0))
-                } else if type_lower.contains("doubleproperty") {
-                    format!("{:.5}", proc.memory.try_read::<f64>(actual_memory_addr).unwrap_or(0.0))
-                } else if type_lower.contains("byteproperty") {
-                    proc.memory.try_read::<u8>(actual_memory_addr).unwrap_or(0).to_string()
+            ValueKind::Array => {
+                let array_data_ptr = instance.pointer(offset_val);
+                let array_count = instance.get::<i32>(offset_val + 0x8);
+                let array_max = instance.get::<i32>(offset_val + 0xC);
+                if array_data_ptr > 0x10000 && array_count >= 0 && array_count <= array_max && array_max < 99999 {
+                    is_object = true; // Mark expandable
+                    object_instance_address = format!("0x{:X}", array_data_ptr);
+                    format!("Elements: {}", array_count)
                 } else {
-                    format!("0x{:X}", proc.memory.try_read_pointer(actual_memory_addr).unwrap_or(0))
-                };
-
-                let offset_str = if type_lower.contains("boolproperty") {
-                    let bitmask = proc.memory.try_read::<u8>(child_addr.wrapping_add(offsets.bit_mask)).unwrap_or(0);
-                    let bit_index = if bitmask > 0 { bitmask.trailing_zeros() } else { 0 };
-                    format!("{:X}:{}", offset_val, bit_index)
+                    "Empty Array".to_string()
+                }
+            }
+            ValueKind::MapOrSet => {
+                // Native TMap / TSet representation: pointer to data, element count, etc.
+                let map_data_ptr = instance.pointer(offset_val);
+                let map_count = instance.get::<i32>(offset_val + 0x18); // TMap elements count usually at 0x18 based on FScriptMap
+                if map_data_ptr > 0x10000 && map_count >= 0 && map_count < 99999 {
+                    is_object = true;
+                    object_instance_address = format!("0x{:X}", map_data_ptr);
+                    format!("Elements: {}", map_count)
                 } else {
-                    format!("{:X}", offset_val)
-                };
-
-                results.push(InstancePropertyInfo { property_name: child_name, property_type: child_type, offset: offset_str, sub_type, memory_address: format!("0x{:X}", actual_memory_addr), live_value, is_object, object_instance_address, object_class_address, object_class_id });
+                    "Empty Map".to_string()
+                }
             }
+            ValueKind::Int => instance.get::<i32>(offset_val).to_string(),
+            ValueKind::Float => format!("{:.3}", instance.get::<f32>(offset_val)),
+            ValueKind::Double => format!("{:.5}", instance.get::<f64>(offset_val)),
+            ValueKind::Byte => instance.get::<u8>(offset_val).to_string(),
+            ValueKind::Raw => format!("0x{:X}", instance.pointer(offset_val)),
         }
-        child_addr = proc.memory.try_read_pointer(child_addr.wrapping_add(offsets.next_member)).unwrap_or(0);
-    }
+    };
 
-    Ok(results)
+    InstancePropertyInfo {
+        property_name: member.name.clone(),
+        property_type: member.type_name.clone(),
+        offset: member.offset_label.clone(),
+        sub_type: member.sub_type.clone(),
+        memory_address: format!("0x{:X}", actual_memory_addr),
+        live_value,
+        is_object,
+        object_instance_address,
+        object_class_address,
+        object_class_id,
+    }
 }
 
+/// Indices past this are never read by get_array_elements
+pub const MAX_ARRAY_ELEMENTS: usize = 1 << 20;
+
+/// `count` elements from index `start` (default 0); a page is capped at 9999 elements, larger arrays are paged with `start`
 #[tauri::command]
-pub async fn get_array_elements(state: State<'_, AppState>, array_address: String, inner_type: String, count: i32) -> Result<Vec<InstancePropertyInfo>, String> {
+pub async fn get_array_elements(state: State<'_, AppState>, array_address: String, inner_type: String, count: i32, start: Option<usize>) -> Result<Vec<InstancePropertyInfo>, String> {
     let array_addr = usize::from_str_radix(array_address.trim_start_matches("0x"), 16).map_err(|_| "Invalid array address")?;
 
-    let process_lock = state.process.lock().map_err(|_| "Lock failed")?;
-    let proc = process_lock.as_ref().ok_or("Process not attached")?;
-    let obj_mgr = &state.object_manager;
-    let pool_guard = state.name_pool.lock().map_err(|_| "Lock failed")?;
-    let name_pool = pool_guard.as_ref().ok_or("Name pool not initialized")?;
-    let offsets = {
-        let ac_lock = state.auto_config.lock().unwrap();
-        if let Some(ac) = ac_lock.as_ref() {
-            ac.offsets.clone()
-        } else {
-            crate::backend::unreal::offsets::UEOffset::default()
-        }
-    };
+    let proc = state.process.load_full().ok_or("Process not attached")?;
+    let obj_mgr = &state.objects();
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not initialized")?;
+    let offsets = state.offsets();
+
+    let start = start.unwrap_or(0);
+    let safe_count = count.clamp(0, 9999) as usize; // Hard limit to prevent memory blows
+    Ok(read_array_elements(&proc, obj_mgr, &name_pool, &offsets, array_addr, &inner_type, start..start.saturating_add(safe_count), MAX_ARRAY_ELEMENTS))
+}
 
-    let mut results = Vec::new();
-    let safe_count = count.min(9999); // Hard limit to prevent memory blows
+/// How the elements of one array are laid out and shown, worked out once from the inner type name
+#[derive(Clone, Copy, PartialEq, Eq)]
+enum ElementKind {
+    Object,
+    Name,
+    Int,
+    Float,
+    Double,
+    Bool,
+    Byte,
+    Raw,
+}
 
+fn element_layout(inner_type: &str) -> (ElementKind, usize) {
     // Determine stride/size roughly based on `inner_type` (can be enhanced further if needed)
     let type_lower = inner_type.to_lowercase();
-    let mut stride = 0x8; // Default pointer/64-bit size
-
-    if type_lower.contains("byte") || type_lower.contains("bool") {
-        stride = 0x1;
+    let stride = if type_lower.contains("byte") || type_lower.contains("bool") {
+        0x1
     } else if type_lower.contains("int") || type_lower.contains("float") {
-        stride = 0x4;
-    } else if type_lower.contains("double") || type_lower.contains("name") || type_lower.contains("str") {
-        stride = 0x8;
+        0x4
+    } else {
+        0x8 // Default pointer/64-bit size (double, name, str)
+    };
+
+    let kind = if type_lower.contains("object") || type_lower.contains("class") {
+        ElementKind::Object
+    } else if type_lower.contains("name") {
+        ElementKind::Name
+    } else if type_lower.contains("int") {
+        ElementKind::Int
+    } else if type_lower.contains("float") {
+        ElementKind::Float
+    } else if type_lower.contains("bool") {
+        ElementKind::Bool
+    } else if type_lower.contains("double") {
+        ElementKind::Double
+    } else if type_lower.contains("byte") {
+        ElementKind::Byte
+    } else {
+        ElementKind::Raw
+    };
+    (kind, stride)
+}
+
+/// Elements `range` of a TArray's data at `array_addr`, rendered like instance properties.
+/// The range comes from IPC: it is clamped to the array's `num` elements, and one whose byte span overflows reads nothing.
+/// The whole range is one read of the element buffer, decoded locally.
+pub fn read_array_elements(proc: &Process, obj_mgr: &ObjectManager, name_pool: &FNamePool, offsets: &UEOffset, array_addr: usize, inner_type: &str, range: std::ops::Range<usize>, num: usize) -> Vec<InstancePropertyInfo> {
+    let (kind, stride) = element_layout(inner_type);
+    let range = range.start.min(num)..range.end.min(num);
+    // Every i * stride below is at most `end`
+    let (Some(first), Some(end)) = (range.start.checked_mul(stride), range.end.checked_mul(stride)) else { return Vec::new() };
+    if array_addr.checked_add(end).is_none() {
+        return Vec::new();
     }
+    // Pointer-formatted kinds read 8 bytes whatever the stride; the tail keeps the last of them inside the buffer
+    let elements = BulkBytes::read(proc, array_addr + first, end - first + (8 - stride.min(8)));
 
-    for i in 0..safe_count {
-        let element_addr = array_addr.wrapping_add((i as usize) * stride);
+    let mut results = Vec::with_capacity(range.len());
+    for i in range {
+        let at = i * stride - first;
+        let element_addr = array_addr + i * stride;
 
-        let live_value;
         let mut is_object = false;
         let mut object_instance_address = String::new();
         let mut object_class_address = String::new();
         let mut object_class_id = String::new();
 
-        if type_lower.contains("object") || type_lower.contains("class") {
-            let obj_ptr = proc.memory.try_read_pointer(element_addr).unwrap_or(0);
-            if obj_ptr > 0x10000 {
-                is_object = true;
-                object_instance_address = format!("0x{:X}", obj_ptr);
-                if let Some(inst_obj) = obj_mgr.try_save_object(obj_ptr, proc, name_pool, &offsets, 0, 5, false) {
-                    let c_addr = proc.memory.try_read_pointer(obj_ptr.wrapping_add(offsets.class)).unwrap_or(0);
-                    object_class_address = format!("0x{:X}", c_addr);
-                    if let Some(class_obj) = obj_mgr.try_save_object(c_addr, proc, name_pool, &offsets, 0, 5, false) {
-                        object_class_id = class_obj.id.to_string();
+        let live_value = match kind {
+            ElementKind::Object => {
+                let obj_ptr = elements.pointer(at);
+                if obj_ptr > 0x10000 {
+                    is_object = true;
+                    object_instance_address = format!("0x{:X}", obj_ptr);
+                    if let Some(inst_obj) = obj_mgr.try_save_object(obj_ptr, proc, name_pool, offsets, 0, 5) {
+                        let c_addr = inst_obj.class_ptr();
+                        object_class_address = format!("0x{:X}", c_addr);
+                        if let Some(class_obj) = obj_mgr.try_save_object(c_addr, proc, name_pool, offsets, 0, 5) {
+                            object_class_id = class_obj.id().to_string();
+                        }
+                        inst_obj.name().to_string()
+                    } else {
+                        format!("0x{:X}", obj_ptr)
                     }
-                    live_value = inst_obj.name.clone();
                 } else {
-                    live_value = format!("0x{:X}", obj_ptr);
+                    "0x0".to_string()
                 }
-            } else {
-                live_value = "0x0".to_string();
             }
-        } else if type_lower.contains("name") {
-            let name_id = proc.memory.try_read::<i32>(element_addr).unwrap_or(0);
-            live_value = name_pool.get_name(proc, name_id as u32).unwrap_or("None".to_string());
-        } else if type_lower.contains("int") {
-            live_value = proc.memory.try_read::<i32>(element_addr).unwrap_or(0).to_string();
-        } else if type_lower.contains("float") {
-            live_value = format!("{:.3}", proc.memory.try_read::<f32>(element_addr).unwrap_or(0.0));
-        } else if type_lower.contains("bool") {
-            let val = proc.memory.try_read::<u8>(element_addr).unwrap_or(0);
-            live_value = if val > 0 { "True".to_string() } else { "False".to_string() };
-        } else {
-            live_value = format!("0x{:X}", proc.memory.try_read_pointer(element_addr).unwrap_or(0));
-        }
+            ElementKind::Name => name_pool.get_name(proc, elements.get::<i32>(at) as u32).unwrap_or("None".to_string()),
+            ElementKind::Int => elements.get::<i32>(at).to_string(),
+            ElementKind::Float => format!("{:.3}", elements.get::<f32>(at)),
+            ElementKind::Double => format!("{:.5}", elements.get::<f64>(at)),
+            ElementKind::Bool => if elements.get::<u8>(at) > 0 { "True" } else { "False" }.to_string(),
+            ElementKind::Byte => elements.get::<u8>(at).to_string(),
+            ElementKind::Raw => format!("0x{:X}", elements.pointer(at)),
+        };
 
         results.push(InstancePropertyInfo {
             property_name: format!("[{}]", i),
-            property_type: inner_type.clone(),
-            offset: format!("{:X}", (i as usize) * stride),
+            property_type: inner_type.to_string(),
+            offset: format!("{:X}", i * stride),
             sub_type: String::new(),
             memory_address: format!("0x{:X}", element_addr),
             live_value,
@@ -423,52 +369,71 @@ pub async fn get_array_elements(state: State<'_, AppState>, array_address: Strin
         });
     }
 
-    Ok(results)
+    results
 }
 
-#[tauri::command]
-pub async fn write_instance_property(state: State<'_, AppState>, address: String, offset_str: String, property_type: String, new_value: String) -> Result<(), String> {
-    let addr = usize::from_str_radix(address.trim_start_matches("0x"), 16).map_err(|_| "Invalid address")?;
-    let process_lock = state.process.lock().map_err(|_| "Lock failed")?;
-    let proc = process_lock.as_ref().ok_or("Process not attached")?;
-
-    let type_lower = property_type.to_lowercase();
-
-    if type_lower.contains("intproperty") || type_lower.contains("int32") {
-        let val = new_value.parse::<i32>().map_err(|_| "Invalid int32 value")?;
-        proc.memory.write(addr, val)?;
-    } else if type_lower.contains("floatproperty") {
-        let val = new_value.parse::<f32>().map_err(|_| "Invalid float value")?;
-        proc.memory.write(addr, val)?;
-    } else if type_lower.contains("doubleproperty") {
-        let val = new_value.parse::<f64>().map_err(|_| "Invalid double value")?;
-        proc.memory.write(addr, val)?;
-    } else if type_lower.contains("byteproperty") {
-        let val = new_value.parse::<u8>().map_err(|_| "Invalid byte value")?;
-        proc.memory.write(addr, val)?;
-    } else if type_lower.contains("boolproperty") {
-        let is_true = new_value.to_lowercase() == "true" || new_value == "1";
-
-        let mut bit_index = 0;
-        if let Some((_, b_idx)) = offset_str.split_once(':') {
-            bit_index = b_idx.parse::<u8>().unwrap_or(0);
-        }
+/// A decoded property write: plain bytes, or one bit of a BoolProperty byte (read-modify-write)
+pub enum PropertyWrite {
+    Bytes(Vec<u8>),
+    Bit { mask: u8, set: bool },
+}
+
+impl PropertyWrite {
+    /// Parse `new_value` for `property_type`; `offset_str` carries the bool bit index as "offset:bit"
+    pub fn parse(offset_str: &str, property_type: &str, new_value: &str) -> Result<Self, String> {
+        let type_lower = property_type.to_lowercase();
+
+        if type_lower.contains("intproperty") || type_lower.contains("int32") {
+            let val = new_value.parse::<i32>().map_err(|_| "Invalid int32 value")?;
+            Ok(Self::Bytes(val.to_le_bytes().to_vec()))
+        } else if type_lower.contains("floatproperty") {
+            let val = new_value.parse::<f32>().map_err(|_| "Invalid float value")?;
+            Ok(Self::Bytes(val.to_le_bytes().to_vec()))
+        } else if type_lower.contains("doubleproperty") {
+            let val = new_value.parse::<f64>().map_err(|_| "Invalid double value")?;
+            Ok(Self::Bytes(val.to_le_bytes().to_vec()))
+        } else if type_lower.contains("byteproperty") {
+            let val = new_value.parse::<u8>().map_err(|_| "Invalid byte value")?;
+            Ok(Self::Bytes(vec![val]))
+        } else if type_lower.contains("boolproperty") {
+            let is_true = new_value.to_lowercase() == "true" || new_value == "1";
+
+            let mut bit_index = 0;
+            if let Some((_, b_idx)) = offset_str.split_once(':') {
+                bit_index = b_idx.parse::<u8>().unwrap_or(0);
+            }
+            // The index comes from the client's "offset:bit" string
+            if bit_index >= 8 {
+                return Err(format!("Invalid bit index {} for a BoolProperty (0-7)", bit_index));
+            }
 
-        // Use full byte if no bitmask was defined properly, but typically bit_mask is 1<<bit_index.
-        // There are cases where BoolProperty uses the whole byte (e.g. native bool in C++).
-        // Let's assume if bit_index is 0 and it wasn't specified with ':', it might be bit 0.
-        // Actually, if bitmask was 0, bit.trailing_zeros() is 0.
-        let bitmask = 1u8 << bit_index;
-        let mut memory_byte = proc.memory.read::<u8>(addr).unwrap_or(0);
-        if is_true {
-            memory_byte |= bitmask;
+            // Use full byte if no bitmask was defined properly, but typically bit_mask is 1<<bit_index.
+            // There are cases where BoolProperty uses the whole byte (e.g. native bool in C++).
+            // Let's assume if bit_index is 0 and it wasn't specified with ':', it might be bit 0.
+            // Actually, if bitmask was 0, bit.trailing_zeros() is 0.
+            Ok(Self::Bit { mask: 1u8 << bit_index, set: is_true })
         } else {
-            memory_byte &= !bitmask;
+            Err(format!("Unsupported type for writing: {}", property_type))
+        }
+    }
+
+    /// Final bytes, given the current value of the target byte for bit writes
+    pub fn into_bytes(self, current_byte: impl FnOnce() -> u8) -> Vec<u8> {
+        match self {
+            Self::Bytes(bytes) => bytes,
+            Self::Bit { mask, set } => {
+                let memory_byte = current_byte();
+                vec![if set { memory_byte | mask } else { memory_byte & !mask }]
+            }
         }
-        proc.memory.write(addr, memory_byte)?;
-    } else {
-        return Err(format!("Unsupported type for writing: {}", property_type));
     }
+}
+
+#[tauri::command]
+pub async fn write_instance_property(state: State<'_, AppState>, address: String, offset_str: String, property_type: String, new_value: String) -> Result<(), String> {
+    let addr = usize::from_str_radix(address.trim_start_matches("0x"), 16).map_err(|_| "Invalid address")?;
+    let proc = state.process.load_full().ok_or("Process not attached")?;
 
-    Ok(())
+    let bytes = PropertyWrite::parse(&offset_str, &property_type, &new_value)?.into_bytes(|| proc.memory.read::<u8>(addr).unwrap_or(0));
+    proc.memory.write_bytes(addr, &bytes)
 }
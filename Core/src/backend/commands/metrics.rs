@@ -0,0 +1,48 @@
+use crate::backend::os::memory::PAGE_CACHE;
+use crate::backend::os::profile::{self, LookupStats, OpMetrics, IO};
+use crate::backend::state::AppState;
+use crate::backend::unreal::name_pool::NamePoolStats;
+use crate::backend::unreal::object_array::ObjectManagerStats;
+use tauri::State;
+
+/// Counters since start (or the last reset): Memory syscalls, cache hit ratios and lock contention
+#[derive(Debug, Clone, serde::Serialize)]
+pub struct RuntimeMetrics {
+    pub io: Vec<OpMetrics>,
+    pub page_cache: LookupStats,
+    pub name_pool: Option<NamePoolStats>,
+    pub objects: ObjectManagerStats,
+    pub working_set_bytes: Option<usize>,
+    pub peak_working_set_bytes: Option<usize>,
+    /// Only with `--features alloc-profile`
+    pub allocations: Option<u64>,
+    pub allocated_bytes: Option<u64>,
+}
+
+/// Shared by the Tauri command and /api/metrics
+pub fn collect(state: &AppState) -> RuntimeMetrics {
+    let rss = profile::resident_memory();
+    let allocations = profile::allocations();
+    RuntimeMetrics {
+        io: IO.metrics(),
+        page_cache: PAGE_CACHE.stats(),
+        name_pool: state.name_pool.load_full().map(|pool| pool.stats()),
+        objects: state.objects().stats(),
+        working_set_bytes: rss.map(|r| r.0),
+        peak_working_set_bytes: rss.map(|r| r.1),
+        allocations: allocations.map(|a| a.0),
+        allocated_bytes: allocations.map(|a| a.1),
+    }
+}
+
+#[tauri::command]
+pub fn get_runtime_metrics(state: State<'_, AppState>) -> RuntimeMetrics {
+    collect(&state)
+}
+
+/// Zero the process-wide Memory and page cache counters; pool and object counters restart with their next parse
+#[tauri::command]
+pub fn reset_runtime_metrics() {
+    IO.reset();
+    PAGE_CACHE.reset();
+}
@@ -1,12 +1,19 @@
 pub mod analyzer;
 pub mod api;
 pub mod base_address;
+pub mod bench;
+pub mod cursor;
 pub mod inspector;
 pub mod instance;
+pub mod metrics;
 pub mod package;
 pub mod parser;
 pub mod process;
+pub mod scan;
+pub mod sdk;
 pub mod search;
+pub mod snapshot;
+pub mod watch;
 
 pub fn get_handlers() -> impl Fn(tauri::ipc::Invoke) -> bool {
     tauri::generate_handler![
@@ -17,15 +24,23 @@ pub fn get_handlers() -> impl Fn(tauri::ipc::Invoke) -> bool {
         base_address::get_guobject_array_address,
         base_address::get_gworld_address,
         base_address::show_base_address,
+        base_address::benchmark_signature_scan,
+        bench::run_pipeline_benchmark,
+        scan::list_modules,
+        scan::scan_memory,
         parser::parse_fname_pool,
         parser::parse_guobject_array,
+        parser::resync_guobject_array,
         parser::run_auto_config,
         package::get_packages,
         package::get_objects,
+        package::get_objects_page,
         inspector::get_object_details,
+        sdk::generate_sdk,
         search::global_search,
         search::search_object_instances,
         search::search_object_references,
+        search::refresh_object_references,
         search::get_object_address_by_id,
         instance::add_inspector,
         instance::get_instance_details,
@@ -36,5 +51,19 @@ pub fn get_handlers() -> impl Fn(tauri::ipc::Invoke) -> bool {
         api::start_api_server,
         api::sync_api_config,
         api::fetch_api_live_values,
+        api::set_api_stream_interval,
+        metrics::get_runtime_metrics,
+        metrics::reset_runtime_metrics,
+        cursor::open_cursor,
+        cursor::fetch_cursor_page,
+        cursor::fetch_cursor_packed,
+        cursor::close_cursor,
+        snapshot::save_snapshot,
+        snapshot::load_snapshot,
+        watch::add_watch,
+        watch::remove_watches,
+        watch::list_watches,
+        watch::set_watch_rate,
+        watch::get_watch_series,
     ]
 }
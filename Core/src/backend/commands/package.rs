@@ -1,4 +1,6 @@
 use crate::backend::state::AppState;
+use crate::backend::unreal::object_array::ObjectView;
+use crate::backend::unreal::package_index::category_slot;
 use tauri::State;
 
 #[derive(serde::Serialize)]
@@ -8,53 +10,44 @@ pub struct PackageInfo {
 }
 
 pub fn extract_package_name(input: &str) -> String {
+    package_of(input).to_string()
+}
+
+/// The package part of a full name ("/Script/Engine" of "Class /Script/Engine.Actor"), borrowed
+pub fn package_of(input: &str) -> &str {
     let first_slash = match input.find('/') {
         Some(idx) => idx,
-        None => return String::new(),
+        None => return "",
     };
 
     let second_slash = match input[first_slash + 1..].find('/') {
         Some(idx) => first_slash + 1 + idx,
-        None => return String::new(),
+        None => return "",
     };
 
     if let Some(idx) = input[second_slash + 1..].find('/') {
         let third_slash = second_slash + 1 + idx;
-        return input[first_slash..third_slash].to_string();
+        return &input[first_slash..third_slash];
     }
 
     if let Some(idx) = input[second_slash + 1..].find('.') {
         let dot_pos = second_slash + 1 + idx;
-        return input[first_slash..dot_pos].to_string();
+        return &input[first_slash..dot_pos];
     }
 
     if let Some(idx) = input[second_slash + 1..].find(':') {
         let colon_pos = second_slash + 1 + idx;
-        return input[first_slash..colon_pos].to_string();
+        return &input[first_slash..colon_pos];
     }
 
-    input[first_slash..].to_string()
+    &input[first_slash..]
 }
 
 #[tauri::command]
 pub fn get_packages(state: State<'_, AppState>) -> Result<Vec<PackageInfo>, String> {
-    let obj_mgr = &state.object_manager;
-    let mut package_counts: std::collections::HashMap<String, usize> = std::collections::HashMap::new();
-
-    for entry in obj_mgr.cache_by_address.iter() {
-        let obj = entry.value();
-        let pkg_name = extract_package_name(&obj.full_name);
-
-        // Match legacy C++ logic: Include native Scripts, Engine core, and root Game folder
-        if !pkg_name.is_empty() && (pkg_name.starts_with("/Script/") || pkg_name.starts_with("/Engine/") || pkg_name.starts_with("/Game/")) {
-            *package_counts.entry(pkg_name).or_insert(0) += 1;
-        }
-    }
-
-    let mut packages: Vec<PackageInfo> = package_counts.into_iter().map(|(name, count)| PackageInfo { name, object_count: count }).collect();
-
-    packages.sort_by(|a, b| a.name.cmp(&b.name));
-    Ok(packages)
+    let Some(name_pool) = state.name_pool.load_full() else { return Ok(Vec::new()) };
+    let index = state.objects().package_index(&name_pool);
+    Ok(index.packages().map(|p| PackageInfo { name: p.name.clone(), object_count: p.object_count }).collect())
 }
 
 #[derive(serde::Serialize)]
@@ -65,29 +58,41 @@ pub struct ObjectSummary {
     pub type_name: String,
 }
 
+impl ObjectSummary {
+    pub fn of(obj: &ObjectView<'_>) -> Self {
+        Self { address: obj.address(), name: obj.name().to_string(), full_name: obj.full_name(), type_name: obj.type_name().to_string() }
+    }
+}
+
+#[derive(serde::Serialize)]
+pub struct ObjectPage {
+    /// Objects in the whole category; the page is objects[offset..offset + objects.len()] of it
+    pub total: usize,
+    pub offset: usize,
+    pub objects: Vec<ObjectSummary>,
+}
+
+/// One name-ordered slice of a package category; only the returned rows are turned into strings
+fn object_page(state: &AppState, package_name: &str, category: &str, offset: usize, limit: usize) -> ObjectPage {
+    let empty = ObjectPage { total: 0, offset, objects: Vec::new() };
+    let Some(name_pool) = state.name_pool.load_full() else { return empty };
+    let obj_mgr = &state.objects();
+    let index = obj_mgr.package_index(&name_pool);
+    let (Some(package), Some(slot)) = (index.package(package_name), category_slot(category)) else { return empty };
+
+    let handles = package.category(slot);
+    let page = &handles[offset.min(handles.len())..offset.saturating_add(limit).min(handles.len())];
+    let objects = page.iter().filter_map(|&h| obj_mgr.view(h, &name_pool)).map(|obj| ObjectSummary::of(&obj)).collect();
+    ObjectPage { total: handles.len(), offset, objects }
+}
+
 #[tauri::command]
 pub fn get_objects(state: State<'_, AppState>, package_name: String, category: String) -> Result<Vec<ObjectSummary>, String> {
-    let obj_mgr = &state.object_manager;
-    let mut results = Vec::new();
-
-    for entry in obj_mgr.cache_by_address.iter() {
-        let obj = entry.value();
-        let pkg_name = extract_package_name(&obj.full_name);
-
-        if pkg_name == package_name {
-            let is_match = match category.as_str() {
-                "Class" => obj.type_name.contains("Class") && !obj.type_name.contains("Function"),
-                "Struct" => obj.type_name.contains("Struct") && !obj.type_name.contains("Function"),
-                "Enum" => obj.type_name.contains("Enum"),
-                "Function" => obj.type_name.contains("Function"),
-                _ => false, // fallback
-            };
-            if is_match {
-                results.push(ObjectSummary { address: obj.address, name: obj.name.clone(), full_name: obj.full_name.clone(), type_name: obj.type_name.clone() });
-            }
-        }
-    }
+    Ok(object_page(&state, &package_name, &category, 0, usize::MAX).objects)
+}
 
-    results.sort_by(|a, b| a.name.cmp(&b.name));
-    Ok(results)
+/// Paged get_objects for packages too large to ship in one response
+#[tauri::command]
+pub fn get_objects_page(state: State<'_, AppState>, package_name: String, category: String, offset: usize, limit: usize) -> Result<ObjectPage, String> {
+    Ok(object_page(&state, &package_name, &category, offset, limit))
 }
@@ -1,15 +1,32 @@
 use crate::backend::state::AppState;
+use crate::backend::unreal::autoconfig::OffsetSource;
+use crate::backend::unreal::name_pool::FNamePool;
 use std::sync::Arc;
-use tauri::State;
+use tauri::{Emitter, State};
+
+/// Reuse the pool already in state, and the blocks it has decoded, when it points at the same FNamePool
+fn shared_name_pool(state: &AppState, base_address: usize) -> Arc<FNamePool> {
+    let mut shared = None;
+    state.name_pool.rcu(|current| {
+        let pool = match current {
+            Some(pool) if pool.base_address() == base_address => Arc::clone(pool),
+            _ => Arc::new(FNamePool::new(base_address)),
+        };
+        shared = Some(Arc::clone(&pool));
+        Some(pool)
+    });
+    shared.unwrap()
+}
 
 #[tauri::command]
 pub async fn parse_fname_pool(app_handle: tauri::AppHandle, state: State<'_, AppState>) -> Result<u32, String> {
-    let process = state.process.lock().unwrap().clone().ok_or("No process attached")?;
-    let base_address = state.base_addresses.lock().unwrap().fname_pool.ok_or("FNamePool address not resolved. Please call get_fname_pool_address first.")?;
+    let process = state.process.load_full().ok_or("No process attached")?;
+    let base_address = state.base_addresses.load().fname_pool.ok_or("FNamePool address not resolved. Please call get_fname_pool_address first.")?;
+
+    let pool = shared_name_pool(&state, base_address);
 
     tauri::async_runtime::spawn_blocking(move || {
-        let pool = crate::backend::unreal::name_pool::FNamePool::new(base_address);
-        match pool.parse_pool(&process, &app_handle) {
+        match pool.parse_pool(&process, Some(&app_handle)) {
             Ok((valid_blocks, valid_names)) => {
                 println!("\n====== FNamePool Parsing ======");
                 println!("[ FNamePool Quantity ] {}", valid_blocks);
@@ -28,40 +45,36 @@ pub async fn parse_fname_pool(app_handle: tauri::AppHandle, state: State<'_, App
 }
 
 #[tauri::command]
-pub async fn parse_guobject_array(app_handle: tauri::AppHandle, state: State<'_, AppState>) -> Result<u32, String> {
-    let process = state.process.lock().unwrap().clone().ok_or("No process attached")?;
+pub async fn parse_guobject_array(app_handle: tauri::AppHandle, state: State<'_, AppState>, index_references: Option<bool>, shallow: Option<bool>) -> Result<u32, String> {
+    let process = state.process.load_full().ok_or("No process attached")?;
     let (fname_pool_addr, guobject_addr, element_size) = {
-        let ba = state.base_addresses.lock().unwrap();
+        let ba = state.base_addresses.load_full();
         let fname = ba.fname_pool.ok_or("FNamePool address not resolved. Please call get_fname_pool_address first.")?;
         let guobj = ba.guobject_array.ok_or("GUObjectArray address not resolved. Please call get_guobject_array_address first.")?;
         let size = ba.guobject_element_size.ok_or("GUObjectArray element size not resolved. Please call get_guobject_array_address first.")?;
         (fname, guobj, size)
     };
 
-    let name_pool = Arc::new(crate::backend::unreal::name_pool::FNamePool::new(fname_pool_addr));
-    {
-        let mut np_lock = state.name_pool.lock().unwrap();
-        *np_lock = Some(Arc::clone(&name_pool));
-    }
+    let name_pool = shared_name_pool(&state, fname_pool_addr);
 
-    let obj_mgr = Arc::clone(&state.object_manager);
-    obj_mgr.cache_by_address.clear();
-    obj_mgr.cache_by_id.clear();
-    obj_mgr.total_object_count.store(0, std::sync::atomic::Ordering::Relaxed);
-
-    let offsets = {
-        let ac_lock = state.auto_config.lock().unwrap();
-        if let Some(ac) = ac_lock.as_ref() {
-            ac.offsets.clone()
-        } else {
-            crate::backend::unreal::offsets::UEOffset::default()
-        }
-    };
+    let obj_mgr = state.objects();
+    obj_mgr.clear();
+
+    let offsets = state.offsets();
 
     tauri::async_runtime::spawn_blocking(move || {
         let obj_array = crate::backend::unreal::object_array::GUObjectArray::new(guobject_addr);
-        match obj_array.parse_array(&process, &name_pool, &offsets, element_size, &app_handle, &obj_mgr) {
+        // Shallow: every slot is listed and searchable right away; members and properties are decoded per object on first use
+        match obj_array.parse_array(&process, &name_pool, &offsets, element_size, Some(&app_handle), &obj_mgr, shallow.unwrap_or(false)) {
             Ok(count) => {
+                // Build the search indexes now so the first search doesn't pay for them
+                obj_mgr.hierarchy();
+                obj_mgr.search_index(&name_pool, &process, &offsets);
+                obj_mgr.package_index(&name_pool);
+                // Optional: reads every object once, so pointer reference queries are answered from the index
+                if index_references.unwrap_or(false) {
+                    obj_mgr.ref_index(&name_pool, &process, &offsets);
+                }
                 println!("\n====== GUObjectArray Parsing ======");
                 println!("[ GUObjectArray Total Objects ] {}", count);
                 println!("===================================\n");
@@ -77,32 +90,73 @@ pub async fn parse_guobject_array(app_handle: tauri::AppHandle, state: State<'_,
     .map_err(|e| e.to_string())?
 }
 
+/// Incremental refresh of the last parse: only slots whose object changed are decoded; the delta is emitted as `guobject-array-delta`
+#[tauri::command]
+pub async fn resync_guobject_array(app_handle: tauri::AppHandle, state: State<'_, AppState>) -> Result<crate::backend::unreal::object_array::ObjectArrayDelta, String> {
+    let process = state.process.load_full().ok_or("No process attached")?;
+    let (fname_pool_addr, guobject_addr, element_size) = {
+        let ba = state.base_addresses.load_full();
+        let fname = ba.fname_pool.ok_or("FNamePool address not resolved. Please call get_fname_pool_address first.")?;
+        let guobj = ba.guobject_array.ok_or("GUObjectArray address not resolved. Please call get_guobject_array_address first.")?;
+        let size = ba.guobject_element_size.ok_or("GUObjectArray element size not resolved. Please call get_guobject_array_address first.")?;
+        (fname, guobj, size)
+    };
+
+    let name_pool = shared_name_pool(&state, fname_pool_addr);
+    let obj_mgr = state.objects();
+
+    let offsets = state.offsets();
+
+    let delta = tauri::async_runtime::spawn_blocking(move || {
+        let obj_array = crate::backend::unreal::object_array::GUObjectArray::new(guobject_addr);
+        // The search indexes notice the new revision and rebuild lazily on the next search;
+        // the package index is extended right away when the resync only added objects
+        let delta = obj_array.resync(&process, &name_pool, &offsets, element_size, &obj_mgr)?;
+        obj_mgr.package_index(&name_pool);
+        Ok::<_, String>(delta)
+    })
+    .await
+    .map_err(|e| e.to_string())??;
+
+    app_handle.emit("guobject-array-delta", &delta).ok();
+    Ok(delta)
+}
+
 #[tauri::command]
-pub async fn run_auto_config(_app_handle: tauri::AppHandle, state: State<'_, AppState>) -> Result<crate::backend::unreal::offsets::UEOffset, String> {
-    let process = state.process.lock().unwrap().clone().ok_or("No process attached")?;
+pub async fn run_auto_config(_app_handle: tauri::AppHandle, state: State<'_, AppState>, force: Option<bool>) -> Result<crate::backend::unreal::offsets::UEOffset, String> {
+    let process = state.process.load_full().ok_or("No process attached")?;
+
+    // Offsets restored from the build cache on attach are already validated; only rediscover when asked to.
+    // Anything else (an earlier run, a snapshot) is what the user is re-running AutoConfig to replace.
+    if let Some(ac) = state.auto_config.load_full() {
+        if ac.source == OffsetSource::BuildCache && !force.unwrap_or(false) {
+            println!("[AutoConfig] Using offsets {}", ac.source.label());
+            return Ok(ac.offsets.clone());
+        }
+        println!("[AutoConfig] Rediscovering; replacing offsets {}", ac.source.label());
+    }
     let (fname_pool_addr, guobject_addr, element_size) = {
-        let ba = state.base_addresses.lock().unwrap();
+        let ba = state.base_addresses.load_full();
         let fname = ba.fname_pool.ok_or("FNamePool address not resolved. Please call get_fname_pool_address first.")?;
         let guobj = ba.guobject_array.ok_or("GUObjectArray address not resolved. Please call get_guobject_array_address first.")?;
         let size = ba.guobject_element_size.ok_or("GUObjectArray element size not resolved. Please call get_guobject_array_address first.")?;
         (fname, guobj, size)
     };
 
-    let name_pool = Arc::new(crate::backend::unreal::name_pool::FNamePool::new(fname_pool_addr));
-    let obj_mgr = Arc::clone(&state.object_manager);
+    let name_pool = shared_name_pool(&state, fname_pool_addr);
+    let obj_mgr = state.objects();
 
     let offsets = tauri::async_runtime::spawn_blocking(move || {
         let mut auto_config = crate::backend::unreal::autoconfig::AutoConfig::new();
         auto_config.scan_basic_offsets(&process, &name_pool, &obj_mgr, guobject_addr, element_size)?;
+        crate::backend::unreal::build_cache::BuildCache::store_offsets(&process, &auto_config.offsets);
         Ok::<_, String>(auto_config.offsets)
     })
     .await
     .map_err(|e| e.to_string())??;
 
-    {
-        let mut ac_lock = state.auto_config.lock().unwrap();
-        *ac_lock = Some(crate::backend::unreal::autoconfig::AutoConfig { offsets: offsets.clone() });
-    }
+    state.auto_config.store(Some(Arc::new(crate::backend::unreal::autoconfig::AutoConfig { offsets: offsets.clone(), source: OffsetSource::Discovered })));
+    state.objects().clear_layouts();
 
     Ok(offsets)
 }
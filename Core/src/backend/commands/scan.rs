@@ -0,0 +1,56 @@
+use crate::backend::os::process::ModuleInfo;
+use crate::backend::os::scanner::{PatternSet, RegionFilter, ScanOptions, ScanResult, Scanner};
+use crate::backend::state::AppState;
+use tauri::State;
+
+#[derive(Debug, Clone, serde::Deserialize)]
+pub struct ScanRequest {
+    /// AOB signatures ("48 8B 05 ? ? ? ?"), matched together in one pass
+    #[serde(default)]
+    pub signatures: Vec<String>,
+    /// Search for this pointer value instead (e.g. a vtable), 8-byte aligned unless `options.align` says otherwise
+    pub pointer: Option<usize>,
+    /// Restrict the scan to one module's image; the filter's start/end are ignored then
+    pub module: Option<String>,
+    #[serde(default)]
+    pub filter: RegionFilter,
+    pub options: Option<ScanOptions>,
+}
+
+#[tauri::command]
+pub fn list_modules(state: State<'_, AppState>) -> Result<Vec<ModuleInfo>, String> {
+    let process = state.process.load_full().ok_or("No process attached")?;
+    process.modules()
+}
+
+/// Streaming signature or pointer scan over modules and heap, filtered by protection and region type
+#[tauri::command]
+pub async fn scan_memory(state: State<'_, AppState>, request: ScanRequest) -> Result<ScanResult, String> {
+    let process = state.process.load_full().ok_or("No process attached")?;
+
+    let mut filter = request.filter.clone();
+    if let Some(name) = &request.module {
+        let module = process.module(name)?;
+        filter.start = module.base;
+        filter.end = module.base + module.size;
+    }
+    let mut options = request.options.unwrap_or_default();
+    let mut signatures = request.signatures.clone();
+    if let Some(pointer) = request.pointer {
+        signatures = vec![pointer.to_le_bytes().iter().map(|b| format!("{:02X}", b)).collect::<Vec<_>>().join(" ")];
+        if request.options.is_none() {
+            options.align = 8;
+        }
+    }
+    let refs: Vec<&str> = signatures.iter().map(String::as_str).collect();
+    let set = PatternSet::parse(&refs)?;
+
+    let (start, end) = (filter.start, filter.end);
+    let result = tauri::async_runtime::spawn_blocking(move || Scanner::scan_regions(&process.memory, &filter, &set, &options)).await.map_err(|e| e.to_string())?;
+
+    println!("\n====== Memory Scan ======");
+    println!("[ Range ] 0x{:X} - 0x{:X}  [ Regions ] {}  [ Scanned ] {} MB", start, end, result.regions, result.bytes_scanned / (1024 * 1024));
+    println!("[ Hits ] {}  [ Early stop ] {}  [ Time ] {:.1} ms", result.hits.iter().map(Vec::len).sum::<usize>(), result.stopped_early, result.elapsed_ms);
+    println!("=========================\n");
+    Ok(result)
+}
@@ -0,0 +1,34 @@
+use crate::backend::state::AppState;
+use crate::backend::unreal::sdk::{SdkFormat, SdkGenerator, SdkReport};
+use std::path::PathBuf;
+use tauri::State;
+
+/// Write the SDK of the parsed objects to `output_dir`: one header and/or JSON file per package, plus SDK.hpp.
+/// `format` is "cpp", "json" or "both" (the default). Progress arrives as "sdk-progress" events.
+#[tauri::command]
+pub async fn generate_sdk(app_handle: tauri::AppHandle, state: State<'_, AppState>, output_dir: String, format: Option<String>) -> Result<SdkReport, String> {
+    let format = SdkFormat::parse(format.as_deref().unwrap_or("both"))?;
+    let process = state.process.load_full().ok_or("No process attached")?;
+    let name_pool = state.name_pool.load_full().ok_or("FNamePool not yet parsed. Please parse GUObjectArray first.")?;
+    let objects = state.objects();
+    let offsets = state.offsets();
+    if objects.len() == 0 {
+        return Err("GUObjectArray not yet parsed".to_string());
+    }
+
+    println!("======= [ SDK ] =======");
+    println!("[ Output ] {} ({:?})", output_dir, format);
+    let report = tauri::async_runtime::spawn_blocking(move || {
+        let generator = SdkGenerator { process: &process, names: &name_pool, objects: &objects, offsets: &offsets, format };
+        generator.generate(&PathBuf::from(output_dir), &app_handle)
+    })
+    .await
+    .map_err(|e| e.to_string())??;
+
+    println!("[ Done ] {} packages, {} classes, {} structs, {} enums, {} functions -> {} files ({} bytes) in {:.0} ms", report.packages, report.classes, report.structs, report.enums, report.functions, report.files, report.bytes_written, report.elapsed_ms);
+    for failure in &report.failed {
+        println!("[ Failed ] {}", failure);
+    }
+    println!("=======================");
+    Ok(report)
+}
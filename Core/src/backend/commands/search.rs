@@ -1,6 +1,10 @@
 use crate::backend::commands::package::extract_package_name;
+use crate::backend::os::memory::{CachedMemory, PAGE_4K};
+use crate::backend::os::process::Process;
 use crate::backend::state::AppState;
-use std::sync::Arc;
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::{ObjectHandle, ObjectManager, ObjectView};
+use crate::backend::unreal::offsets::UEOffset;
 use tauri::State;
 
 #[derive(serde::Serialize)]
@@ -14,94 +18,36 @@ pub struct GlobalSearchResult {
 
 #[tauri::command]
 pub async fn global_search(state: State<'_, AppState>, query: String, search_mode: String) -> Result<Vec<GlobalSearchResult>, String> {
-    let query_lower = query.to_lowercase();
-
-    let offsets = {
-        let ac_lock = state.auto_config.lock().unwrap();
-        if let Some(ac) = ac_lock.as_ref() {
-            ac.offsets.clone()
-        } else {
-            crate::backend::unreal::offsets::UEOffset::default()
-        }
-    };
-
-    let obj_mgr = Arc::clone(&state.object_manager);
-    let process = state.process.lock().unwrap().clone().ok_or("No process attached")?;
-
-    let name_pool = {
-        let np_lock = state.name_pool.lock().map_err(|_| "Name pool lock failed")?;
-        np_lock.as_ref().ok_or("Name pool not valid")?.clone()
-    };
-
-    tauri::async_runtime::spawn_blocking(move || {
-        let mut results = Vec::new();
-        let limit = 500; // Limit results for performance
+    let offsets = state.offsets();
 
-        for entry in obj_mgr.cache_by_address.iter() {
-            if results.len() >= limit {
-                break;
-            }
-            let obj = entry.value();
+    let obj_mgr = state.objects();
+    let process = state.process.load_full().ok_or("No process attached")?;
 
-            let pkg_name = extract_package_name(&obj.full_name);
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not valid")?;
 
-            if search_mode == "Object" {
-                let t_lower = obj.type_name.to_lowercase();
-                let is_valid_type = t_lower.contains("class") || t_lower.contains("struct") || t_lower.contains("enum") || t_lower == "userenum" || t_lower.contains("function");
-
-                if is_valid_type && obj.name.to_lowercase().contains(&query_lower) {
-                    results.push(GlobalSearchResult { package_name: pkg_name, object_name: obj.name.clone(), type_name: obj.type_name.clone(), address: obj.address, member_name: None });
-                }
-            } else if search_mode == "Member" {
-                let type_lower = obj.type_name.to_lowercase();
-                if type_lower.contains("class") || type_lower.contains("struct") {
-                    let mut child_addr = process.memory.try_read_pointer(obj.address.wrapping_add(offsets.member)).unwrap_or(0);
-                    let mut safety = 0;
-                    while child_addr > 0x10000 && safety < 2000 {
-                        safety += 1;
-                        let child_name_id = process.memory.try_read::<i32>(child_addr.wrapping_add(offsets.member_fname_index)).unwrap_or(0);
-                        let child_name = name_pool.get_name(&process, child_name_id as u32).unwrap_or_default();
-
-                        if child_name.to_lowercase().contains(&query_lower) {
-                            results.push(GlobalSearchResult { package_name: pkg_name.clone(), object_name: obj.name.clone(), type_name: obj.type_name.clone(), address: obj.address, member_name: Some(child_name) });
-                            if results.len() >= limit {
-                                break;
-                            }
-                        }
-
-                        child_addr = process.memory.try_read_pointer(child_addr.wrapping_add(offsets.next_member)).unwrap_or(0);
-                    }
-                }
-            }
-        }
-
-        // Sort results: 1. Type (Class -> Struct -> Enum -> Function)  2. Object Name  3. Package Name
-        results.sort_by(|a, b| {
-            let order = |type_name: &str| -> u8 {
-                let t = type_name.to_lowercase();
-                if t.contains("class") {
-                    0
-                } else if t.contains("struct") {
-                    1
-                } else if t.contains("enum") || t == "userenum" {
-                    2
-                } else if t.contains("function") {
-                    3
-                } else {
-                    4
-                }
-            };
-
-            let priority_a = order(&a.type_name);
-            let priority_b = order(&b.type_name);
+    tauri::async_runtime::spawn_blocking(move || Ok(global_search_rows(&obj_mgr, &name_pool, &process, &offsets, &query, &search_mode))).await.map_err(|e| e.to_string())?
+}
 
-            priority_a.cmp(&priority_b).then_with(|| a.object_name.to_lowercase().cmp(&b.object_name.to_lowercase())).then_with(|| a.package_name.cmp(&b.package_name))
-        });
+/// The best 500 matches for `query`, in result order
+pub fn global_search_rows(obj_mgr: &ObjectManager, name_pool: &FNamePool, process: &Process, offsets: &UEOffset, query: &str, search_mode: &str) -> Vec<GlobalSearchResult> {
+    let limit = 500; // Limit results for performance
+
+    // Candidates are kept in result order (Class -> Struct -> Enum -> Function, then object name, then package),
+    // so the first `limit` matches are the answer
+    let index = obj_mgr.search_index(name_pool, process, offsets);
+    let hits = match search_mode {
+        "Object" => index.search_objects(query, limit),
+        "Member" => index.search_members(query, limit),
+        _ => Vec::new(),
+    };
 
-        Ok(results)
-    })
-    .await
-    .map_err(|e| e.to_string())?
+    hits.into_iter()
+        .filter_map(|hit| {
+            let obj = obj_mgr.view(hit.handle, name_pool)?;
+            let member_name = hit.member.map(|id| name_pool.name(process, id).unwrap_or_default().to_string());
+            Some(GlobalSearchResult { package_name: index.package(hit).to_string(), object_name: obj.name().to_string(), type_name: obj.type_name().to_string(), address: obj.address(), member_name })
+        })
+        .collect()
 }
 
 #[derive(serde::Serialize)]
@@ -110,6 +56,28 @@ pub struct InstanceSearchResult {
     pub object_name: String,
 }
 
+impl InstanceSearchResult {
+    pub fn of(obj: &ObjectView<'_>) -> Self {
+        Self { instance_address: format!("0x{:X}", obj.address()), object_name: obj.name().to_string() }
+    }
+}
+
+/// Instances of the class at `class_address` and of its subclasses, in handle order
+pub fn instance_handles(obj_mgr: &ObjectManager, name_pool: &FNamePool, class_address: usize) -> Vec<ObjectHandle> {
+    let Some(target) = obj_mgr.handle_of(class_address) else { return Vec::new() };
+
+    // Instances of the class and of everything inheriting from it are one posting range in the hierarchy index.
+    // If the user pasted an exact INSTANCE address, it is returned as well.
+    let mut handles: Vec<ObjectHandle> = obj_mgr.hierarchy().instances(target).to_vec();
+    handles.push(target);
+    handles.sort_unstable();
+    handles.dedup();
+
+    // We only care about objects that are actual instances (have a class_ptr), not classes themselves or properties
+    handles.retain(|&h| obj_mgr.view(h, name_pool).is_some_and(|obj| obj.class_ptr() > 0x10000));
+    handles
+}
+
 #[tauri::command]
 pub async fn search_object_instances(state: State<'_, AppState>, object_address: String) -> Result<Vec<InstanceSearchResult>, String> {
     let start_time = std::time::Instant::now();
@@ -118,53 +86,10 @@ pub async fn search_object_instances(state: State<'_, AppState>, object_address:
 
     println!("[search_object_instances] Searching for instances of class at address: 0x{:X}", target_class_address);
 
-    let obj_mgr = Arc::clone(&state.object_manager);
-    let proc_clone = {
-        let process_lock = state.process.lock().map_err(|_| "Lock failed")?;
-        process_lock.as_ref().ok_or("Process not attached")?.clone()
-    };
-
-    let results = tauri::async_runtime::spawn_blocking(move || {
-        let mut local_results = Vec::new();
-        // We only care about objects that are actual instances (have a class_ptr),
-        // not classes themselves or properties.
-        for entry in obj_mgr.cache_by_address.iter() {
-            let obj = entry.value();
+    let obj_mgr = state.objects();
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not valid")?;
 
-            // Fast fail: if it doesn't even have a class_ptr, it's not an instance
-            if obj.class_ptr <= 0x10000 {
-                continue;
-            }
-
-            let mut current_class_ptr = obj.class_ptr;
-            let mut safety = 0;
-            let mut is_match = false;
-
-            // If the user pasted an exact INSTANCE address, return it directly
-            if obj.address == target_class_address {
-                is_match = true;
-            } else {
-                // Otherwise, travel up the inheritance tree (SuperStruct) to see if it inherits from target_class_address
-                while current_class_ptr > 0x10000 && safety < 50 {
-                    if current_class_ptr == target_class_address {
-                        is_match = true;
-                        break;
-                    }
-
-                    // Read SuperStruct pointer (offset 0x40 in UE)
-                    current_class_ptr = proc_clone.memory.try_read_pointer(current_class_ptr.wrapping_add(0x40)).unwrap_or(0);
-                    safety += 1;
-                }
-            }
-
-            if is_match {
-                local_results.push(InstanceSearchResult { instance_address: format!("0x{:X}", obj.address), object_name: obj.name.clone() });
-            }
-        }
-        local_results
-    })
-    .await
-    .map_err(|e| format!("Task failed: {}", e))?;
+    let results = tauri::async_runtime::spawn_blocking(move || instance_handles(&obj_mgr, &name_pool, target_class_address).into_iter().filter_map(|h| obj_mgr.view(h, &name_pool)).map(|obj| InstanceSearchResult::of(&obj)).collect::<Vec<_>>()).await.map_err(|e| format!("Task failed: {}", e))?;
 
     println!("[search_object_instances] Found {} instances in {:?}", results.len(), start_time.elapsed());
     Ok(results)
@@ -179,79 +104,69 @@ pub async fn search_object_references(state: State<'_, AppState>, address_str: S
         return Err("Invalid or empty address provided".to_string());
     }
 
-    let obj_mgr = Arc::clone(&state.object_manager);
-    let process = state.process.lock().unwrap().clone().ok_or("No process attached")?;
+    let obj_mgr = state.objects();
+    let process = state.process.load_full().ok_or("No process attached")?;
 
-    let offsets = {
-        let ac_lock = state.auto_config.lock().unwrap();
-        if let Some(ac) = ac_lock.as_ref() {
-            ac.offsets.clone()
-        } else {
-            crate::backend::unreal::offsets::UEOffset::default()
-        }
-    };
+    let offsets = state.offsets();
+
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not valid")?;
 
     tauri::async_runtime::spawn_blocking(move || {
+        if search_mode == "Pointer" {
+            return Ok(pointer_referrers(&obj_mgr, &process, &name_pool, &offsets, target_address));
+        }
+
         let mut results = Vec::new();
         let limit = 500; // Limit results for performance
+                         // Member walks revisit the same few pages of class metadata over and over
+        let mem = CachedMemory::new(&process.memory, PAGE_4K);
+        let inheritance = obj_mgr.handle_of(target_address).filter(|_| search_mode == "Inheritance").map(|target| (obj_mgr.hierarchy(), target));
 
-        for entry in obj_mgr.cache_by_address.iter() {
+        for obj in obj_mgr.iter(&name_pool) {
             if results.len() >= limit {
                 break;
             }
-            let obj = entry.value();
 
             let mut matches = false;
             let matched_member_name: Option<String> = None;
 
             if search_mode == "Inheritance" {
                 // Check if this object is an instance of the target class/struct
-                if obj.class_ptr == target_address {
+                if obj.class_ptr() == target_address {
                     matches = true;
-                } else {
+                } else if let Some((hierarchy, target)) = &inheritance {
                     // Check if this object structurally inherits from the target (subclasses)
-                    let type_lower = obj.type_name.to_lowercase();
-                    if type_lower.contains("class") || type_lower.contains("struct") {
-                        let mut super_addr = process.memory.try_read_pointer(obj.address.wrapping_add(offsets.super_struct)).unwrap_or(0);
-                        let mut safety = 0;
-                        while super_addr > 0x10000 && safety < 20 {
-                            safety += 1;
-                            if super_addr == target_address {
-                                matches = true;
-                                break;
-                            }
-                            super_addr = process.memory.try_read_pointer(super_addr.wrapping_add(offsets.super_struct)).unwrap_or(0);
-                        }
-                    }
+                    let type_lower = obj.type_name().to_lowercase();
+                    matches = (type_lower.contains("class") || type_lower.contains("struct")) && obj.handle() != *target && hierarchy.is_subclass_of(obj.handle(), *target);
                 }
             } else if search_mode == "Member" {
                 // The user wants to find objects that *contain* a property/member of the target type.
                 // We iterate over all classes/structs and check their properties' sub-types.
-                let type_lower = obj.type_name.to_lowercase();
+                let type_lower = obj.type_name().to_lowercase();
                 if type_lower.contains("class") || type_lower.contains("struct") {
-                    let mut child_addr = process.memory.try_read_pointer(obj.address.wrapping_add(offsets.member)).unwrap_or(0);
+                    let mut child_addr = mem.try_read_pointer(obj.address().wrapping_add(offsets.member)).unwrap_or(0);
                     let mut safety = 0;
                     while child_addr > 0x10000 && safety < 2000 {
                         safety += 1;
 
                         // Check if this property points to our target_address
-                        let prop_0 = process.memory.try_read_pointer(child_addr.wrapping_add(offsets.property)).unwrap_or(0);
-                        let prop_8 = process.memory.try_read_pointer(child_addr.wrapping_add(offsets.property + 8)).unwrap_or(0);
-                        let type_obj = process.memory.try_read_pointer(child_addr.wrapping_add(offsets.type_object)).unwrap_or(0);
+                        let prop_0 = mem.try_read_pointer(child_addr.wrapping_add(offsets.property)).unwrap_or(0);
+                        let prop_8 = mem.try_read_pointer(child_addr.wrapping_add(offsets.property + 8)).unwrap_or(0);
+                        let type_obj = mem.try_read_pointer(child_addr.wrapping_add(offsets.type_object)).unwrap_or(0);
 
                         if prop_0 == target_address || prop_8 == target_address || type_obj == target_address {
                             matches = true;
                             break;
                         }
 
-                        child_addr = process.memory.try_read_pointer(child_addr.wrapping_add(offsets.next_member)).unwrap_or(0);
+                        child_addr = mem.try_read_pointer(child_addr.wrapping_add(offsets.next_member)).unwrap_or(0);
                     }
                 }
             }
 
             if matches {
-                let pkg_name = extract_package_name(&obj.full_name);
-                results.push(GlobalSearchResult { package_name: pkg_name, object_name: obj.name.clone(), type_name: obj.type_name.clone(), address: obj.address, member_name: matched_member_name });
+                let pkg_name = extract_package_name(&obj.full_name());
+                results.push(GlobalSearchResult { package_name: pkg_name, object_name: obj.name().to_string(), type_name: obj.type_name().to_string(), address: obj.address(), member_name: matched_member_name });
             }
         }
 
@@ -284,16 +199,52 @@ pub async fn search_object_references(state: State<'_, AppState>, address_str: S
     .map_err(|e| e.to_string())?
 }
 
+/// Live objects holding a pointer to `target_address`, from the reference index (built on the first query)
+fn pointer_referrers(obj_mgr: &ObjectManager, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, target_address: usize) -> Vec<GlobalSearchResult> {
+    let Some(target) = obj_mgr.handle_of(target_address) else { return Vec::new() };
+    let index = obj_mgr.ref_index(name_pool, process, offsets);
+    index
+        .referrers(target)
+        .iter()
+        .filter_map(|reference| {
+            let obj = obj_mgr.view(reference.referrer, name_pool)?;
+            // Name the member when the pointer sits directly in the referrer's class (not inside an inline struct)
+            let member = obj.class().and_then(|class| obj_mgr.class_layout(class.address(), process, name_pool, offsets).members().find(|m| m.is_property && m.offset == reference.offset as usize).map(|m| m.name.clone()));
+            let label = match member {
+                Some(name) => format!("{} (+0x{:X})", name, reference.offset),
+                None => format!("+0x{:X}", reference.offset),
+            };
+            Some(GlobalSearchResult { package_name: extract_package_name(&obj.full_name()), object_name: obj.name().to_string(), type_name: obj.type_name().to_string(), address: obj.address(), member_name: Some(label) })
+        })
+        .collect()
+}
+
+/// Re-read the pointers of the given objects into the reference index, e.g. after they were watched changing
+#[tauri::command]
+pub async fn refresh_object_references(state: State<'_, AppState>, addresses: Vec<usize>) -> Result<usize, String> {
+    let obj_mgr = state.objects();
+    let process = state.process.load_full().ok_or("No process attached")?;
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not valid")?;
+    let offsets = state.offsets();
+
+    tauri::async_runtime::spawn_blocking(move || {
+        let handles: Vec<ObjectHandle> = addresses.iter().filter_map(|&a| obj_mgr.handle_of(a)).collect();
+        obj_mgr.refresh_references(&handles, &name_pool, &process, &offsets).len()
+    })
+    .await
+    .map_err(|e| e.to_string())
+}
+
 #[tauri::command]
 pub async fn get_object_address_by_id(state: State<'_, AppState>, object_id: String) -> Result<Option<String>, String> {
     let id_num = object_id.parse::<i32>().map_err(|_| "Invalid object ID format")?;
 
-    let obj_mgr = &state.object_manager;
-    println!("[get_object_address_by_id] Querying ID: {}. Cache size: {}", id_num, obj_mgr.cache_by_id.len());
+    let obj_mgr = &state.objects();
+    println!("[get_object_address_by_id] Querying ID: {}. Cache size: {}", id_num, obj_mgr.id_count());
 
-    if let Some(addr_ref) = obj_mgr.cache_by_id.get(&id_num) {
-        println!("[get_object_address_by_id] Found ID {} -> Address 0x{:X}", id_num, *addr_ref);
-        return Ok(Some(format!("0x{:X}", *addr_ref)));
+    if let Some(addr) = obj_mgr.address_by_id(id_num) {
+        println!("[get_object_address_by_id] Found ID {} -> Address 0x{:X}", id_num, addr);
+        return Ok(Some(format!("0x{:X}", addr)));
     } else {
         println!("[get_object_address_by_id] ID {} NOT FOUND in cache_by_id!", id_num);
     }
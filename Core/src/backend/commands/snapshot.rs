@@ -0,0 +1,56 @@
+use crate::backend::os::process::Process;
+use crate::backend::state::{AppState, BaseAddresses};
+use crate::backend::unreal::autoconfig::{AutoConfig, OffsetSource};
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::ObjectManager;
+use crate::backend::unreal::snapshot::{Snapshot, SnapshotMeta};
+use std::path::PathBuf;
+use std::sync::Arc;
+use tauri::State;
+
+/// Write the attached process's parsed dump to `path`
+#[tauri::command]
+pub async fn save_snapshot(state: State<'_, AppState>, path: String) -> Result<SnapshotMeta, String> {
+    let process = state.process.load_full().ok_or("No process attached")?;
+    if process.memory.is_read_only() {
+        return Err("A snapshot is loaded; attach to a live process to take a new one".to_string());
+    }
+    let name_pool = state.name_pool.load_full().ok_or("Name pool not valid")?;
+    let obj_mgr = state.objects();
+    if obj_mgr.len() == 0 {
+        return Err("GUObjectArray has not been parsed yet".to_string());
+    }
+    let ba = state.base_addresses.load_full();
+    let (guobject, gworld) = ((ba.guobject_array, ba.guobject_element_size), ba.gworld);
+    let offsets = state.offsets();
+
+    tauri::async_runtime::spawn_blocking(move || Snapshot::save(&PathBuf::from(path), &process, &name_pool, &obj_mgr, &offsets, guobject, gworld)).await.map_err(|e| e.to_string())?
+}
+
+/// Replace the attached process with a snapshot. Every read command then works against the file; writes are refused.
+#[tauri::command]
+pub async fn load_snapshot(state: State<'_, AppState>, path: String) -> Result<String, String> {
+    let snapshot = tauri::async_runtime::spawn_blocking(move || Snapshot::open(&PathBuf::from(path))).await.map_err(|e| e.to_string())??;
+    let meta = snapshot.meta.clone();
+
+    let process = Process { pid: 0, name: format!("{} (snapshot)", meta.process_name), exe_path: meta.exe_path.clone(), memory: snapshot.memory(), main_module_base: meta.main_module_base, main_module_size: meta.main_module_size };
+
+    // Imported into a table of its own: a failed import leaves the attached process and its objects untouched
+    let obj_mgr = tauri::async_runtime::spawn_blocking(move || {
+        let obj_mgr = ObjectManager::new();
+        obj_mgr.import_rows(snapshot.rows()).map(|_| obj_mgr)
+    })
+    .await
+    .map_err(|e| e.to_string())??;
+
+    let label = format!("{} ({} objects, {} pages)", process.name, meta.object_count, meta.page_count);
+    state.process.store(Some(Arc::new(process)));
+    state.object_manager.store(Arc::new(obj_mgr));
+    state.cursors.clear();
+    state.name_pool.store(Some(Arc::new(FNamePool::new(meta.fname_pool))));
+    state.base_addresses.store(Arc::new(BaseAddresses { fname_pool: Some(meta.fname_pool), guobject_array: meta.guobject_array, guobject_element_size: meta.guobject_element_size, gworld: meta.gworld }));
+    state.auto_config.store(Some(Arc::new(AutoConfig { offsets: meta.offsets, source: OffsetSource::Snapshot })));
+
+    println!("[ Snapshot ] Loaded {}", label);
+    Ok(label)
+}
@@ -0,0 +1,393 @@
+use crate::backend::state::AppState;
+use arc_swap::ArcSwap;
+use serde::{Deserialize, Serialize};
+use std::collections::HashMap;
+use std::sync::atomic::{fence, AtomicBool, AtomicU32, AtomicU64, Ordering};
+use std::sync::Arc;
+use std::time::{Duration, Instant};
+use tauri::{AppHandle, Manager, State};
+
+// ═══════════════════════════════════════════════════════════════
+//  Watchers — background sampling of individual values
+//  A dedicated thread reads every registered (address, type) at a fixed rate,
+//  coalescing neighbouring addresses into one read like ReadPlan does, and
+//  appends (time, raw value) to a fixed-size ring per watch. The ring has a
+//  single writer and lock-free readers: a reader copies the samples it wants
+//  and drops any the writer may have lapped meanwhile. The UI fetches
+//  decimated, delta-timed windows instead of polling single values.
+// ═══════════════════════════════════════════════════════════════
+
+/// Samples kept per watch: 8 s at 1 kHz
+const RING_CAPACITY: usize = 8192;
+const DEFAULT_RATE_HZ: u32 = 100;
+const MAX_RATE_HZ: u32 = 5000;
+/// Neighbouring watches closer than this share one read
+const WATCH_MAX_GAP: usize = 0x100;
+const WATCH_MAX_RANGE: usize = 0x1000;
+/// Ticks closer than this are waited for by spinning; sleep granularity is about a millisecond on Windows.
+/// The spin never covers more than SPIN_SHARE of a period, so fast rates oversleep now and then instead of holding a core.
+const SPIN_BELOW: Duration = Duration::from_micros(1500);
+const SPIN_SHARE: u32 = 4;
+const DEFAULT_MAX_POINTS: usize = 512;
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq, Serialize, Deserialize)]
+#[serde(rename_all = "lowercase")]
+pub enum WatchType {
+    Bool,
+    I8,
+    U8,
+    I16,
+    U16,
+    I32,
+    U32,
+    I64,
+    U64,
+    F32,
+    F64,
+}
+
+impl WatchType {
+    fn size(self) -> usize {
+        match self {
+            Self::Bool | Self::I8 | Self::U8 => 1,
+            Self::I16 | Self::U16 => 2,
+            Self::I32 | Self::U32 | Self::F32 => 4,
+            Self::I64 | Self::U64 | Self::F64 => 8,
+        }
+    }
+
+    /// `raw` holds the little-endian value in its low bytes
+    fn value(self, raw: u64) -> f64 {
+        match self {
+            Self::Bool => (raw as u8 != 0) as u8 as f64,
+            Self::I8 => raw as u8 as i8 as f64,
+            Self::U8 => raw as u8 as f64,
+            Self::I16 => raw as u16 as i16 as f64,
+            Self::U16 => raw as u16 as f64,
+            Self::I32 => raw as u32 as i32 as f64,
+            Self::U32 => raw as u32 as f64,
+            Self::I64 => raw as i64 as f64,
+            Self::U64 => raw as f64,
+            Self::F32 => f32::from_bits(raw as u32) as f64,
+            Self::F64 => f64::from_bits(raw),
+        }
+    }
+}
+
+// ─── Ring ────────────────────────────────────────────────────────
+
+/// Fixed-size sample ring: one writer (the sampler), any number of lock-free readers
+struct Ring {
+    times: Box<[AtomicU64]>,
+    values: Box<[AtomicU64]>,
+    /// Samples ever pushed; sample `seq` lives in slot `seq % capacity` until seq + capacity is pushed
+    head: AtomicU64,
+}
+
+impl Ring {
+    fn new(capacity: usize) -> Self {
+        Self { times: (0..capacity).map(|_| AtomicU64::new(0)).collect(), values: (0..capacity).map(|_| AtomicU64::new(0)).collect(), head: AtomicU64::new(0) }
+    }
+
+    fn capacity(&self) -> u64 {
+        self.times.len() as u64
+    }
+
+    fn push(&self, time_us: u64, raw: u64) {
+        let head = self.head.load(Ordering::Relaxed);
+        let slot = (head % self.capacity()) as usize;
+        // Pairs with the reader's Acquire fence: a reader that sees any of these slot stores also sees the previous head,
+        // which is what its lapped check counts from
+        fence(Ordering::Release);
+        self.times[slot].store(time_us, Ordering::Relaxed);
+        self.values[slot].store(raw, Ordering::Relaxed);
+        self.head.store(head + 1, Ordering::Release);
+    }
+
+    /// Append the samples from `since` on (oldest still held, at the earliest) to `out`; returns the sequence of the first one
+    fn read(&self, since: u64, out: &mut Vec<(u64, u64)>) -> u64 {
+        let head = self.head.load(Ordering::Acquire);
+        let first = since.max(head.saturating_sub(self.capacity()));
+        let start = out.len();
+        for seq in first..head {
+            let slot = (seq % self.capacity()) as usize;
+            out.push((self.times[slot].load(Ordering::Relaxed), self.values[slot].load(Ordering::Relaxed)));
+        }
+        // The slots of everything older than (new head + 1 - capacity) may have been rewritten while we copied
+        fence(Ordering::Acquire);
+        let reused_below = (self.head.load(Ordering::Relaxed) + 1).saturating_sub(self.capacity());
+        let lapped = (reused_below.saturating_sub(first) as usize).min(out.len() - start);
+        out.drain(start..start + lapped);
+        first + lapped as u64
+    }
+}
+
+// ─── Registry ────────────────────────────────────────────────────
+
+struct Watch {
+    id: u32,
+    address: usize,
+    value_type: WatchType,
+    label: String,
+    ring: Ring,
+    /// Ticks on which the value could not be read (nothing is pushed for them)
+    failures: AtomicU64,
+}
+
+/// Watches sorted by address, with the coalesced ranges one tick reads
+#[derive(Default)]
+struct WatchSet {
+    watches: Vec<Arc<Watch>>,
+    /// (start, len, watches[first..last])
+    ranges: Vec<(usize, usize, usize, usize)>,
+}
+
+impl WatchSet {
+    fn new(mut watches: Vec<Arc<Watch>>) -> Self {
+        watches.sort_by_key(|w| w.address);
+        let mut ranges: Vec<(usize, usize, usize, usize)> = Vec::new();
+        for (i, w) in watches.iter().enumerate() {
+            let end = w.address + w.value_type.size();
+            match ranges.last_mut() {
+                Some((start, len, _, last)) if w.address <= *start + *len + WATCH_MAX_GAP && end - *start <= WATCH_MAX_RANGE => {
+                    *len = (*len).max(end - *start);
+                    *last = i + 1;
+                }
+                _ => ranges.push((w.address, w.value_type.size(), i, i + 1)),
+            }
+        }
+        Self { watches, ranges }
+    }
+}
+
+pub struct Watchers {
+    set: ArcSwap<WatchSet>,
+    rate_hz: AtomicU32,
+    running: AtomicBool,
+    next_id: AtomicU32,
+    /// Sample times are microseconds since this
+    epoch: Instant,
+    ticks: AtomicU64,
+    /// Ticks that started later than one period after they were due
+    overruns: AtomicU64,
+}
+
+impl Watchers {
+    pub fn new() -> Self {
+        Self { set: ArcSwap::from_pointee(WatchSet::default()), rate_hz: AtomicU32::new(DEFAULT_RATE_HZ), running: AtomicBool::new(false), next_id: AtomicU32::new(1), epoch: Instant::now(), ticks: AtomicU64::new(0), overruns: AtomicU64::new(0) }
+    }
+
+    fn add(&self, address: usize, value_type: WatchType, label: String) -> u32 {
+        let id = self.next_id.fetch_add(1, Ordering::Relaxed);
+        let watch = Arc::new(Watch { id, address, value_type, label, ring: Ring::new(RING_CAPACITY), failures: AtomicU64::new(0) });
+        self.set.rcu(|current| {
+            let mut watches = current.watches.clone();
+            watches.push(Arc::clone(&watch));
+            WatchSet::new(watches)
+        });
+        id
+    }
+
+    fn remove(&self, ids: &[u32]) {
+        self.set.rcu(|current| WatchSet::new(current.watches.iter().filter(|w| !ids.contains(&w.id)).cloned().collect()));
+    }
+
+    /// Start the sampler thread unless it is running; it exits by itself once no watch is left
+    fn ensure_sampler(app: &AppHandle) {
+        let state = app.state::<AppState>();
+        if state.watchers.running.swap(true, Ordering::AcqRel) {
+            return;
+        }
+        let app = app.clone();
+        std::thread::Builder::new().name("watch-sampler".into()).spawn(move || Self::run_sampler(app)).ok();
+    }
+
+    fn run_sampler(app: AppHandle) {
+        let state = app.state::<AppState>();
+        let watchers = &state.watchers;
+        let mut due = Instant::now();
+
+        loop {
+            let set = watchers.set.load_full();
+            if set.watches.is_empty() {
+                watchers.running.store(false, Ordering::Release);
+                // A watch added between the check and the store found the sampler running; take it back
+                if watchers.set.load().watches.is_empty() || watchers.running.swap(true, Ordering::AcqRel) {
+                    return;
+                }
+                continue;
+            }
+
+            if let Some(process) = state.process.load_full() {
+                let now = watchers.epoch.elapsed().as_micros() as u64;
+                for &(start, len, first, last) in &set.ranges {
+                    let members = &set.watches[first..last];
+                    let bulk = process.memory.read_with(start, len, |data| {
+                        if data.len() < len {
+                            return false;
+                        }
+                        for w in members {
+                            let mut raw = [0u8; 8];
+                            let offset = w.address - start;
+                            raw[..w.value_type.size()].copy_from_slice(&data[offset..offset + w.value_type.size()]);
+                            w.ring.push(now, u64::from_le_bytes(raw));
+                        }
+                        true
+                    });
+                    if bulk != Some(true) {
+                        // The range spans an unreadable page: read each watch on its own
+                        for w in members {
+                            let mut raw = [0u8; 8];
+                            if process.memory.read_into(w.address, &mut raw[..w.value_type.size()]) {
+                                w.ring.push(now, u64::from_le_bytes(raw));
+                            } else {
+                                w.failures.fetch_add(1, Ordering::Relaxed);
+                            }
+                        }
+                    }
+                }
+                watchers.ticks.fetch_add(1, Ordering::Relaxed);
+            }
+
+            // Fixed-rate schedule: a late tick is not made up for, the next one is simply due a period later
+            let period = Duration::from_secs_f64(1.0 / watchers.rate_hz.load(Ordering::Relaxed) as f64);
+            due += period;
+            let now = Instant::now();
+            if due < now {
+                watchers.overruns.fetch_add(1, Ordering::Relaxed);
+                due = now;
+                continue;
+            }
+            let wait = due - now;
+            let spin = SPIN_BELOW.min(period / SPIN_SHARE);
+            if wait > spin {
+                std::thread::sleep(wait - spin);
+            }
+            while Instant::now() < due {
+                std::hint::spin_loop();
+            }
+        }
+    }
+}
+
+// ─── Series ──────────────────────────────────────────────────────
+
+#[derive(Serialize)]
+pub struct WatchInfo {
+    pub id: u32,
+    pub address: usize,
+    pub value_type: WatchType,
+    pub label: String,
+    pub samples: u64,
+    pub failures: u64,
+}
+
+#[derive(Serialize)]
+pub struct WatchSamplerStats {
+    pub running: bool,
+    pub rate_hz: u32,
+    pub ticks: u64,
+    pub overruns: u64,
+}
+
+/// One watch's window: times as deltas from `t0_us`, thinned to min/max pairs when it held more than the requested points
+#[derive(Serialize)]
+pub struct WatchSeries {
+    pub id: u32,
+    /// Pass back as this watch's `since` to get only newer samples
+    pub next: u64,
+    /// Samples after `since` that were overwritten before this read
+    pub dropped: u64,
+    /// Samples the window covered before thinning
+    pub covered: usize,
+    pub t0_us: u64,
+    pub dt_us: Vec<u64>,
+    pub values: Vec<f64>,
+    pub min: f64,
+    pub max: f64,
+}
+
+/// Keep the min and max of each bucket (in time order), which preserves the envelope a line chart draws
+fn thin(samples: &[(u64, f64)], max_points: usize) -> Vec<(u64, f64)> {
+    if samples.len() <= max_points {
+        return samples.to_vec();
+    }
+    let buckets = (max_points / 2).max(1);
+    let bucket = samples.len().div_ceil(buckets);
+    let mut out = Vec::with_capacity(buckets * 2);
+    for chunk in samples.chunks(bucket) {
+        let lo = chunk.iter().enumerate().min_by(|a, b| a.1 .1.total_cmp(&b.1 .1)).map(|(i, _)| i).unwrap_or(0);
+        let hi = chunk.iter().enumerate().max_by(|a, b| a.1 .1.total_cmp(&b.1 .1)).map(|(i, _)| i).unwrap_or(0);
+        out.push(chunk[lo.min(hi)]);
+        if lo != hi {
+            out.push(chunk[lo.max(hi)]);
+        }
+    }
+    out
+}
+
+fn series(watch: &Watch, since: u64, max_points: usize, raw: &mut Vec<(u64, u64)>) -> WatchSeries {
+    raw.clear();
+    let first = watch.ring.read(since, raw);
+    let samples: Vec<(u64, f64)> = raw.iter().map(|&(t, v)| (t, watch.value_type.value(v))).collect();
+    let points = thin(&samples, max_points.max(2));
+    let t0_us = points.first().map_or(0, |p| p.0);
+    let (min, max) = samples.iter().fold((f64::INFINITY, f64::NEG_INFINITY), |(lo, hi), s| (lo.min(s.1), hi.max(s.1)));
+    WatchSeries {
+        id: watch.id,
+        next: first + samples.len() as u64,
+        dropped: first.saturating_sub(since),
+        covered: samples.len(),
+        t0_us,
+        dt_us: points.iter().map(|p| p.0 - t0_us).collect(),
+        values: points.iter().map(|p| p.1).collect(),
+        min: if samples.is_empty() { 0.0 } else { min },
+        max: if samples.is_empty() { 0.0 } else { max },
+    }
+}
+
+// ─── Commands ────────────────────────────────────────────────────
+
+fn parse_address(address: &str) -> Result<usize, String> {
+    let clean = address.trim().to_lowercase();
+    usize::from_str_radix(clean.trim_start_matches("0x"), 16).ok().filter(|&a| a > 0x10000).ok_or_else(|| format!("Invalid address '{}'", address))
+}
+
+/// Register a value to sample in the background; returns its watch id
+#[tauri::command]
+pub fn add_watch(app: AppHandle, state: State<'_, AppState>, address: String, value_type: WatchType, label: Option<String>) -> Result<u32, String> {
+    let address = parse_address(&address)?;
+    let id = state.watchers.add(address, value_type, label.unwrap_or_else(|| format!("0x{:X}", address)));
+    Watchers::ensure_sampler(&app);
+    Ok(id)
+}
+
+#[tauri::command]
+pub fn remove_watches(state: State<'_, AppState>, ids: Vec<u32>) {
+    state.watchers.remove(&ids);
+}
+
+#[tauri::command]
+pub fn list_watches(state: State<'_, AppState>) -> Vec<WatchInfo> {
+    let set = state.watchers.set.load();
+    let mut watches: Vec<WatchInfo> = set.watches.iter().map(|w| WatchInfo { id: w.id, address: w.address, value_type: w.value_type, label: w.label.clone(), samples: w.ring.head.load(Ordering::Acquire), failures: w.failures.load(Ordering::Relaxed) }).collect();
+    watches.sort_by_key(|w| w.id);
+    watches
+}
+
+/// Sample rate for every watch, clamped to 1 Hz ..= 5 kHz
+#[tauri::command]
+pub fn set_watch_rate(state: State<'_, AppState>, rate_hz: u32) -> WatchSamplerStats {
+    let watchers = &state.watchers;
+    watchers.rate_hz.store(rate_hz.clamp(1, MAX_RATE_HZ), Ordering::Relaxed);
+    WatchSamplerStats { running: watchers.running.load(Ordering::Relaxed), rate_hz: watchers.rate_hz.load(Ordering::Relaxed), ticks: watchers.ticks.load(Ordering::Relaxed), overruns: watchers.overruns.load(Ordering::Relaxed) }
+}
+
+/// Windows of every watch (or of `ids`), each starting after its `since` cursor and thinned to `max_points`
+#[tauri::command]
+pub fn get_watch_series(state: State<'_, AppState>, ids: Option<Vec<u32>>, since: Option<HashMap<u32, u64>>, max_points: Option<usize>) -> Vec<WatchSeries> {
+    let set = state.watchers.set.load();
+    let since = since.unwrap_or_default();
+    let mut raw = Vec::with_capacity(RING_CAPACITY);
+    set.watches.iter().filter(|w| ids.as_ref().map_or(true, |ids| ids.contains(&w.id))).map(|w| series(w, since.get(&w.id).copied().unwrap_or(0), max_points.unwrap_or(DEFAULT_MAX_POINTS), &mut raw)).collect()
+}
@@ -0,0 +1,140 @@
+use std::ffi::c_void;
+use std::path::Path;
+use std::sync::Arc;
+use windows::core::PCWSTR;
+use windows::Win32::Foundation::{CloseHandle, HANDLE};
+use windows::Win32::System::Memory::{CreateFileMappingW, MapViewOfFile, UnmapViewOfFile, FILE_MAP_READ, MEMORY_MAPPED_VIEW_ADDRESS, PAGE_READONLY};
+
+/// Granularity of a captured memory image
+pub const IMAGE_PAGE_SIZE: usize = 0x1000;
+
+// ═══════════════════════════════════════════════════════════════
+//  MappedFile — a whole file mapped read-only into our address space
+// ═══════════════════════════════════════════════════════════════
+
+pub struct MappedFile {
+    mapping: HANDLE,
+    view: MEMORY_MAPPED_VIEW_ADDRESS,
+    len: usize,
+}
+
+// The view is never written through and lives until Drop
+unsafe impl Send for MappedFile {}
+unsafe impl Sync for MappedFile {}
+
+impl MappedFile {
+    pub fn open(path: &Path) -> Result<Self, String> {
+        use std::os::windows::io::AsRawHandle;
+
+        let file = std::fs::File::open(path).map_err(|e| format!("Failed to open {}: {}", path.display(), e))?;
+        let len = file.metadata().map_err(|e| e.to_string())?.len() as usize;
+        if len == 0 {
+            return Err(format!("{} is empty", path.display()));
+        }
+
+        unsafe {
+            // The mapping keeps its own reference to the file, so `file` can be closed once it exists
+            let mapping = CreateFileMappingW(HANDLE(file.as_raw_handle() as *mut c_void), None, PAGE_READONLY, 0, 0, PCWSTR(std::ptr::null())).map_err(|e| format!("CreateFileMapping failed: {}", e))?;
+            let view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if view.Value.is_null() {
+                let _ = CloseHandle(mapping);
+                return Err(format!("MapViewOfFile failed for {}", path.display()));
+            }
+            Ok(Self { mapping, view, len })
+        }
+    }
+
+    pub fn bytes(&self) -> &[u8] {
+        unsafe { std::slice::from_raw_parts(self.view.Value as *const u8, self.len) }
+    }
+}
+
+impl Drop for MappedFile {
+    fn drop(&mut self) {
+        unsafe {
+            let _ = UnmapViewOfFile(self.view);
+            let _ = CloseHandle(self.mapping);
+        }
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════
+//  MemoryImage — captured process pages, read in place from a mapped file
+//  `table` is a sorted array of little-endian u64 page addresses; page i is stored at
+//  data + i * IMAGE_PAGE_SIZE. Lookups are a binary search over the mapped table.
+// ═══════════════════════════════════════════════════════════════
+
+pub struct MemoryImage {
+    file: Arc<MappedFile>,
+    table: usize,
+    pages: usize,
+    data: usize,
+}
+
+impl std::fmt::Debug for MemoryImage {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("MemoryImage").field("pages", &self.pages).finish()
+    }
+}
+
+impl MemoryImage {
+    /// `table` and `data` are byte offsets into `file`
+    pub fn new(file: Arc<MappedFile>, table: usize, pages: usize, data: usize) -> Result<Self, String> {
+        let len = file.bytes().len();
+        if table.checked_add(pages * 8).map_or(true, |end| end > len) || data.checked_add(pages * IMAGE_PAGE_SIZE).map_or(true, |end| end > len) {
+            return Err("Memory image sections run past the end of the file".to_string());
+        }
+        Ok(Self { file, table, pages, data })
+    }
+
+    pub fn page_count(&self) -> usize {
+        self.pages
+    }
+
+    #[inline]
+    fn page_at(&self, i: usize) -> usize {
+        let at = self.table + i * 8;
+        u64::from_le_bytes(self.file.bytes()[at..at + 8].try_into().unwrap()) as usize
+    }
+
+    fn find(&self, page: usize) -> Option<usize> {
+        let (mut lo, mut hi) = (0, self.pages);
+        while lo < hi {
+            let mid = (lo + hi) / 2;
+            match self.page_at(mid).cmp(&page) {
+                std::cmp::Ordering::Less => lo = mid + 1,
+                std::cmp::Ordering::Greater => hi = mid,
+                std::cmp::Ordering::Equal => return Some(mid),
+            }
+        }
+        None
+    }
+
+    /// Fill `out` from the image; false if any byte of the range was not captured
+    pub fn read(&self, address: usize, out: &mut [u8]) -> bool {
+        let bytes = self.file.bytes();
+        let mut done = 0;
+        while done < out.len() {
+            let current = address.wrapping_add(done);
+            let page = current & !(IMAGE_PAGE_SIZE - 1);
+            let Some(i) = self.find(page) else { return false };
+            let offset = current - page;
+            let n = (IMAGE_PAGE_SIZE - offset).min(out.len() - done);
+            let at = self.data + i * IMAGE_PAGE_SIZE + offset;
+            out[done..done + n].copy_from_slice(&bytes[at..at + n]);
+            done += n;
+        }
+        true
+    }
+
+    /// VirtualQueryEx-style region size: from the page holding `address` to the end of its run of captured pages
+    pub fn region_size(&self, address: usize) -> Option<usize> {
+        let page = address & !(IMAGE_PAGE_SIZE - 1);
+        let first = self.find(page)?;
+        let mut last = first;
+        while last + 1 < self.pages && self.page_at(last + 1) == self.page_at(last) + IMAGE_PAGE_SIZE {
+            last += 1;
+        }
+        Some((last - first + 1) * IMAGE_PAGE_SIZE)
+    }
+}
@@ -1,11 +1,30 @@
+use crate::backend::os::image::MemoryImage;
+use crate::backend::os::profile::{LookupCounters, Op, IO};
+use std::cell::RefCell;
+use std::collections::HashMap;
 use std::ffi::c_void;
+use std::mem::MaybeUninit;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Arc, Mutex, MutexGuard, TryLockError};
+use std::time::Instant;
 use windows::Win32::Foundation::{CloseHandle, DuplicateHandle, DUPLICATE_SAME_ACCESS, HANDLE};
 use windows::Win32::System::Diagnostics::Debug::{ReadProcessMemory, WriteProcessMemory};
 use windows::Win32::System::Threading::GetCurrentProcess;
 
+/// Granularity at which write_batch shares protection changes
+const WRITE_PAGE_SIZE: usize = 0x1000;
+/// Scratch buffers larger than this are released after use instead of kept for the thread's next read
+const SCRATCH_KEEP: usize = 4 * 1024 * 1024;
+
+thread_local! {
+    static SCRATCH: RefCell<Vec<u8>> = const { RefCell::new(Vec::new()) };
+}
+
 #[derive(Debug)]
 pub struct Memory {
     handle: HANDLE,
+    /// Set for a loaded snapshot: reads come from the captured pages and writes are refused
+    image: Option<Arc<MemoryImage>>,
 }
 
 // Win32 process handles used for memory reading are thread-safe and can be shared across threads.
@@ -14,18 +33,30 @@ unsafe impl Sync for Memory {}
 
 impl Clone for Memory {
     fn clone(&self) -> Self {
+        if let Some(image) = &self.image {
+            return Memory { handle: HANDLE(std::ptr::null_mut()), image: Some(Arc::clone(image)) };
+        }
         let mut new_handle = HANDLE::default();
         unsafe {
             let current_process = GetCurrentProcess();
             let _ = DuplicateHandle(current_process, self.handle, current_process, &mut new_handle, 0, false, DUPLICATE_SAME_ACCESS);
         }
-        Memory { handle: new_handle }
+        Memory { handle: new_handle, image: None }
     }
 }
 
 impl Memory {
     pub fn new(handle: HANDLE) -> Self {
-        Self { handle }
+        Self { handle, image: None }
+    }
+
+    /// Read-only memory backed by a snapshot image instead of a process
+    pub fn from_image(image: Arc<MemoryImage>) -> Self {
+        Self { handle: HANDLE(std::ptr::null_mut()), image: Some(image) }
+    }
+
+    pub fn is_read_only(&self) -> bool {
+        self.image.is_some()
     }
 
     /// Exposes the inner OS handle for specific Win32 API calls like VirtualQueryEx
@@ -33,18 +64,65 @@ impl Memory {
         self.handle
     }
 
-    /// Read raw bytes from the process memory
+    /// Read raw bytes from the process memory into a new buffer. A partial read succeeds; the unread tail is zeroed.
     pub fn read_bytes(&self, address: usize, size: usize) -> Result<Vec<u8>, String> {
-        let mut buffer = vec![0u8; size];
-        let mut bytes_read = 0;
-
-        let success = unsafe { ReadProcessMemory(self.handle, address as *const c_void, buffer.as_mut_ptr() as *mut c_void, size, Some(&mut bytes_read)) };
+        let mut buffer = Vec::with_capacity(size);
+        let read = self.read_uninit(address, &mut buffer.spare_capacity_mut()[..size]).map_or(0, |bytes| bytes.len());
+        if read == 0 {
+            return Err(format!("Failed to read memory at 0x{:X}", address));
+        }
+        buffer.spare_capacity_mut()[read..size].fill(MaybeUninit::new(0));
+        // SAFETY: [0, read) was written by the read, [read, size) was zeroed above
+        unsafe { buffer.set_len(size) };
+        Ok(buffer)
+    }
 
-        if success.is_ok() && bytes_read > 0 {
-            Ok(buffer)
+    /// Read into caller memory without zeroing it first. Returns the bytes actually read (a prefix of `out`), None if nothing was.
+    pub fn read_uninit<'b>(&self, address: usize, out: &'b mut [MaybeUninit<u8>]) -> Option<&'b mut [u8]> {
+        let size = out.len();
+        let started = Instant::now();
+        let read = if let Some(image) = &self.image {
+            // SAFETY: the image only writes into `out`; it is treated as initialized only if the read succeeds
+            let ok = size > 0 && image.read(address, unsafe { &mut *(out as *mut [MaybeUninit<u8>] as *mut [u8]) });
+            IO.record(Op::Read, started, size, ok);
+            if ok {
+                size
+            } else {
+                0
+            }
         } else {
-            Err(format!("Failed to read memory at 0x{:X}", address))
+            let mut bytes_read = 0;
+            let success = unsafe { ReadProcessMemory(self.handle, address as *const c_void, out.as_mut_ptr() as *mut c_void, size, Some(&mut bytes_read)) };
+            IO.record(Op::Read, started, bytes_read, success.is_ok() && bytes_read > 0);
+            if success.is_ok() {
+                bytes_read.min(size)
+            } else {
+                0
+            }
+        };
+        // SAFETY: the first `read` bytes were written by ReadProcessMemory or the image
+        (read > 0).then(|| unsafe { std::slice::from_raw_parts_mut(out.as_mut_ptr() as *mut u8, read) })
+    }
+
+    /// Fill all of `out`; false if any of it could not be read
+    pub fn read_into(&self, address: usize, out: &mut [u8]) -> bool {
+        let len = out.len();
+        // SAFETY: u8 and MaybeUninit<u8> share a layout, and nothing uninitialized is written through the cast
+        let uninit = unsafe { &mut *(out as *mut [u8] as *mut [MaybeUninit<u8>]) };
+        len > 0 && self.read_uninit(address, uninit).is_some_and(|read| read.len() == len)
+    }
+
+    /// Read `size` bytes into this thread's reusable scratch buffer and hand them to `f`; nothing is allocated once the buffer has grown.
+    /// Reentrant: a read inside `f` gets a buffer of its own.
+    pub fn read_with<R>(&self, address: usize, size: usize, f: impl FnOnce(&[u8]) -> R) -> Option<R> {
+        let mut scratch = SCRATCH.with(|s| std::mem::take(&mut *s.borrow_mut()));
+        scratch.clear();
+        scratch.reserve(size);
+        let result = self.read_uninit(address, &mut scratch.spare_capacity_mut()[..size]).map(|bytes| f(bytes));
+        if scratch.capacity() <= SCRATCH_KEEP {
+            SCRATCH.with(|s| *s.borrow_mut() = scratch);
         }
+        result
     }
 
     /// Read a specific type from memory
@@ -54,27 +132,92 @@ impl Memory {
 
     /// Write a specific type to memory
     pub fn write<T: Copy>(&self, address: usize, value: T) -> Result<(), String> {
-        use windows::Win32::System::Memory::{VirtualProtectEx, PAGE_EXECUTE_READWRITE, PAGE_PROTECTION_FLAGS};
-        let size = std::mem::size_of::<T>();
+        let bytes = unsafe { std::slice::from_raw_parts(&value as *const T as *const u8, std::mem::size_of::<T>()) };
+        self.write_bytes(address, bytes)
+    }
+
+    /// Write raw bytes. Heap data is normally writable already, so the write is tried as is and the page
+    /// protection is only lifted (and restored) when that fails.
+    pub fn write_bytes(&self, address: usize, bytes: &[u8]) -> Result<(), String> {
+        if self.is_read_only() {
+            return Err("Snapshot is read-only".to_string());
+        }
+        if self.write_direct(address, bytes) || self.write_unprotected(address, address + bytes.len(), &[(address, bytes)]).into_iter().all(|ok| ok) {
+            Ok(())
+        } else {
+            Err(format!("Failed to write memory at 0x{:X}", address))
+        }
+    }
+
+    /// Write many (address, bytes) pairs. Writes are grouped by page; a page that rejects a direct write gets
+    /// one VirtualProtectEx round trip for all of its failed writes instead of two per write.
+    /// Results are in input order.
+    pub fn write_batch(&self, writes: &[(usize, Vec<u8>)]) -> Vec<Result<(), String>> {
+        if self.is_read_only() {
+            return writes.iter().map(|_| Err("Snapshot is read-only".to_string())).collect();
+        }
+        let mut ok = vec![false; writes.len()];
+        let mut order: Vec<usize> = (0..writes.len()).collect();
+        order.sort_by_key(|&i| writes[i].0);
+
+        let mut g = 0;
+        while g < order.len() {
+            let page = writes[order[g]].0 & !(WRITE_PAGE_SIZE - 1);
+            let mut end = g + 1;
+            while end < order.len() && writes[order[end]].0 & !(WRITE_PAGE_SIZE - 1) == page {
+                end += 1;
+            }
+
+            let mut failed = Vec::new();
+            for &i in &order[g..end] {
+                ok[i] = self.write_direct(writes[i].0, &writes[i].1);
+                if !ok[i] {
+                    failed.push(i);
+                }
+            }
+
+            if !failed.is_empty() {
+                let start = failed.iter().map(|&i| writes[i].0).min().unwrap_or(page);
+                let stop = failed.iter().map(|&i| writes[i].0 + writes[i].1.len()).max().unwrap_or(page);
+                let pending: Vec<(usize, &[u8])> = failed.iter().map(|&i| (writes[i].0, writes[i].1.as_slice())).collect();
+                for (&i, written) in failed.iter().zip(self.write_unprotected(start, stop, &pending)) {
+                    ok[i] = written;
+                }
+            }
+            g = end;
+        }
+
+        ok.into_iter().zip(writes).map(|(ok, (address, _))| if ok { Ok(()) } else { Err(format!("Failed to write memory at 0x{:X}", address)) }).collect()
+    }
+
+    fn write_direct(&self, address: usize, bytes: &[u8]) -> bool {
         let mut bytes_written = 0;
+        let started = Instant::now();
+        let success = unsafe { WriteProcessMemory(self.handle, address as *const c_void, bytes.as_ptr() as *const c_void, bytes.len(), Some(&mut bytes_written)) };
+        let ok = success.is_ok() && bytes_written == bytes.len();
+        IO.record(Op::Write, started, bytes_written, ok);
+        ok
+    }
+
+    /// Make [start, stop) writable once, perform `writes`, then restore the original protection
+    fn write_unprotected(&self, start: usize, stop: usize, writes: &[(usize, &[u8])]) -> Vec<bool> {
+        use windows::Win32::System::Memory::{VirtualProtectEx, PAGE_EXECUTE_READWRITE, PAGE_PROTECTION_FLAGS};
         let mut old_protect = PAGE_PROTECTION_FLAGS(0);
 
         unsafe {
             // Unprotect the memory page temporarily
-            let _ = VirtualProtectEx(self.handle, address as *const c_void, size, PAGE_EXECUTE_READWRITE, &mut old_protect);
+            let started = Instant::now();
+            let unprotected = VirtualProtectEx(self.handle, start as *const c_void, stop - start, PAGE_EXECUTE_READWRITE, &mut old_protect);
+            IO.record(Op::Protect, started, stop - start, unprotected.is_ok());
 
-            // Perform the write
-            let success = WriteProcessMemory(self.handle, address as *const c_void, &value as *const T as *const c_void, size, Some(&mut bytes_written));
+            let results = writes.iter().map(|(address, bytes)| self.write_direct(*address, bytes)).collect();
 
             // Restore the original memory protection
             let mut temp = PAGE_PROTECTION_FLAGS(0);
-            let _ = VirtualProtectEx(self.handle, address as *const c_void, size, old_protect, &mut temp);
-
-            if success.is_ok() && bytes_written > 0 {
-                Ok(())
-            } else {
-                Err(format!("Failed to write memory at 0x{:X}", address))
-            }
+            let started = Instant::now();
+            let restored = VirtualProtectEx(self.handle, start as *const c_void, stop - start, old_protect, &mut temp);
+            IO.record(Op::Protect, started, stop - start, restored.is_ok());
+            results
         }
     }
 
@@ -84,9 +227,17 @@ impl Memory {
     pub fn try_read<T: Copy>(&self, address: usize) -> Option<T> {
         let size = std::mem::size_of::<T>();
         let mut buffer = std::mem::MaybeUninit::<T>::uninit();
+        let started = Instant::now();
+        if let Some(image) = &self.image {
+            let out = unsafe { std::slice::from_raw_parts_mut(buffer.as_mut_ptr() as *mut u8, size) };
+            let ok = image.read(address, out);
+            IO.record(Op::TryRead, started, size, ok);
+            return ok.then(|| unsafe { buffer.assume_init() });
+        }
         let mut bytes_read = 0;
 
         let success = unsafe { ReadProcessMemory(self.handle, address as *const c_void, buffer.as_mut_ptr() as *mut c_void, size, Some(&mut bytes_read)) };
+        IO.record(Op::TryRead, started, size, success.is_ok() && bytes_read == size);
 
         if success.is_ok() && bytes_read == size {
             Some(unsafe { buffer.assume_init() })
@@ -110,8 +261,13 @@ impl Memory {
     pub fn get_memory_region_size(&self, address: usize) -> Result<usize, String> {
         use windows::Win32::System::Memory::{VirtualQueryEx, MEMORY_BASIC_INFORMATION};
 
+        if let Some(image) = &self.image {
+            return image.region_size(address).ok_or_else(|| format!("VirtualQueryEx failed at 0x{:X}", address));
+        }
         let mut mbi = MEMORY_BASIC_INFORMATION::default();
+        let started = Instant::now();
         let result = unsafe { VirtualQueryEx(self.handle, Some(address as *const c_void), &mut mbi, std::mem::size_of::<MEMORY_BASIC_INFORMATION>()) };
+        IO.record(Op::Query, started, 0, result != 0);
 
         if result == 0 {
             Err(format!("VirtualQueryEx failed at 0x{:X}", address))
@@ -120,32 +276,207 @@ impl Memory {
         }
     }
 
-    /// Read a null-terminated UTF-8 string or ASCII string
+    /// Read a null-terminated UTF-8 string of at most `max_length` bytes
     pub fn read_string(&self, address: usize, max_length: usize) -> Result<String, String> {
         if max_length == 0 {
             return Ok(String::new());
         }
-
-        let buffer = self.read_bytes(address, max_length)?;
-        let mut result = String::with_capacity(max_length);
-
-        for &byte in &buffer {
-            if byte == 0 {
-                break;
-            }
-            result.push(byte as char);
-        }
-
-        Ok(result)
+        self.read_with(address, max_length, |bytes| crate::backend::os::text::utf8(bytes).into_owned()).ok_or_else(|| format!("Failed to read memory at 0x{:X}", address))
     }
 }
 
 impl Drop for Memory {
     fn drop(&mut self) {
-        if !self.handle.is_invalid() {
+        if self.image.is_none() && !self.handle.is_invalid() {
             unsafe {
                 let _ = CloseHandle(self.handle);
             }
         }
     }
 }
+
+// ═══════════════════════════════════════════════════════════════
+//  CachedMemory — page-granular read cache over Memory
+//  One ReadProcessMemory per page; small reads in pointer walks are served locally.
+//  Meant to live for one operation (a walk, a scan, an index build): nothing is ever refetched,
+//  so each operation creates its own and drops it when done.
+// ═══════════════════════════════════════════════════════════════
+
+pub const PAGE_4K: usize = 0x1000;
+pub const PAGE_64K: usize = 0x10000;
+
+const CACHE_SHARDS: usize = 16;
+const DEFAULT_CACHE_BYTES: usize = 16 * 1024 * 1024;
+
+/// Page hits and misses of every CachedMemory, and how often a shard lock was found held
+pub static PAGE_CACHE: LookupCounters = LookupCounters::new();
+
+#[derive(Debug, Clone, Copy, Default, serde::Serialize)]
+pub struct CacheStats {
+    pub hits: u64,
+    pub misses: u64,
+    pub pages: usize,
+}
+
+struct CachedPage {
+    last_used: u64,
+    /// None: the page was unreadable (cached too, so failing walks don't retry it for the cache's lifetime)
+    data: Option<Box<[u8]>>,
+    /// Sub-pages of `data` that could not be read (bit n: the n-th `sub_page`); only set when the whole-page read failed
+    bad: u64,
+}
+
+#[derive(Default)]
+struct CacheShard {
+    pages: HashMap<usize, CachedPage>,
+    tick: u64,
+}
+
+pub struct CachedMemory<'a> {
+    memory: &'a Memory,
+    page_size: usize,
+    pages_per_shard: usize,
+    shards: Box<[Mutex<CacheShard>]>,
+    hits: AtomicU64,
+    misses: AtomicU64,
+}
+
+impl<'a> CachedMemory<'a> {
+    /// `page_size` must be a power of two, normally PAGE_4K or PAGE_64K
+    pub fn new(memory: &'a Memory, page_size: usize) -> Self {
+        Self::with_capacity(memory, page_size, DEFAULT_CACHE_BYTES)
+    }
+
+    pub fn with_capacity(memory: &'a Memory, page_size: usize, max_bytes: usize) -> Self {
+        assert!(page_size.is_power_of_two(), "page size must be a power of two");
+        let pages_per_shard = (max_bytes / page_size / CACHE_SHARDS).max(1);
+        Self { memory, page_size, pages_per_shard, shards: (0..CACHE_SHARDS).map(|_| Mutex::new(CacheShard::default())).collect(), hits: AtomicU64::new(0), misses: AtomicU64::new(0) }
+    }
+
+    pub fn memory(&self) -> &'a Memory {
+        self.memory
+    }
+
+    pub fn stats(&self) -> CacheStats {
+        let pages = self.shards.iter().map(|s| s.lock().unwrap().pages.len()).sum();
+        CacheStats { hits: self.hits.load(Ordering::Relaxed), misses: self.misses.load(Ordering::Relaxed), pages }
+    }
+
+    /// Copy `out.len()` bytes at `address` into `out`; false if any page in the range is unreadable
+    pub fn read_exact(&self, address: usize, out: &mut [u8]) -> bool {
+        let mut done = 0;
+        while done < out.len() {
+            let current = address.wrapping_add(done);
+            let page = current & !(self.page_size - 1);
+            let offset = current - page;
+            let n = (self.page_size - offset).min(out.len() - done);
+            if !self.copy_from_page(page, offset, &mut out[done..done + n]) {
+                return false;
+            }
+            done += n;
+        }
+        true
+    }
+
+    #[inline]
+    pub fn try_read<T: Copy>(&self, address: usize) -> Option<T> {
+        let mut value = std::mem::MaybeUninit::<T>::uninit();
+        let bytes = unsafe { std::slice::from_raw_parts_mut(value.as_mut_ptr() as *mut u8, std::mem::size_of::<T>()) };
+        if self.read_exact(address, bytes) {
+            Some(unsafe { value.assume_init() })
+        } else {
+            None
+        }
+    }
+
+    #[inline]
+    pub fn try_read_pointer(&self, address: usize) -> Option<usize> {
+        self.try_read::<u64>(address).map(|v| v as usize)
+    }
+
+    fn lock_shard(shard: &Mutex<CacheShard>) -> MutexGuard<'_, CacheShard> {
+        match shard.try_lock() {
+            Ok(guard) => guard,
+            Err(TryLockError::WouldBlock) => {
+                PAGE_CACHE.contended();
+                shard.lock().unwrap()
+            }
+            Err(TryLockError::Poisoned(e)) => panic!("page cache shard poisoned: {}", e),
+        }
+    }
+
+    fn copy_from_page(&self, page: usize, offset: usize, out: &mut [u8]) -> bool {
+        let shard = &self.shards[(page / self.page_size) % CACHE_SHARDS];
+
+        {
+            let mut guard = Self::lock_shard(shard);
+            let shard = &mut *guard;
+            shard.tick += 1;
+            if let Some(cached) = shard.pages.get_mut(&page) {
+                cached.last_used = shard.tick;
+                self.hits.fetch_add(1, Ordering::Relaxed);
+                PAGE_CACHE.hit(true);
+                return self.copy_out(cached.data.as_deref(), cached.bad, offset, out);
+            }
+        }
+
+        // Miss: fetch outside the lock so other threads on this shard are not held up by the syscall
+        self.misses.fetch_add(1, Ordering::Relaxed);
+        PAGE_CACHE.hit(false);
+        let (data, bad) = self.fetch_page(page);
+        let readable = self.copy_out(data.as_deref(), bad, offset, out);
+
+        let mut guard = Self::lock_shard(shard);
+        let shard = &mut *guard;
+        if shard.pages.len() >= self.pages_per_shard && !shard.pages.contains_key(&page) {
+            // Evict the least recently used
+            if let Some(victim) = shard.pages.iter().min_by_key(|(_, p)| p.last_used).map(|(k, _)| *k) {
+                shard.pages.remove(&victim);
+            }
+        }
+        shard.tick += 1;
+        shard.pages.insert(page, CachedPage { last_used: shard.tick, data, bad });
+        readable
+    }
+
+    /// Granularity of the fallback reads: 4K, or coarser for pages with more than 64 of those
+    fn sub_page(&self) -> usize {
+        (self.page_size / 64).max(PAGE_4K).min(self.page_size)
+    }
+
+    /// The whole page in one read; if that fails (an uncommitted or guard page somewhere inside it), sub-page by sub-page,
+    /// so the readable rest of a large page is still served
+    fn fetch_page(&self, page: usize) -> (Option<Box<[u8]>>, u64) {
+        if let Ok(data) = self.memory.read_bytes(page, self.page_size) {
+            return (Some(data.into_boxed_slice()), 0);
+        }
+        let sub = self.sub_page();
+        if sub >= self.page_size {
+            return (None, 0);
+        }
+        let mut data = vec![0u8; self.page_size].into_boxed_slice();
+        let mut bad = 0u64;
+        for (n, chunk) in data.chunks_mut(sub).enumerate() {
+            if !self.memory.read_into(page.wrapping_add(n * sub), chunk) {
+                bad |= 1 << n;
+            }
+        }
+        if bad.count_ones() as usize == self.page_size / sub {
+            (None, 0)
+        } else {
+            (Some(data), bad)
+        }
+    }
+
+    fn copy_out(&self, data: Option<&[u8]>, bad: u64, offset: usize, out: &mut [u8]) -> bool {
+        let Some(data) = data else { return false };
+        if bad != 0 && !out.is_empty() {
+            let sub = self.sub_page();
+            if (offset / sub..=(offset + out.len() - 1) / sub).any(|n| bad & (1 << n) != 0) {
+                return false;
+            }
+        }
+        out.copy_from_slice(&data[offset..offset + out.len()]);
+        true
+    }
+}
@@ -1,3 +1,6 @@
+pub mod image;
 pub mod memory;
 pub mod process;
+pub mod profile;
 pub mod scanner;
+pub mod text;
@@ -1,9 +1,12 @@
 use crate::backend::os::memory::Memory;
 use crate::backend::state::AppState;
+use crate::backend::unreal::autoconfig::{AutoConfig, OffsetSource};
+use crate::backend::unreal::build_cache::BuildCache;
 use std::collections::HashSet;
+use std::sync::Arc;
 use sysinfo::System;
 use windows::Win32::Foundation::{BOOL, HWND, LPARAM};
-use windows::Win32::System::Diagnostics::ToolHelp::{CreateToolhelp32Snapshot, Module32First, MODULEENTRY32, TH32CS_SNAPMODULE, TH32CS_SNAPMODULE32};
+use windows::Win32::System::Diagnostics::ToolHelp::{CreateToolhelp32Snapshot, Module32First, Module32Next, MODULEENTRY32, TH32CS_SNAPMODULE, TH32CS_SNAPMODULE32};
 use windows::Win32::System::Threading::{OpenProcess, PROCESS_QUERY_INFORMATION, PROCESS_VM_OPERATION, PROCESS_VM_READ, PROCESS_VM_WRITE};
 use windows::Win32::UI::WindowsAndMessaging::{EnumWindows, GetWindowTextLengthW, GetWindowThreadProcessId, IsWindowVisible};
 
@@ -17,6 +20,14 @@ pub struct Process {
     pub main_module_size: usize,
 }
 
+/// A loaded module (exe or DLL) of the target
+#[derive(Debug, Clone, serde::Serialize)]
+pub struct ModuleInfo {
+    pub name: String,
+    pub base: usize,
+    pub size: usize,
+}
+
 #[derive(Debug, serde::Serialize)]
 pub struct ProcessInfo {
     pub pid: u32,
@@ -26,6 +37,33 @@ pub struct ProcessInfo {
 impl Process {
     /// Open/Attach to a process by its PID, creating a Memory reader for it and storing it in State
     pub fn attach(state: &tauri::State<'_, AppState>, pid: u32, name: &str) -> Result<String, String> {
+        let process = Self::open(pid, name)?;
+
+        // Same build as a previous session? Reuse its validated discovery results instead of rescanning
+        let restored = BuildCache::restore(&process);
+
+        state.process.store(Some(Arc::new(process)));
+
+        // Clear the ObjectManager caches so old process memory mappings don't conflict
+        state.objects().clear();
+        state.cursors.clear();
+        state.name_pool.store(None);
+
+        // Base addresses and offsets are per attach; anything not restored is resolved again for the new process
+        let (base_addresses, offsets) = restored.map(|r| (r.base_addresses, r.offsets)).unwrap_or_default();
+        let restored_note = match (base_addresses.fname_pool.is_some() || base_addresses.guobject_array.is_some() || base_addresses.gworld.is_some(), offsets.is_some()) {
+            (false, _) => "",
+            (true, false) => " (base addresses restored from build cache)",
+            (true, true) => " (base addresses and offsets restored from build cache)",
+        };
+        state.base_addresses.store(Arc::new(base_addresses));
+        state.auto_config.store(offsets.map(|offsets| Arc::new(AutoConfig { offsets, source: OffsetSource::BuildCache })));
+
+        Ok(format!("Successfully attached to {}{}", name, restored_note))
+    }
+
+    /// Open a process by its PID for reading and writing, without touching State
+    pub fn open(pid: u32, name: &str) -> Result<Self, String> {
         let handle = unsafe { OpenProcess(PROCESS_VM_READ | PROCESS_VM_WRITE | PROCESS_VM_OPERATION | PROCESS_QUERY_INFORMATION, false, pid) }.map_err(|e| format!("Failed to open process PID {}: {}", pid, e))?;
 
         if handle.is_invalid() {
@@ -38,16 +76,9 @@ impl Process {
 
         let (main_module_base, main_module_size) = Self::get_main_module_info(pid)?;
 
-        let process = Self { pid, name: name.to_string(), exe_path, memory: Memory::new(handle), main_module_base, main_module_size };
-
-        let mut process_state = state.process.lock().unwrap();
-        *process_state = Some(process);
-
-        // Clear the ObjectManager caches so old process memory mappings don't conflict
-        state.object_manager.clear();
-
-        Ok(format!("Successfully attached to {}", name))
+        Ok(Self { pid, name: name.to_string(), exe_path, memory: Memory::new(handle), main_module_base, main_module_size })
     }
+
     /// Enumerate all running application processes (filtered by visible windows)
     pub fn get_processes() -> Vec<ProcessInfo> {
         let mut app_pids = HashSet::new();
@@ -86,6 +117,32 @@ impl Process {
         processes
     }
 
+    /// Every module loaded in the target, main executable first. A snapshot only knows its main module.
+    pub fn modules(&self) -> Result<Vec<ModuleInfo>, String> {
+        if self.memory.is_read_only() {
+            let name = self.exe_path.rsplit(['\\', '/']).next().unwrap_or(&self.name).to_string();
+            return Ok(vec![ModuleInfo { name, base: self.main_module_base, size: self.main_module_size }]);
+        }
+        unsafe {
+            let snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, self.pid).map_err(|e| format!("Failed to create toolhelp snapshot: {}", e))?;
+            let mut modules = Vec::new();
+            let mut module_entry = MODULEENTRY32 { dwSize: std::mem::size_of::<MODULEENTRY32>() as u32, ..Default::default() };
+            let mut next = Module32First(snapshot, &mut module_entry);
+            while next.is_ok() {
+                let name: Vec<u8> = module_entry.szModule.iter().take_while(|&&c| c != 0).map(|&c| c as u8).collect();
+                modules.push(ModuleInfo { name: String::from_utf8_lossy(&name).into_owned(), base: module_entry.modBaseAddr as usize, size: module_entry.modBaseSize as usize });
+                next = Module32Next(snapshot, &mut module_entry);
+            }
+            windows::Win32::Foundation::CloseHandle(snapshot).ok();
+            Ok(modules)
+        }
+    }
+
+    /// Module by (case-insensitive) file name
+    pub fn module(&self, name: &str) -> Result<ModuleInfo, String> {
+        self.modules()?.into_iter().find(|m| m.name.eq_ignore_ascii_case(name)).ok_or_else(|| format!("Module '{}' not loaded", name))
+    }
+
     /// Fetches the base address and size of the primary module for the given PID
     fn get_main_module_info(pid: u32) -> Result<(usize, usize), String> {
         unsafe {
@@ -0,0 +1,361 @@
+use dashmap::try_result::TryResult;
+use dashmap::DashMap;
+use std::cell::Cell;
+use std::hash::Hash;
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std::time::Instant;
+
+// ═══════════════════════════════════════════════════════════════
+//  Profile counters — what the pipeline benchmark and /api/metrics report
+//  Every Memory entry point records its call, bytes, outcome and latency
+//  where the syscall is issued. Counters are striped per thread: each thread
+//  adds to its own cache line and only a reader sums the stripes, so a
+//  parallel dump does not bounce one counter between cores. Allocations are
+//  only counted when built with `--features alloc-profile`, which installs a
+//  counting global allocator; resident memory comes from GetProcessMemoryInfo.
+// ═══════════════════════════════════════════════════════════════
+
+/// Stripes per counter set; threads beyond this share stripes round-robin
+const STRIPES: usize = 16;
+
+static NEXT_STRIPE: AtomicUsize = AtomicUsize::new(0);
+
+thread_local! {
+    static STRIPE: Cell<usize> = const { Cell::new(usize::MAX) };
+}
+
+#[inline]
+fn stripe() -> usize {
+    STRIPE.with(|s| {
+        let mut i = s.get();
+        if i == usize::MAX {
+            i = NEXT_STRIPE.fetch_add(1, Ordering::Relaxed) % STRIPES;
+            s.set(i);
+        }
+        i
+    })
+}
+
+#[repr(align(64))]
+struct Stripe<const N: usize>([AtomicU64; N]);
+
+/// `N` counters, one copy per stripe
+pub struct Striped<const N: usize> {
+    stripes: [Stripe<N>; STRIPES],
+}
+
+impl<const N: usize> Striped<N> {
+    const ZERO: AtomicU64 = AtomicU64::new(0);
+    const EMPTY: Stripe<N> = Stripe([Self::ZERO; N]);
+
+    pub const fn new() -> Self {
+        Self { stripes: [Self::EMPTY; STRIPES] }
+    }
+
+    #[inline]
+    pub fn add(&self, counter: usize, value: u64) {
+        self.stripes[stripe()].0[counter].fetch_add(value, Ordering::Relaxed);
+    }
+
+    pub fn sum(&self, counter: usize) -> u64 {
+        self.stripes.iter().map(|s| s.0[counter].load(Ordering::Relaxed)).sum()
+    }
+
+    pub fn reset(&self) {
+        for stripe in &self.stripes {
+            for counter in &stripe.0 {
+                counter.store(0, Ordering::Relaxed);
+            }
+        }
+    }
+}
+
+impl<const N: usize> Default for Striped<N> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+// ─── Memory entry points ─────────────────────────────────────────
+
+/// Memory entry points with their own counters
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum Op {
+    /// read_bytes: buffers, pages, strings
+    Read,
+    /// try_read: typed reads in pointer walks
+    TryRead,
+    /// WriteProcessMemory
+    Write,
+    /// VirtualProtectEx around writes into protected pages
+    Protect,
+    /// VirtualQueryEx: region sizes and scanner region walks
+    Query,
+}
+
+const OPS: [(Op, &str); 5] = [(Op::Read, "read_bytes"), (Op::TryRead, "try_read"), (Op::Write, "write"), (Op::Protect, "protect"), (Op::Query, "query")];
+
+/// Latency buckets: bucket b holds calls that took [2^(b-1), 2^b) ns; the last one everything slower (> ~1 s)
+pub const LATENCY_BUCKETS: usize = 31;
+const CALLS: usize = 0;
+const BYTES: usize = 1;
+const FAILURES: usize = 2;
+const NANOS: usize = 3;
+const HISTOGRAM: usize = 4;
+const PER_OP: usize = HISTOGRAM + LATENCY_BUCKETS;
+
+/// Process-wide counters for every syscall Memory issues (or snapshot lookup standing in for one)
+pub struct IoCounters {
+    counters: Striped<{ OPS.len() * PER_OP }>,
+}
+
+pub static IO: IoCounters = IoCounters { counters: Striped::new() };
+
+#[derive(Debug, Clone, Copy, Default, serde::Serialize)]
+pub struct IoStats {
+    pub read_calls: u64,
+    /// Bytes requested by successful reads
+    pub read_bytes: u64,
+    pub failed_reads: u64,
+    /// VirtualQueryEx calls (region sizes, scanner region walks)
+    pub query_calls: u64,
+}
+
+/// One entry point's totals and latency distribution
+#[derive(Debug, Clone, serde::Serialize)]
+pub struct OpMetrics {
+    pub op: &'static str,
+    pub calls: u64,
+    pub bytes: u64,
+    pub failures: u64,
+    pub total_ms: f64,
+    pub mean_ns: u64,
+    /// Upper bound of the histogram bucket holding the percentile
+    pub p50_ns: u64,
+    pub p99_ns: u64,
+    pub max_bucket_ns: u64,
+    /// Calls per latency bucket, see LATENCY_BUCKETS
+    pub histogram: Vec<u64>,
+}
+
+impl IoCounters {
+    /// Record a call to `op` that started at `started`
+    #[inline]
+    pub fn record(&self, op: Op, started: Instant, bytes: usize, ok: bool) {
+        let nanos = started.elapsed().as_nanos() as u64;
+        let base = op as usize * PER_OP;
+        let bucket = ((u64::BITS - nanos.leading_zeros()) as usize).min(LATENCY_BUCKETS - 1);
+        self.counters.add(base + CALLS, 1);
+        if ok {
+            self.counters.add(base + BYTES, bytes as u64);
+        } else {
+            self.counters.add(base + FAILURES, 1);
+        }
+        self.counters.add(base + NANOS, nanos);
+        self.counters.add(base + HISTOGRAM + bucket, 1);
+    }
+
+    fn get(&self, op: Op, counter: usize) -> u64 {
+        self.counters.sum(op as usize * PER_OP + counter)
+    }
+
+    pub fn stats(&self) -> IoStats {
+        IoStats { read_calls: self.get(Op::Read, CALLS) + self.get(Op::TryRead, CALLS), read_bytes: self.get(Op::Read, BYTES) + self.get(Op::TryRead, BYTES), failed_reads: self.get(Op::Read, FAILURES) + self.get(Op::TryRead, FAILURES), query_calls: self.get(Op::Query, CALLS) }
+    }
+
+    pub fn metrics(&self) -> Vec<OpMetrics> {
+        OPS.iter()
+            .map(|&(op, name)| {
+                let histogram: Vec<u64> = (0..LATENCY_BUCKETS).map(|b| self.get(op, HISTOGRAM + b)).collect();
+                let (calls, nanos) = (self.get(op, CALLS), self.get(op, NANOS));
+                let percentile = |p: f64| {
+                    let rank = ((calls as f64 * p).ceil() as u64).max(1);
+                    let mut seen = 0;
+                    histogram.iter().position(|&n| {
+                        seen += n;
+                        seen >= rank
+                    })
+                };
+                let bound = |bucket: Option<usize>| bucket.map_or(0, |b| 1u64 << b);
+                let max_bucket = histogram.iter().rposition(|&n| n > 0);
+                OpMetrics { op: name, calls, bytes: self.get(op, BYTES), failures: self.get(op, FAILURES), total_ms: nanos as f64 / 1e6, mean_ns: if calls > 0 { nanos / calls } else { 0 }, p50_ns: bound(percentile(0.5)), p99_ns: bound(percentile(0.99)), max_bucket_ns: bound(max_bucket), histogram }
+            })
+            .collect()
+    }
+
+    pub fn reset(&self) {
+        self.counters.reset();
+    }
+}
+
+impl IoStats {
+    pub fn since(self, earlier: IoStats) -> IoStats {
+        IoStats { read_calls: self.read_calls.saturating_sub(earlier.read_calls), read_bytes: self.read_bytes.saturating_sub(earlier.read_bytes), failed_reads: self.failed_reads.saturating_sub(earlier.failed_reads), query_calls: self.query_calls.saturating_sub(earlier.query_calls) }
+    }
+}
+
+// ─── Cache and map lookups ───────────────────────────────────────
+
+const HITS: usize = 0;
+const MISSES: usize = 1;
+const CONTENDED: usize = 2;
+
+/// Hit/miss counts of a cache, and how often a lookup found its shard locked by another thread
+#[derive(Default)]
+pub struct LookupCounters(Striped<3>);
+
+#[derive(Debug, Clone, Copy, Default, serde::Serialize)]
+pub struct LookupStats {
+    pub hits: u64,
+    pub misses: u64,
+    /// Lookups that had to wait for a shard lock held by another thread
+    pub contended: u64,
+    pub hit_ratio: f64,
+}
+
+impl LookupCounters {
+    pub const fn new() -> Self {
+        Self(Striped::new())
+    }
+
+    #[inline]
+    pub fn hit(&self, hit: bool) {
+        self.0.add(if hit { HITS } else { MISSES }, 1);
+    }
+
+    #[inline]
+    pub fn contended(&self) {
+        self.0.add(CONTENDED, 1);
+    }
+
+    /// `map.get(key)`, counted: a shard held by a writer is recorded before blocking on it
+    #[inline]
+    pub fn get<'a, K: Eq + Hash, V>(&self, map: &'a DashMap<K, V>, key: &K) -> Option<dashmap::mapref::one::Ref<'a, K, V>> {
+        let found = match map.try_get(key) {
+            TryResult::Present(found) => Some(found),
+            TryResult::Absent => None,
+            TryResult::Locked => {
+                self.contended();
+                map.get(key)
+            }
+        };
+        self.hit(found.is_some());
+        found
+    }
+
+    pub fn stats(&self) -> LookupStats {
+        let (hits, misses) = (self.0.sum(HITS), self.0.sum(MISSES));
+        LookupStats { hits, misses, contended: self.0.sum(CONTENDED), hit_ratio: if hits + misses > 0 { hits as f64 / (hits + misses) as f64 } else { 0.0 } }
+    }
+
+    pub fn reset(&self) {
+        self.0.reset();
+    }
+}
+
+#[cfg(feature = "alloc-profile")]
+mod counting {
+    use std::alloc::{GlobalAlloc, Layout, System};
+    use std::sync::atomic::{AtomicU64, Ordering};
+
+    pub static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+    pub static ALLOCATED_BYTES: AtomicU64 = AtomicU64::new(0);
+
+    pub struct CountingAlloc;
+
+    unsafe impl GlobalAlloc for CountingAlloc {
+        unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+            ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+            ALLOCATED_BYTES.fetch_add(layout.size() as u64, Ordering::Relaxed);
+            System.alloc(layout)
+        }
+
+        unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+            System.dealloc(ptr, layout)
+        }
+
+        unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+            ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+            ALLOCATED_BYTES.fetch_add(new_size as u64, Ordering::Relaxed);
+            System.realloc(ptr, layout, new_size)
+        }
+    }
+
+    #[global_allocator]
+    static GLOBAL: CountingAlloc = CountingAlloc;
+}
+
+/// (allocations, bytes allocated) so far; None unless built with `alloc-profile`
+pub fn allocations() -> Option<(u64, u64)> {
+    #[cfg(feature = "alloc-profile")]
+    {
+        Some((counting::ALLOCATIONS.load(Ordering::Relaxed), counting::ALLOCATED_BYTES.load(Ordering::Relaxed)))
+    }
+    #[cfg(not(feature = "alloc-profile"))]
+    {
+        None
+    }
+}
+
+/// (working set, peak working set) of this process in bytes
+pub fn resident_memory() -> Option<(usize, usize)> {
+    use windows::Win32::System::ProcessStatus::{GetProcessMemoryInfo, PROCESS_MEMORY_COUNTERS};
+    use windows::Win32::System::Threading::GetCurrentProcess;
+
+    let mut counters = PROCESS_MEMORY_COUNTERS { cb: std::mem::size_of::<PROCESS_MEMORY_COUNTERS>() as u32, ..Default::default() };
+    unsafe { GetProcessMemoryInfo(GetCurrentProcess(), &mut counters, counters.cb) }.ok()?;
+    Some((counters.WorkingSetSize, counters.PeakWorkingSetSize))
+}
+
+/// Measurements of one stage, as written into the benchmark report
+#[derive(Debug, Clone, Default, serde::Serialize)]
+pub struct StageProfile {
+    pub name: String,
+    pub ok: bool,
+    /// Why the stage failed or was skipped
+    pub note: Option<String>,
+    /// What the stage produced: names, objects, matches...
+    pub items: u64,
+    pub wall_ms: f64,
+    pub io: IoStats,
+    pub allocations: Option<u64>,
+    pub allocated_bytes: Option<u64>,
+    /// Working set change over the stage
+    pub rss_delta_bytes: Option<i64>,
+    /// Peak working set of the process when the stage ended
+    pub peak_rss_bytes: Option<usize>,
+}
+
+/// Counters at the start of a stage
+pub struct StageTimer {
+    name: String,
+    start: Instant,
+    io: IoStats,
+    allocations: Option<(u64, u64)>,
+    rss: Option<(usize, usize)>,
+}
+
+impl StageTimer {
+    pub fn start(name: &str) -> Self {
+        Self { name: name.to_string(), rss: resident_memory(), allocations: allocations(), io: IO.stats(), start: Instant::now() }
+    }
+
+    /// Close the stage: `Ok(items)` on success, `Err(note)` if it failed
+    pub fn finish(self, result: Result<u64, String>) -> StageProfile {
+        let wall_ms = self.start.elapsed().as_secs_f64() * 1000.0;
+        let io = IO.stats().since(self.io);
+        let alloc = allocations().zip(self.allocations).map(|(now, before)| (now.0.saturating_sub(before.0), now.1.saturating_sub(before.1)));
+        let rss = resident_memory();
+        let rss_delta_bytes = rss.zip(self.rss).map(|(now, before)| now.0 as i64 - before.0 as i64);
+        let (ok, items, note) = match result {
+            Ok(items) => (true, items, None),
+            Err(e) => (false, 0, Some(e)),
+        };
+        StageProfile { name: self.name, ok, note, items, wall_ms, io, allocations: alloc.map(|a| a.0), allocated_bytes: alloc.map(|a| a.1), rss_delta_bytes, peak_rss_bytes: rss.map(|r| r.1) }
+    }
+
+    /// A stage that did not run
+    pub fn skipped(name: &str, why: &str) -> StageProfile {
+        StageProfile { name: name.to_string(), note: Some(why.to_string()), ..Default::default() }
+    }
+}
@@ -1,7 +1,332 @@
 use crate::backend::os::memory::Memory;
+use crate::backend::os::profile::{Op, IO};
 use rayon::prelude::*;
 use std::ffi::c_void;
-use windows::Win32::System::Memory::{VirtualQueryEx, MEMORY_BASIC_INFORMATION, MEM_COMMIT, PAGE_GUARD, PAGE_NOACCESS};
+use std::time::Instant;
+use windows::Win32::System::Memory::{VirtualQueryEx, MEMORY_BASIC_INFORMATION, MEM_COMMIT, MEM_IMAGE, MEM_MAPPED, MEM_PRIVATE, PAGE_GUARD, PAGE_NOACCESS};
+
+/// Byte values ordered from most to least common in x64 machine code.
+/// Bytes missing from this list are treated as the rarest and preferred as scan anchors.
+const COMMON_CODE_BYTES: [u8; 48] = [
+    0x00, 0xFF, 0x48, 0x8B, 0x89, 0xCC, 0x24, 0x0F, 0x4C, 0xE8, 0x85, 0x01, 0x44, 0x8D, 0x83, 0xC0, 0x74, 0x08, 0x10, 0x20, 0x45, 0x41, 0x49, 0x90, 0x33, 0xC3, 0x18, 0x28, 0x04, 0x0D, 0x05, 0x15, 0x30, 0x40, 0x5C, 0x75, 0xEB, 0x80, 0x02, 0x03, 0xF8, 0xC7, 0xB8, 0x38, 0xC1, 0x4D, 0x0B, 0x8E,
+];
+
+/// Rarity score of a byte value (higher = rarer in code sections)
+fn byte_rarity(byte: u8) -> usize {
+    COMMON_CODE_BYTES.iter().position(|&b| b == byte).unwrap_or(COMMON_CODE_BYTES.len())
+}
+
+/// A parsed AOB signature, pre-analyzed for fast matching.
+/// Instead of always anchoring on `pattern[0]`, the two rarest fixed bytes are used as anchors,
+/// so signatures starting with wildcards (or with very common bytes like `48`) still skip quickly.
+#[derive(Debug, Clone)]
+pub struct Pattern {
+    bytes: Vec<Option<u8>>,
+    /// (position, value) of the rarest fixed byte
+    primary: Option<(usize, u8)>,
+    /// (position, value) of the second rarest fixed byte at a different position
+    secondary: Option<(usize, u8)>,
+}
+
+impl Pattern {
+    pub fn new(bytes: Vec<Option<u8>>) -> Self {
+        let mut fixed: Vec<(usize, u8)> = bytes.iter().enumerate().filter_map(|(i, b)| b.map(|v| (i, v))).collect();
+        // Rarest first; for equal rarity prefer the later position (its loads stay farther from the buffer start)
+        fixed.sort_by(|a, b| byte_rarity(b.1).cmp(&byte_rarity(a.1)).then_with(|| b.0.cmp(&a.0)));
+
+        let primary = fixed.first().copied();
+        let secondary = fixed.get(1).copied();
+
+        Self { bytes, primary, secondary }
+    }
+
+    pub fn parse(signature: &str) -> Self {
+        Self::new(Scanner::parse_signature(signature))
+    }
+
+    pub fn len(&self) -> usize {
+        self.bytes.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.bytes.is_empty()
+    }
+
+    /// Name of the matching engine selected for this CPU at runtime
+    pub fn engine() -> &'static str {
+        #[cfg(target_arch = "x86_64")]
+        {
+            if is_x86_feature_detected!("avx2") {
+                "avx2"
+            } else {
+                "sse2"
+            }
+        }
+        #[cfg(not(target_arch = "x86_64"))]
+        {
+            "scalar"
+        }
+    }
+
+    /// Full comparison of the pattern against `buffer` starting at `pos`.
+    #[inline]
+    fn matches_at(&self, buffer: &[u8], pos: usize) -> bool {
+        let window = &buffer[pos..pos + self.bytes.len()];
+        self.bytes.iter().zip(window).all(|(p, &b)| match p {
+            Some(v) => *v == b,
+            None => true,
+        })
+    }
+
+    /// Return every offset in `buffer` where the pattern matches.
+    pub fn find_all(&self, buffer: &[u8]) -> Vec<usize> {
+        let mut matches = Vec::new();
+        if self.bytes.is_empty() || buffer.len() < self.bytes.len() {
+            return matches;
+        }
+
+        let last = buffer.len() - self.bytes.len();
+
+        // A pattern made only of wildcards matches everywhere
+        let Some(primary) = self.primary else {
+            matches.extend(0..=last);
+            return matches;
+        };
+        let secondary = self.secondary.unwrap_or(primary);
+
+        // SSE2 is part of the x86_64 baseline; AVX2 has to be detected at runtime
+        #[cfg(target_arch = "x86_64")]
+        let mut i = if is_x86_feature_detected!("avx2") { unsafe { self.scan_avx2(buffer, primary, secondary, &mut matches) } } else { unsafe { self.scan_sse2(buffer, primary, secondary, &mut matches) } };
+        #[cfg(not(target_arch = "x86_64"))]
+        let mut i = 0;
+
+        // Scalar tail (and the whole buffer on non-x86 targets)
+        while i <= last {
+            if buffer[i + primary.0] == primary.1 && buffer[i + secondary.0] == secondary.1 && self.matches_at(buffer, i) {
+                matches.push(i);
+            }
+            i += 1;
+        }
+
+        matches
+    }
+
+    /// Compare both anchors 32 candidates at a time. Returns the first index that still needs the scalar tail.
+    #[cfg(target_arch = "x86_64")]
+    #[target_feature(enable = "avx2")]
+    unsafe fn scan_avx2(&self, buffer: &[u8], primary: (usize, u8), secondary: (usize, u8), matches: &mut Vec<usize>) -> usize {
+        use std::arch::x86_64::*;
+        const LANES: usize = 32;
+
+        let last = buffer.len() - self.bytes.len();
+        let reach = primary.0.max(secondary.0) + LANES;
+        let ptr = buffer.as_ptr();
+        let needle_a = _mm256_set1_epi8(primary.1 as i8);
+        let needle_b = _mm256_set1_epi8(secondary.1 as i8);
+
+        let mut i = 0;
+        while i + reach <= buffer.len() {
+            let block_a = _mm256_loadu_si256(ptr.add(i + primary.0) as *const __m256i);
+            let block_b = _mm256_loadu_si256(ptr.add(i + secondary.0) as *const __m256i);
+            let hits = _mm256_and_si256(_mm256_cmpeq_epi8(block_a, needle_a), _mm256_cmpeq_epi8(block_b, needle_b));
+            let mut mask = _mm256_movemask_epi8(hits) as u32;
+
+            while mask != 0 {
+                let pos = i + mask.trailing_zeros() as usize;
+                if pos <= last && self.matches_at(buffer, pos) {
+                    matches.push(pos);
+                }
+                mask &= mask - 1;
+            }
+            i += LANES;
+        }
+        i
+    }
+
+    /// Compare both anchors 16 candidates at a time. Returns the first index that still needs the scalar tail.
+    #[cfg(target_arch = "x86_64")]
+    #[target_feature(enable = "sse2")]
+    unsafe fn scan_sse2(&self, buffer: &[u8], primary: (usize, u8), secondary: (usize, u8), matches: &mut Vec<usize>) -> usize {
+        use std::arch::x86_64::*;
+        const LANES: usize = 16;
+
+        let last = buffer.len() - self.bytes.len();
+        let reach = primary.0.max(secondary.0) + LANES;
+        let ptr = buffer.as_ptr();
+        let needle_a = _mm_set1_epi8(primary.1 as i8);
+        let needle_b = _mm_set1_epi8(secondary.1 as i8);
+
+        let mut i = 0;
+        while i + reach <= buffer.len() {
+            let block_a = _mm_loadu_si128(ptr.add(i + primary.0) as *const __m128i);
+            let block_b = _mm_loadu_si128(ptr.add(i + secondary.0) as *const __m128i);
+            let hits = _mm_and_si128(_mm_cmpeq_epi8(block_a, needle_a), _mm_cmpeq_epi8(block_b, needle_b));
+            let mut mask = _mm_movemask_epi8(hits) as u32;
+
+            while mask != 0 {
+                let pos = i + mask.trailing_zeros() as usize;
+                if pos <= last && self.matches_at(buffer, pos) {
+                    matches.push(pos);
+                }
+                mask &= mask - 1;
+            }
+            i += LANES;
+        }
+        i
+    }
+}
+
+/// Block size for multi-pattern matching. Every pattern runs over one L2-sized block before the next block
+/// is touched, so a region buffer streams through the cache once no matter how many signatures are registered.
+const PATTERN_SET_BLOCK: usize = 256 * 1024;
+
+/// Several signatures matched together in a single pass over a buffer
+#[derive(Debug, Clone)]
+pub struct PatternSet {
+    patterns: Vec<Pattern>,
+    max_len: usize,
+}
+
+impl PatternSet {
+    pub fn parse(signatures: &[&str]) -> Result<Self, String> {
+        let patterns: Vec<Pattern> = signatures.iter().map(|s| Pattern::parse(s)).collect();
+        if patterns.is_empty() || patterns.iter().any(|p| p.is_empty()) {
+            return Err("Invalid signature".to_string());
+        }
+        let max_len = patterns.iter().map(|p| p.len()).max().unwrap_or(1);
+        Ok(Self { patterns, max_len })
+    }
+
+    pub fn len(&self) -> usize {
+        self.patterns.len()
+    }
+
+    /// Length of the longest pattern; consecutive windows overlap by one byte less than this
+    pub fn max_len(&self) -> usize {
+        self.max_len
+    }
+
+    /// Return the hit offsets of every pattern, indexed like the input signatures.
+    pub fn find_all(&self, buffer: &[u8]) -> Vec<Vec<usize>> {
+        let mut results = vec![Vec::new(); self.patterns.len()];
+
+        let mut block_start = 0;
+        while block_start < buffer.len() {
+            let block_end = (block_start + PATTERN_SET_BLOCK).min(buffer.len());
+            // Overlap by the longest pattern so matches straddling the block edge are still seen
+            let window_end = (block_end + self.max_len - 1).min(buffer.len());
+            let window = &buffer[block_start..window_end];
+
+            for (hits, pattern) in results.iter_mut().zip(&self.patterns) {
+                // Only keep matches that start inside this block; the rest belong to the next one
+                hits.extend(pattern.find_all(window).into_iter().map(|offset| block_start + offset).take_while(|&pos| pos < block_end));
+            }
+
+            block_start = block_end;
+        }
+
+        results
+    }
+}
+
+/// Result of comparing the vectorized matcher against the legacy first-byte loop on the same buffer
+#[derive(Debug, Clone, serde::Serialize)]
+pub struct ScanBenchmark {
+    pub engine: &'static str,
+    pub buffer_size: usize,
+    /// Readable regions the buffers came from
+    pub regions: usize,
+    pub iterations: usize,
+    pub matches: usize,
+    pub naive_ms: f64,
+    pub vectorized_ms: f64,
+    pub speedup: f64,
+}
+
+/// Window a streaming scan reads at a time. Each worker keeps one such buffer (Memory's per-thread scratch),
+/// so a scan holds at most threads × (window + pattern) bytes however large the regions are.
+pub const SCAN_WINDOW: usize = 1024 * 1024;
+/// Windows per rayon batch and thread. Batches run in address order, which is what lets `max_hits` stop early
+/// and still return the lowest-addressed hits.
+const WINDOWS_PER_THREAD: usize = 4;
+
+const PAGE_WRITABLE: u32 = 0x04 | 0x08 | 0x40 | 0x80; // READWRITE, WRITECOPY, EXECUTE_READWRITE, EXECUTE_WRITECOPY
+const PAGE_EXECUTABLE: u32 = 0x10 | 0x20 | 0x40 | 0x80; // EXECUTE, EXECUTE_READ, EXECUTE_READWRITE, EXECUTE_WRITECOPY
+
+/// A committed, readable region as VirtualQueryEx reports it
+#[derive(Debug, Clone, Copy)]
+pub struct Region {
+    pub base: usize,
+    pub size: usize,
+    pub protect: u32,
+    /// MEM_IMAGE, MEM_MAPPED or MEM_PRIVATE
+    pub kind: u32,
+}
+
+/// Which regions a streaming scan visits. The default is every readable region of the user address space.
+#[derive(Debug, Clone, serde::Deserialize)]
+#[serde(default)]
+pub struct RegionFilter {
+    pub start: usize,
+    pub end: usize,
+    /// Some(true): only writable regions, Some(false): only read-only ones
+    pub writable: Option<bool>,
+    pub executable: Option<bool>,
+    /// Region types to include; all three by default
+    pub image: bool,
+    pub mapped: bool,
+    pub private: bool,
+}
+
+impl Default for RegionFilter {
+    fn default() -> Self {
+        Self { start: 0x10000, end: 0x7FFF_FFFF_0000, writable: None, executable: None, image: true, mapped: true, private: true }
+    }
+}
+
+impl RegionFilter {
+    /// Exactly `[start, end)`, any protection or type
+    pub fn range(start: usize, end: usize) -> Self {
+        Self { start, end, ..Default::default() }
+    }
+
+    fn accepts(&self, region: &Region) -> bool {
+        let kind_ok = match region.kind {
+            k if k == MEM_IMAGE.0 => self.image,
+            k if k == MEM_MAPPED.0 => self.mapped,
+            k if k == MEM_PRIVATE.0 => self.private,
+            _ => true,
+        };
+        kind_ok && self.writable.map_or(true, |w| w == (region.protect & PAGE_WRITABLE != 0)) && self.executable.map_or(true, |x| x == (region.protect & PAGE_EXECUTABLE != 0))
+    }
+}
+
+#[derive(Debug, Clone, Copy, serde::Deserialize)]
+#[serde(default)]
+pub struct ScanOptions {
+    /// Stop once every signature has this many hits; 0 scans everything
+    pub max_hits: usize,
+    /// Only report hits at multiples of this (8 for pointer values such as vtables)
+    pub align: usize,
+    pub window: usize,
+}
+
+impl Default for ScanOptions {
+    fn default() -> Self {
+        Self { max_hits: 0, align: 1, window: SCAN_WINDOW }
+    }
+}
+
+#[derive(Debug, Clone, Default, serde::Serialize)]
+pub struct ScanResult {
+    /// One ascending hit list per signature
+    pub hits: Vec<Vec<usize>>,
+    pub regions: usize,
+    pub bytes_scanned: u64,
+    /// `max_hits` was reached before the last region
+    pub stopped_early: bool,
+    pub elapsed_ms: f64,
+}
 
 pub struct Scanner;
 
@@ -11,8 +336,13 @@ impl Scanner {
         signature.split_whitespace().map(|s| if s == "?" || s == "??" { None } else { u8::from_str_radix(s, 16).ok() }).collect()
     }
 
-    /// Search for a byte pattern within a specific buffer. Highly optimized raw loop for max speed in both Dev and Release.
+    /// Search for a byte pattern within a specific buffer using the SIMD anchor matcher.
     pub fn find_pattern_in_buffer(buffer: &[u8], pattern: &[Option<u8>]) -> Vec<usize> {
+        Pattern::new(pattern.to_vec()).find_all(buffer)
+    }
+
+    /// Legacy byte-at-a-time matcher anchored on `pattern[0]`. Kept as the reference for `benchmark`.
+    pub fn find_pattern_in_buffer_naive(buffer: &[u8], pattern: &[Option<u8>]) -> Vec<usize> {
         let mut matches = Vec::new();
         if pattern.is_empty() || buffer.len() < pattern.len() {
             return matches;
@@ -58,20 +388,48 @@ impl Scanner {
         matches
     }
 
-    /// Scan a process's memory range for a given pattern
-    pub fn scan(memory: &Memory, start_address: usize, end_address: usize, signature: &str) -> Result<Vec<usize>, String> {
-        let pattern = Self::parse_signature(signature);
-        if pattern.is_empty() {
+    /// Microbenchmark: time the legacy loop and the vectorized matcher over the same buffers (one per readable region).
+    /// Fails if the two engines disagree, so it doubles as a correctness check on real binaries.
+    pub fn benchmark(buffers: &[Vec<u8>], signature: &str, iterations: usize) -> Result<ScanBenchmark, String> {
+        let bytes = Self::parse_signature(signature);
+        if bytes.is_empty() {
             return Err("Invalid signature".to_string());
         }
+        let iterations = iterations.max(1);
+        let pattern = Pattern::new(bytes.clone());
 
+        let naive_start = std::time::Instant::now();
+        let mut naive = Vec::new();
+        for _ in 0..iterations {
+            naive = buffers.iter().map(|buffer| Self::find_pattern_in_buffer_naive(buffer, &bytes)).collect::<Vec<_>>();
+        }
+        let naive_ms = naive_start.elapsed().as_secs_f64() * 1000.0 / iterations as f64;
+
+        let vectorized_start = std::time::Instant::now();
+        let mut vectorized = Vec::new();
+        for _ in 0..iterations {
+            vectorized = buffers.iter().map(|buffer| pattern.find_all(buffer)).collect::<Vec<_>>();
+        }
+        let vectorized_ms = vectorized_start.elapsed().as_secs_f64() * 1000.0 / iterations as f64;
+
+        let count = |hits: &[Vec<usize>]| hits.iter().map(Vec::len).sum::<usize>();
+        if naive != vectorized {
+            return Err(format!("Engine mismatch: naive found {} matches, {} found {}", count(&naive), Pattern::engine(), count(&vectorized)));
+        }
+
+        let speedup = if vectorized_ms > 0.0 { naive_ms / vectorized_ms } else { 0.0 };
+        Ok(ScanBenchmark { engine: Pattern::engine(), buffer_size: buffers.iter().map(Vec::len).sum(), regions: buffers.len(), iterations, matches: count(&vectorized), naive_ms, vectorized_ms, speedup })
+    }
+
+    /// Enumerate the committed, readable regions inside `[start_address, end_address)`, clipped to that range
+    pub fn readable_regions(memory: &Memory, start_address: usize, end_address: usize) -> Vec<Region> {
         let mut current_address = start_address;
-        let mut regions: Vec<(usize, usize)> = Vec::new();
+        let mut regions: Vec<Region> = Vec::new();
 
-        // Enumerate memory regions
         while current_address < end_address {
             let mut mem_info = MEMORY_BASIC_INFORMATION::default();
 
+            let started = std::time::Instant::now();
             let result = unsafe {
                 VirtualQueryEx(
                     memory.handle(), // We need to expose memory handle or let Memory do this
@@ -80,35 +438,89 @@ impl Scanner {
                     std::mem::size_of::<MEMORY_BASIC_INFORMATION>(),
                 )
             };
+            IO.record(Op::Query, started, 0, result != 0);
 
             if result == 0 {
                 break;
             }
 
+            // The query answers for the whole region holding current_address, which may start before it
+            let region_end = (mem_info.BaseAddress as usize).saturating_add(mem_info.RegionSize);
+            if region_end <= current_address {
+                break;
+            }
+
             // Check if memory is committed and readable
             // MEM_COMMIT = 0x1000, PAGE_NOACCESS = 0x01, PAGE_GUARD = 0x100
             if mem_info.State == MEM_COMMIT && (mem_info.Protect.0 & PAGE_NOACCESS.0) == 0 && (mem_info.Protect.0 & PAGE_GUARD.0) == 0 {
-                let region_size = mem_info.RegionSize as usize;
-                regions.push((current_address, region_size));
+                regions.push(Region { base: current_address, size: region_end.min(end_address) - current_address, protect: mem_info.Protect.0, kind: mem_info.Type.0 });
             }
 
-            current_address += mem_info.RegionSize as usize;
+            current_address = region_end;
         }
 
-        // Search each valid region in parallel
-        let results: Vec<usize> = regions
-            .into_par_iter()
-            .flat_map(|(base, size)| {
-                // Read the entire region
-                if let Ok(buffer) = memory.read_bytes(base, size) {
-                    // Search block for pattern
-                    Self::find_pattern_in_buffer(&buffer, &pattern).into_iter().map(move |offset| base + offset).collect::<Vec<usize>>()
-                } else {
-                    Vec::new()
+        regions
+    }
+
+    /// Scan a process's memory range for a given pattern
+    pub fn scan(memory: &Memory, start_address: usize, end_address: usize, signature: &str) -> Result<Vec<usize>, String> {
+        let mut results = Self::scan_many(memory, start_address, end_address, &[signature])?;
+        Ok(results.remove(0))
+    }
+
+    /// Scan a process's memory range for several signatures at once.
+    /// Regions are enumerated and read a single time; every signature is matched against each window.
+    /// Returns one (ascending) hit list per signature, in the same order as `signatures`.
+    pub fn scan_many(memory: &Memory, start_address: usize, end_address: usize, signatures: &[&str]) -> Result<Vec<Vec<usize>>, String> {
+        let set = PatternSet::parse(signatures)?;
+        Ok(Self::scan_regions(memory, &RegionFilter::range(start_address, end_address), &set, &ScanOptions::default()).hits)
+    }
+
+    /// Streaming scan over every region `filter` accepts.
+    /// Regions are cut into `options.window`-sized windows that overlap by the longest pattern, so a match across
+    /// a window edge is found exactly once (by the window it starts in) and no region is ever read whole.
+    pub fn scan_regions(memory: &Memory, filter: &RegionFilter, set: &PatternSet, options: &ScanOptions) -> ScanResult {
+        let start = Instant::now();
+        let regions: Vec<Region> = Self::readable_regions(memory, filter.start, filter.end).into_iter().filter(|r| filter.accepts(r)).collect();
+        let window = options.window.max(0x1000);
+        let overlap = set.max_len() - 1;
+        let align = options.align.max(1);
+
+        // (window start, bytes owned by the window, region end)
+        let windows: Vec<(usize, usize, usize)> = regions.iter().flat_map(|r| (r.base..r.base + r.size).step_by(window).map(move |w| (w, window.min(r.base + r.size - w), r.base + r.size))).collect();
+
+        let mut result = ScanResult { hits: vec![Vec::new(); set.len()], regions: regions.len(), ..Default::default() };
+        let batch = rayon::current_num_threads() * WINDOWS_PER_THREAD;
+        for (index, chunk) in windows.chunks(batch).enumerate() {
+            let per_window: Vec<Option<Vec<Vec<usize>>>> = chunk
+                .par_iter()
+                .map(|&(base, owned, region_end)| {
+                    // Read past the owned bytes (never past the region) so matches starting near the end are complete
+                    let len = (owned + overlap).min(region_end - base);
+                    memory.read_with(base, len, |buffer| set.find_all(buffer).into_iter().map(|hits| hits.into_iter().take_while(|&offset| offset < owned).map(|offset| base + offset).filter(|address| address % align == 0).collect()).collect())
+                })
+                .collect();
+
+            for (hits, &(_, owned, _)) in per_window.into_iter().zip(chunk) {
+                let Some(hits) = hits else { continue };
+                result.bytes_scanned += owned as u64;
+                for (merged, found) in result.hits.iter_mut().zip(hits) {
+                    merged.extend(found);
                 }
-            })
-            .collect();
+            }
+
+            if options.max_hits > 0 && result.hits.iter().all(|h| h.len() >= options.max_hits) {
+                result.stopped_early = (index + 1) * batch < windows.len();
+                break;
+            }
+        }
 
-        Ok(results)
+        if options.max_hits > 0 {
+            for hits in &mut result.hits {
+                hits.truncate(options.max_hits);
+            }
+        }
+        result.elapsed_ms = start.elapsed().as_secs_f64() * 1000.0;
+        result
     }
 }
@@ -0,0 +1,47 @@
+use std::borrow::Cow;
+
+// ═══════════════════════════════════════════════════════════════
+//  Text decoding for strings read out of process memory
+//  Every decoder stops at the first NUL. The common case, plain ASCII,
+//  borrows straight from the read buffer; only text that actually needs
+//  converting allocates.
+// ═══════════════════════════════════════════════════════════════
+
+#[inline]
+fn until_nul(bytes: &[u8]) -> &[u8] {
+    bytes.iter().position(|&b| b == 0).map_or(bytes, |end| &bytes[..end])
+}
+
+/// UTF-8, invalid sequences replaced with U+FFFD
+pub fn utf8(bytes: &[u8]) -> Cow<'_, str> {
+    String::from_utf8_lossy(until_nul(bytes))
+}
+
+/// Latin-1: every byte is the code point of the same value (UE's narrow FNameEntry / ANSICHAR)
+pub fn latin1(bytes: &[u8]) -> Cow<'_, str> {
+    let bytes = until_nul(bytes);
+    if bytes.is_ascii() {
+        // SAFETY: ASCII is valid UTF-8
+        Cow::Borrowed(unsafe { std::str::from_utf8_unchecked(bytes) })
+    } else {
+        Cow::Owned(bytes.iter().map(|&b| b as char).collect())
+    }
+}
+
+/// Append Latin-1 `bytes` to `out`
+#[inline]
+pub fn push_latin1(bytes: &[u8], out: &mut String) {
+    out.push_str(&latin1(bytes));
+}
+
+/// Append UTF-16LE `bytes` to `out`; unpaired surrogates become U+FFFD
+pub fn push_utf16le(bytes: &[u8], out: &mut String) {
+    let units = bytes.chunks_exact(2).map(|c| u16::from_le_bytes([c[0], c[1]])).take_while(|&u| u != 0);
+    out.extend(char::decode_utf16(units).map(|c| c.unwrap_or(char::REPLACEMENT_CHARACTER)));
+}
+
+pub fn utf16le(bytes: &[u8]) -> String {
+    let mut out = String::with_capacity(bytes.len() / 2);
+    push_utf16le(bytes, &mut out);
+    out
+}
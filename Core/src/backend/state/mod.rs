@@ -1,12 +1,17 @@
+use crate::backend::commands::api::{LiveStream, ReadPlan};
+use crate::backend::commands::cursor::ResultCursors;
+use crate::backend::commands::watch::Watchers;
 use crate::backend::os::process::Process;
 use crate::backend::unreal::autoconfig::AutoConfig;
 use crate::backend::unreal::name_pool::FNamePool;
 use crate::backend::unreal::object_array::ObjectManager;
-use std::sync::{Arc, Mutex};
+use crate::backend::unreal::offsets::UEOffset;
+use arc_swap::{ArcSwap, ArcSwapOption};
+use std::sync::Arc;
 
 /// Cached base addresses resolved by BaseAddressDumper.
 /// These are populated by commands in `base_address.rs` and consumed by other modules.
-#[derive(Default)]
+#[derive(Default, Clone)]
 pub struct BaseAddresses {
     pub fname_pool: Option<usize>,
     pub guobject_array: Option<usize>,
@@ -15,14 +20,28 @@ pub struct BaseAddresses {
 }
 
 /// The global application state for the memory scanner
+///
+/// Shared values are immutable snapshots behind atomic pointers: a command loads the
+/// current `Arc` once and works on it without holding anything, and a writer publishes a
+/// new snapshot with `store`. Inspector calls, API polling and searches therefore never
+/// wait on each other, only on the process they read.
 pub struct AppState {
-    pub process: Mutex<Option<Process>>,
-    pub auto_config: Mutex<Option<AutoConfig>>,
-    pub object_manager: Arc<ObjectManager>,
-    pub name_pool: Mutex<Option<Arc<FNamePool>>>,
+    pub process: ArcSwapOption<Process>,
+    pub auto_config: ArcSwapOption<AutoConfig>,
+    /// Replaced whole when a snapshot is loaded; cleared in place on attach
+    pub object_manager: ArcSwap<ObjectManager>,
+    pub name_pool: ArcSwapOption<FNamePool>,
     /// Resolved base addresses — written by `base_address` commands, read by all others.
-    pub base_addresses: Mutex<BaseAddresses>,
-    pub api_config: Mutex<Option<serde_json::Value>>,
+    pub base_addresses: ArcSwap<BaseAddresses>,
+    pub api_config: ArcSwapOption<serde_json::Value>,
+    /// `api_config` compiled for polling by /api/data and fetch_api_live_values
+    pub api_plan: ArcSwapOption<ReadPlan>,
+    /// Background sampler shared by /api/stream, /api/data and the ApiPanel
+    pub live_stream: Arc<LiveStream>,
+    /// Paged results handed out by open_cursor
+    pub cursors: ResultCursors,
+    /// Values sampled in the background by add_watch
+    pub watchers: Arc<Watchers>,
 }
 
 // Ensure AppState is Send + Sync for Tauri
@@ -31,6 +50,16 @@ unsafe impl Sync for AppState {}
 
 impl AppState {
     pub fn new() -> Self {
-        Self { process: Mutex::new(None), auto_config: Mutex::new(None), object_manager: Arc::new(ObjectManager::new()), name_pool: Mutex::new(None), base_addresses: Mutex::new(BaseAddresses::default()), api_config: Mutex::new(None) }
+        Self { process: ArcSwapOption::empty(), auto_config: ArcSwapOption::empty(), object_manager: ArcSwap::from_pointee(ObjectManager::new()), name_pool: ArcSwapOption::empty(), base_addresses: ArcSwap::from_pointee(BaseAddresses::default()), api_config: ArcSwapOption::empty(), api_plan: ArcSwapOption::empty(), live_stream: Arc::new(LiveStream::new()), cursors: ResultCursors::new(), watchers: Arc::new(Watchers::new()) }
+    }
+
+    /// The current object table
+    pub fn objects(&self) -> Arc<ObjectManager> {
+        self.object_manager.load_full()
+    }
+
+    /// Offsets of the current AutoConfig, or the defaults before one has run
+    pub fn offsets(&self) -> UEOffset {
+        self.auto_config.load().as_ref().map(|ac| ac.offsets.clone()).unwrap_or_default()
     }
 }
@@ -1,9 +1,59 @@
+use crate::backend::os::memory::{CachedMemory, PAGE_4K};
 use crate::backend::os::process::Process;
 use crate::backend::unreal::name_pool::FNamePool;
-use crate::backend::unreal::object_array::ObjectManager;
+use crate::backend::unreal::object_array::{ObjectData, ObjectManager};
 use crate::backend::unreal::offsets::UEOffset;
+use rayon::prelude::*;
+
+// ═══════════════════════════════════════════════════════════════
+//  AutoConfig — offset discovery as a small task graph
+//
+//    basic info ─► GameEngine/Pawn ─► Super + Member ─┬─► PropSize
+//                                                      └─► Offset ─► BitMask
+//
+//  Each stage runs its probe on several candidate objects in parallel and
+//  keeps the answer most of them agree on; a tie goes to the candidate the
+//  sequential C++ port looked at first, so a lone answer is the old one.
+//  Every read goes through one shared page cache: a header that several
+//  probes look at is fetched once and then scanned locally.
+// ═══════════════════════════════════════════════════════════════
+
+/// UObject header bytes the basic info probe looks at (FName/ID scan over 0x8..0x88, pointers at 0x8..=0x80)
+const HEADER_WINDOW: usize = 0x88;
+/// Objects at the head of GUObjectArray that vote on FNameIndex, ID, Outer and Class
+const BASIC_INFO_CANDIDATES: usize = 11;
+/// GameEngine/Pawn search: objects looked at, how many are probed together, and how many matches vote on Super/Member
+const ENGINE_SEARCH_LIMIT: usize = 5001;
+const ENGINE_SEARCH_BLOCK: usize = 256;
+const ENGINE_VOTERS: usize = 3;
+/// Members followed per class, and how many qualifying members vote on PropSize, Offset and BitMask per class
+const MEMBER_WALK_LIMIT: usize = 301;
+const MEMBER_VOTERS: usize = 3;
+
 pub struct AutoConfig {
     pub offsets: UEOffset,
+    pub source: OffsetSource,
+}
+
+/// Where the offsets in AppState came from
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum OffsetSource {
+    /// scan_basic_offsets in this session
+    Discovered,
+    /// Restored (and validated) from the build cache on attach
+    BuildCache,
+    /// Loaded with a snapshot, not checked against anything live
+    Snapshot,
+}
+
+impl OffsetSource {
+    pub fn label(self) -> &'static str {
+        match self {
+            Self::Discovered => "discovered in this session",
+            Self::BuildCache => "restored from build cache",
+            Self::Snapshot => "loaded from snapshot",
+        }
+    }
 }
 
 impl Default for AutoConfig {
@@ -12,240 +62,260 @@ impl Default for AutoConfig {
     }
 }
 
-impl AutoConfig {
-    pub fn new() -> Self {
-        Self { offsets: UEOffset::default() }
-    }
-
-    /// Helper mirroring DumperUtils::CheckValue for FName strings.
-    /// Scans a memory chunk for a 4-byte ID that resolves to an FName containing (or exactly matching) `expected_name`.
-    pub fn scan_memory_for_fname(process: &Process, name_pool: &FNamePool, start_address: usize, size: usize, expected_name: &str, exact_match: bool) -> Option<usize> {
-        if start_address == 0 {
-            return None;
-        }
-
-        let buffer = process.memory.read_bytes(start_address, size).ok()?;
+/// What the probes of one discovery run share
+struct Probe<'a> {
+    process: &'a Process,
+    mem: CachedMemory<'a>,
+    names: &'a FNamePool,
+    objects: &'a ObjectManager,
+}
 
-        for i in (0..size).step_by(4) {
-            if i + 4 > buffer.len() {
-                break;
-            }
+impl Probe<'_> {
+    fn window(&self, address: usize, size: usize) -> Option<Vec<u8>> {
+        let mut bytes = vec![0u8; size];
+        (address != 0 && self.mem.read_exact(address, &mut bytes)).then_some(bytes)
+    }
 
-            let id_val = u32::from_le_bytes(buffer[i..i + 4].try_into().unwrap());
+    fn name_at(&self, address: usize) -> Option<&str> {
+        self.names.name(self.process, self.mem.try_read::<u32>(address)?).ok()
+    }
 
-            if let Ok(name_str) = name_pool.get_name(process, id_val) {
-                if !name_str.is_empty() {
-                    let matches = if exact_match { name_str == expected_name } else { name_str.contains(expected_name) };
+    fn object(&self, address: usize, offsets: &UEOffset) -> Option<ObjectData> {
+        self.objects.probe_object(address, self.process, &self.mem, self.names, offsets)
+    }
 
-                    if matches {
-                        return Some(start_address + i);
-                    }
-                }
+    /// Members of the class at `class_address`, in chain order, with their probed type names
+    fn member_chain(&self, offsets: &UEOffset, class_address: usize) -> Vec<(usize, String)> {
+        let Some(mut member_entry) = self.mem.try_read_pointer(class_address.wrapping_add(offsets.member)) else { return Vec::new() };
+        let mut addresses = Vec::new();
+        // Following the links is sequential; probing what they point at is not
+        for _ in 0..MEMBER_WALK_LIMIT {
+            addresses.push(member_entry);
+            match self.mem.try_read_pointer(member_entry.wrapping_add(offsets.next_member)) {
+                Some(next) => member_entry = next,
+                None => break,
             }
         }
-        None
+        addresses.into_par_iter().map(|a| (a, self.object(a, offsets).map(|o| o.type_name).unwrap_or_default())).collect()
     }
+}
 
-    /// Helper mirroring DumperUtils::CheckValue for integer Types.
-    /// Scans a memory chunk for an integer value `expected_val` or within a range `[expected_val, max_val]`.
-    pub fn scan_memory_for_int(process: &Process, start_address: usize, size: usize, expected_val: u32, max_val: Option<u32>, bytes_type: usize) -> Option<usize> {
-        if start_address == 0 {
-            return None;
+/// The proposal most voters made, with its vote count and the number of voters; a tie goes to the earliest proposal
+fn vote<T: PartialEq>(proposals: impl IntoIterator<Item = T>) -> Option<(T, usize, usize)> {
+    let mut tally: Vec<(T, usize)> = Vec::new();
+    let mut voters = 0;
+    for proposal in proposals {
+        voters += 1;
+        match tally.iter_mut().find(|(p, _)| *p == proposal) {
+            Some((_, n)) => *n += 1,
+            None => tally.push((proposal, 1)),
         }
-
-        let buffer = process.memory.read_bytes(start_address, size).ok()?;
-
-        for i in (0..size).step_by(bytes_type) {
-            if i + bytes_type > buffer.len() {
-                break;
-            }
-
-            let val = match bytes_type {
-                2 => u16::from_le_bytes(buffer[i..i + 2].try_into().unwrap()) as u32,
-                4 => u32::from_le_bytes(buffer[i..i + 4].try_into().unwrap()),
-                8 => u64::from_le_bytes(buffer[i..i + 8].try_into().unwrap()) as u32,
-                _ => return None,
-            };
-
-            if let Some(upper) = max_val {
-                if val >= expected_val && upper >= expected_val && upper >= val {
-                    return Some(start_address + i);
-                }
-            } else if val == expected_val {
-                return Some(start_address + i);
-            }
+    }
+    let mut best: Option<(T, usize)> = None;
+    for (proposal, n) in tally {
+        if best.as_ref().map_or(true, |(_, b)| n > *b) {
+            best = Some((proposal, n));
         }
-        None
     }
+    best.map(|(p, n)| (p, n, voters))
+}
 
-    /// Port of C++ FindBasicInfoOffset to find FNameIndex, ID, Outer, Class offsets
-    pub fn find_basic_info_offset(&mut self, process: &Process, name_pool: &FNamePool, gu_object_base: usize, element_size: usize) -> Result<(), String> {
-        let mut found_outer = false;
-        let mut found_class = false;
+/// What one GameEngine/Pawn candidate says about Super and the member chain
+#[derive(Clone, Copy, PartialEq)]
+struct SuperMember {
+    super_struct: Option<usize>,
+    /// (Member, NextMember, MemberFNameIndex)
+    member: Option<(usize, usize, usize)>,
+}
 
-        let object_array_entry = process.memory.read_pointer(gu_object_base.wrapping_add(0x10)).map_err(|e| format!("Failed to read GUObjectArray entry: {}", e))?;
+impl AutoConfig {
+    pub fn new() -> Self {
+        Self { offsets: UEOffset::default(), source: OffsetSource::Discovered }
+    }
 
-        for i in 0..=10 {
-            let chunk_ptr = process.memory.read_pointer(object_array_entry).unwrap_or(0);
-            if chunk_ptr == 0 {
-                continue;
-            }
+    /// Helper mirroring DumperUtils::CheckValue for FName strings.
+    /// Position in `window` of the first 4-byte ID that resolves to an FName containing (or exactly matching) `expected_name`.
+    pub fn scan_memory_for_fname(process: &Process, name_pool: &FNamePool, window: &[u8], expected_name: &str, exact_match: bool) -> Option<usize> {
+        window
+            .chunks_exact(4)
+            .position(|id| {
+                let id_val = u32::from_le_bytes(id.try_into().unwrap());
+                name_pool.name(process, id_val).is_ok_and(|name_str| !name_str.is_empty() && if exact_match { name_str == expected_name } else { name_str.contains(expected_name) })
+            })
+            .map(|i| i * 4)
+    }
 
-            let object_entry = process.memory.read_pointer(chunk_ptr.wrapping_add(i * element_size)).unwrap_or(0);
-            if object_entry == 0 {
-                continue;
-            }
+    /// Helper mirroring DumperUtils::CheckValue for integer Types.
+    /// Position in `window` of an integer equal to `expected_val`, or within `[expected_val, max_val]`.
+    pub fn scan_memory_for_int(window: &[u8], expected_val: u32, max_val: Option<u32>, bytes_type: usize) -> Option<usize> {
+        if ![2, 4, 8].contains(&bytes_type) {
+            return None;
+        }
+        window
+            .chunks_exact(bytes_type)
+            .position(|chunk| {
+                let val = match bytes_type {
+                    2 => u16::from_le_bytes(chunk.try_into().unwrap()) as u32,
+                    4 => u32::from_le_bytes(chunk.try_into().unwrap()),
+                    _ => u64::from_le_bytes(chunk.try_into().unwrap()) as u32,
+                };
+                match max_val {
+                    Some(upper) => val >= expected_val && upper >= expected_val && upper >= val,
+                    None => val == expected_val,
+                }
+            })
+            .map(|i| i * bytes_type)
+    }
 
-            // 1. Find FNameIndex (look for string "Object" in the object_entry + 0x8 to 0x88)
-            let search_start = object_entry.wrapping_add(0x8);
-            let search_size = 0x80;
+    /// Port of C++ FindBasicInfoOffset to find FNameIndex, ID, Outer, Class offsets, voted over the head of GUObjectArray
+    fn find_basic_info_offset(&mut self, probe: &Probe, gu_object_base: usize, element_size: usize) -> Result<(), String> {
+        let object_array_entry = probe.process.memory.read_pointer(gu_object_base.wrapping_add(0x10)).map_err(|e| format!("Failed to read GUObjectArray entry: {}", e))?;
+        let chunk_ptr = probe.mem.try_read_pointer(object_array_entry).unwrap_or(0);
+        if chunk_ptr == 0 {
+            return Ok(());
+        }
 
-            if let Some(name_address) = Self::scan_memory_for_fname(process, name_pool, search_start, search_size, "Object", true) {
-                self.offsets.fname_index = name_address - object_entry;
+        // (index, header) of every readable candidate, in index order
+        let candidates: Vec<(usize, Vec<u8>)> = (0..BASIC_INFO_CANDIDATES)
+            .into_par_iter()
+            .filter_map(|i| {
+                let object_entry = probe.mem.try_read_pointer(chunk_ptr.wrapping_add(i * element_size)).filter(|&p| p != 0)?;
+                Some((i, probe.window(object_entry, HEADER_WINDOW)?))
+            })
+            .collect();
+
+        // 1. FNameIndex: where "Object" keeps the ID of its name
+        let Some((fname_index, ..)) = vote(candidates.iter().filter_map(|(_, header)| Self::scan_memory_for_fname(probe.process, probe.names, &header[0x8..], "Object", true).map(|at| at + 0x8))) else {
+            return Ok(());
+        };
+        self.offsets.fname_index = fname_index;
 
-                // 2. Find Object ID (look for integer i in the same area)
-                if let Some(id_address) = Self::scan_memory_for_int(process, search_start, search_size, i as u32, None, 4) {
-                    self.offsets.id = id_address - object_entry;
-                }
+        // 2. Object ID: the slot holding each candidate's own index
+        if let Some((id, ..)) = vote(candidates.iter().filter_map(|(i, header)| Self::scan_memory_for_int(&header[0x8..], *i as u32, None, 4).map(|at| at + 0x8))) {
+            self.offsets.id = id;
+        }
 
-                // 3. Find Outer and Class by scanning pointer members
+        // 3. Outer and Class: the pointer members naming a Core package and a Class
+        let links: Vec<(Option<usize>, Option<usize>)> = candidates
+            .par_iter()
+            .map(|(_, header)| {
+                let (mut outer, mut class) = (None, None);
                 for j in (0x8..=0x80).step_by(0x8) {
-                    let sub_object_entry = process.memory.read_pointer(object_entry.wrapping_add(j)).unwrap_or(0);
-
+                    let sub_object_entry = usize::from_le_bytes(header[j..j + 8].try_into().unwrap());
                     if sub_object_entry > 0x10000 && sub_object_entry < 0x0000_7FFF_FFFF_FFFF {
-                        if let Ok(temp_fname_id) = process.memory.read::<u32>(sub_object_entry.wrapping_add(self.offsets.fname_index)) {
-                            if let Ok(temp_fname_str) = name_pool.get_name(process, temp_fname_id) {
-                                if temp_fname_str.contains("Core") {
-                                    self.offsets.outer = j;
-                                    found_outer = true;
-                                } else if temp_fname_str.contains("Class") {
-                                    self.offsets.class = j;
-                                    found_class = true;
-                                }
+                        if let Some(temp_fname_str) = probe.name_at(sub_object_entry.wrapping_add(fname_index)) {
+                            if temp_fname_str.contains("Core") {
+                                outer = Some(j);
+                            } else if temp_fname_str.contains("Class") {
+                                class = Some(j);
                             }
                         }
                     }
-
-                    if found_outer && found_class {
+                    if outer.is_some() && class.is_some() {
                         break;
                     }
                 }
-            }
-
-            if found_outer && found_class {
-                break;
-            }
+                (outer, class)
+            })
+            .collect();
+        if let Some((outer, ..)) = vote(links.iter().filter_map(|l| l.0)) {
+            self.offsets.outer = outer;
+        }
+        if let Some((class, ..)) = vote(links.iter().filter_map(|l| l.1)) {
+            self.offsets.class = class;
         }
 
         Ok(())
     }
 
-    /// Port of C++ FindSuperAndMemberOffset
-    pub fn find_super_and_member_offset(&mut self, process: &Process, name_pool: &FNamePool, object_manager: &ObjectManager, game_engine_object_address: usize) -> Result<usize, String> {
-        let mut engine_or_actor_address = 0;
-        let mut found_super = false;
-        let mut found_next_member = false;
-        let check_level = 2;
+    /// GameEngine/Pawn objects among the first ENGINE_SEARCH_LIMIT, in index order; probed a block at a time until enough are found
+    fn find_engine_candidates(&self, probe: &Probe, gu_object_base: usize, element_size: usize) -> Result<Vec<usize>, String> {
+        let object_array_entry = probe.process.memory.read_pointer(gu_object_base.wrapping_add(0x10)).map_err(|e| format!("Failed to read GUObjectArray entry: {}", e))?;
+
+        let mut found = Vec::new();
+        for block in (0..ENGINE_SEARCH_LIMIT).step_by(ENGINE_SEARCH_BLOCK) {
+            let hits: Vec<usize> = (block..(block + ENGINE_SEARCH_BLOCK).min(ENGINE_SEARCH_LIMIT))
+                .into_par_iter()
+                .filter_map(|i| {
+                    let chunk_ptr = probe.mem.try_read_pointer(object_array_entry.wrapping_add((i / 65536) * 8)).filter(|&p| p != 0)?;
+                    let object_entry = probe.mem.try_read_pointer(chunk_ptr.wrapping_add((i % 65536) * element_size)).filter(|&p| p != 0)?;
+                    let obj = probe.object(object_entry, &self.offsets)?;
+                    (obj.full_name.contains("Engine.GameEngine") || obj.full_name.contains("Engine.Pawn")).then_some(object_entry)
+                })
+                .collect();
+            found.extend(hits);
+            if found.len() >= ENGINE_VOTERS {
+                break;
+            }
+        }
+        found.truncate(ENGINE_VOTERS);
+        Ok(found)
+    }
 
-        println!("===========================================================");
-        println!("[FindSuperAndMemberOffset]");
-        println!("-----------------------------------------------------------");
-
-        println!("game_engine_object_address: {:#x}", game_engine_object_address);
-        let start_offset = self.offsets.outer + 0x8;
-        for i in (start_offset..0x100).step_by(0x8) {
-            let sub_object_entry = match process.memory.read_pointer(game_engine_object_address.wrapping_add(i)) {
-                Ok(ptr) => ptr,
-                Err(_) => continue,
-            };
-
-            println!("[super/member] i: {:#x}", i);
-            if let Some(temp_obj) = object_manager.try_save_object(sub_object_entry, process, name_pool, &self.offsets, 0, 5, true) {
-                println!("temp_obj: {:#x}", temp_obj.address);
-                println!("type_name: {}", temp_obj.type_name);
+    /// Port of C++ FindSuperAndMemberOffset for one candidate: what it proposes, and the Super (Engine or Actor) address, 0 if none.
+    /// Every pointer slot of the header is followed at once; the first hit in slot order wins, as in the sequential scan.
+    fn find_super_and_member_offset(probe: &Probe, offsets: &UEOffset, game_engine_object_address: usize) -> (SuperMember, usize) {
+        let start_offset = offsets.outer + 0x8;
+        let slots = 0x100usize.saturating_sub(start_offset).div_ceil(0x8);
+        let hits: Vec<(usize, Option<usize>, Option<(usize, usize)>)> = (0..slots)
+            .into_par_iter()
+            .filter_map(|slot| {
+                let i = start_offset + slot * 0x8;
+                let sub_object_entry = probe.mem.try_read_pointer(game_engine_object_address.wrapping_add(i))?;
+                let temp_obj = probe.object(sub_object_entry, offsets)?;
                 // Condition 1: find Super
-                if !found_super && (temp_obj.full_name.contains("Engine.Engine") || temp_obj.full_name.contains("Engine.Actor")) {
-                    self.offsets.super_struct = i;
-                    found_super = true;
-                    engine_or_actor_address = sub_object_entry;
-                }
-
+                let super_address = (temp_obj.full_name.contains("Engine.Engine") || temp_obj.full_name.contains("Engine.Actor")).then_some(sub_object_entry);
                 // Condition 2: find Member, NextMember
-                if !found_next_member && (temp_obj.type_name.contains("Property") || temp_obj.type_name.contains("Enum")) && !temp_obj.full_name.contains("Core") && !temp_obj.type_name.contains("Function") {
-                    let mut found_member_fname_index = false;
-                    for j in (self.offsets.fname_index..0x100).step_by(0x8) {
-                        let mut member_entry_ptr = match process.memory.read_pointer(sub_object_entry.wrapping_add(j)) {
-                            Ok(ptr) => ptr,
-                            Err(_) => continue,
-                        };
-                        println!("[next member] j: {:#x}", j);
-                        println!("member_entry_ptr: {:#x}", member_entry_ptr);
-                        for k in 1..=check_level {
-                            if let Some(member_obj) = object_manager.try_save_object(member_entry_ptr, process, name_pool, &self.offsets, 0, 5, true) {
-                                println!("type_name: {}", member_obj.type_name);
-                                if (!member_obj.type_name.contains("Property") && !member_obj.type_name.contains("ScriptStruct") && !member_obj.type_name.contains("State")) || member_obj.full_name.contains("Core") || member_obj.type_name.contains("Function") {
-                                    break;
-                                }
-                                println!("[check_level] k: {}", k);
-                                if !found_member_fname_index {
-                                    for n in (self.offsets.fname_index + 0x8..=0x50).step_by(0x8) {
-                                        println!("[member_fname_index] n: {:#x}", n);
-                                        if let Ok(temp_fname_id) = process.memory.read::<u32>(member_entry_ptr.wrapping_add(n)) {
-                                            if let Ok(name_str) = name_pool.get_name(process, temp_fname_id) {
-                                                println!("name_str: {}", name_str);
-                                                if let Ok(number) = process.memory.read::<u32>(member_entry_ptr.wrapping_add(n.wrapping_add(4))) {
-                                                    // Strict string validation to avoid false positives
-                                                    if number == 0 && !name_str.is_empty() && name_str.is_ascii() && !name_str.contains("None") && name_str.len() >= 2 {
-                                                        self.offsets.member_fname_index = n;
-                                                        found_member_fname_index = true;
-                                                        break;
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-
-                                let temp_fname_id = process.memory.read::<u32>(member_entry_ptr.wrapping_add(self.offsets.member_fname_index)).unwrap_or(0);
-                                let name_str = name_pool.get_name(process, temp_fname_id).unwrap_or_default();
-                                if name_str.is_empty() || !name_str.is_ascii() || name_str.len() < 2 {
-                                    break;
-                                }
-
-                                if k == check_level {
-                                    self.offsets.next_member = j;
-                                    self.offsets.member = i;
-                                    found_next_member = true;
-                                    break;
-                                }
-
-                                if let Ok(next_ptr) = process.memory.read_pointer(member_entry_ptr.wrapping_add(j)) {
-                                    member_entry_ptr = next_ptr;
-                                } else {
-                                    break;
-                                }
-                            } else {
-                                break;
-                            }
-                        }
+                let is_member_owner = (temp_obj.type_name.contains("Property") || temp_obj.type_name.contains("Enum")) && !temp_obj.full_name.contains("Core") && !temp_obj.type_name.contains("Function");
+                let member = if is_member_owner { Self::find_next_member(probe, offsets, sub_object_entry) } else { None };
+                Some((i, super_address, member))
+            })
+            .collect();
+
+        let super_hit = hits.iter().find_map(|&(i, s, _)| s.map(|address| (i, address)));
+        let member = hits.iter().find_map(|&(i, _, m)| m.map(|(next_member, member_fname_index)| (i, next_member, member_fname_index)));
+        (SuperMember { super_struct: super_hit.map(|(i, _)| i), member }, super_hit.map_or(0, |(_, address)| address))
+    }
 
-                        if found_next_member {
+    /// Inner loop of FindSuperAndMemberOffset: the header slot `j` through which two members chain from `owner`, and the MemberFNameIndex found on the way
+    fn find_next_member(probe: &Probe, offsets: &UEOffset, owner: usize) -> Option<(usize, usize)> {
+        let check_level = 2;
+        // Later probes in this walk decode member names with the MemberFNameIndex found on the way
+        let mut offsets = offsets.clone();
+        let mut found_member_fname_index = false;
+        for j in (offsets.fname_index..0x100).step_by(0x8) {
+            let Some(mut member_entry_ptr) = probe.mem.try_read_pointer(owner.wrapping_add(j)) else { continue };
+            for k in 1..=check_level {
+                let Some(member_obj) = probe.object(member_entry_ptr, &offsets) else { break };
+                if (!member_obj.type_name.contains("Property") && !member_obj.type_name.contains("ScriptStruct") && !member_obj.type_name.contains("State")) || member_obj.full_name.contains("Core") || member_obj.type_name.contains("Function") {
+                    break;
+                }
+                if !found_member_fname_index {
+                    for n in (offsets.fname_index + 0x8..=0x50).step_by(0x8) {
+                        let Some(name_str) = probe.name_at(member_entry_ptr.wrapping_add(n)) else { continue };
+                        // Strict string validation to avoid false positives
+                        if probe.mem.try_read::<u32>(member_entry_ptr.wrapping_add(n + 4)) == Some(0) && !name_str.is_empty() && name_str.is_ascii() && !name_str.contains("None") && name_str.len() >= 2 {
+                            offsets.member_fname_index = n;
+                            found_member_fname_index = true;
                             break;
                         }
                     }
                 }
 
-                if found_super && found_next_member {
+                let name_str = probe.name_at(member_entry_ptr.wrapping_add(offsets.member_fname_index)).unwrap_or_default();
+                if name_str.is_empty() || !name_str.is_ascii() || name_str.len() < 2 {
                     break;
                 }
+                if k == check_level {
+                    return Some((j, offsets.member_fname_index));
+                }
+                match probe.mem.try_read_pointer(member_entry_ptr.wrapping_add(j)) {
+                    Some(next_ptr) => member_entry_ptr = next_ptr,
+                    None => break,
+                }
             }
         }
-
-        if engine_or_actor_address == 0 {
-            return Err("Failed to find Super Address (Engine or Actor)".to_string());
-        }
-
-        Ok(engine_or_actor_address)
+        None
     }
 
     fn get_type_size(type_name: &str) -> u32 {
@@ -260,170 +330,116 @@ impl AutoConfig {
         }
     }
 
-    pub fn find_property_size_offset(&mut self, process: &Process, name_pool: &FNamePool, object_manager: &ObjectManager, engine_or_actor_address: usize) {
-        let mut member_entry = match process.memory.read_pointer(engine_or_actor_address.wrapping_add(self.offsets.member)) {
-            Ok(ptr) => ptr,
-            Err(_) => return,
-        };
-
-        let mut found_obj = false;
-        let mut target_type_size = 0;
-
-        for _ in 0..=300 {
-            if let Some(temp_obj) = object_manager.try_save_object(member_entry, process, name_pool, &self.offsets, 0, 5, true) {
-                if temp_obj.type_name.contains("ObjectProperty") {
-                    found_obj = true;
-                    target_type_size = Self::get_type_size(&temp_obj.type_name);
-                    break;
-                }
-            }
-            if let Ok(next_ptr) = process.memory.read_pointer(member_entry.wrapping_add(self.offsets.next_member)) {
-                member_entry = next_ptr;
-            } else {
-                break;
-            }
-        }
-
-        if !found_obj || target_type_size == 0 {
-            return;
-        }
-
-        let search_start = member_entry.wrapping_add(self.offsets.outer).wrapping_add(0x8);
-        if let Some(prop_size_address) = Self::scan_memory_for_int(process, search_start, 0x100, target_type_size, None, 2) {
-            self.offsets.prop_size = prop_size_address - member_entry;
-        }
+    /// The first MEMBER_VOTERS members of each chain whose type passes `accept`, chain by chain
+    fn voters<'c>(chains: &'c [Vec<(usize, String)>], accept: impl Fn(&str) -> bool + Copy + 'c) -> impl Iterator<Item = &'c (usize, String)> + 'c {
+        chains.iter().flat_map(move |chain| chain.iter().filter(move |(_, t)| accept(t)).take(MEMBER_VOTERS))
     }
 
-    pub fn find_offset_offset(&mut self, process: &Process, name_pool: &FNamePool, object_manager: &ObjectManager, engine_or_actor_address: usize) {
-        let mut member_entry = match process.memory.read_pointer(engine_or_actor_address.wrapping_add(self.offsets.member)) {
-            Ok(ptr) => ptr,
-            Err(_) => return,
-        };
-
-        let mut found_obj = false;
-        let mut target_type_size = 0;
-
-        for _ in 0..=300 {
-            if let Some(temp_obj) = object_manager.try_save_object(member_entry, process, name_pool, &self.offsets, 0, 5, true) {
-                if temp_obj.type_name.contains("ObjectProperty") || temp_obj.type_name.contains("ClassProperty") || temp_obj.type_name.contains("FloatProperty") || temp_obj.type_name.contains("IntProperty") {
-                    found_obj = true;
-                    target_type_size = Self::get_type_size(&temp_obj.type_name);
-                    break;
-                }
-            }
-            if let Ok(next_ptr) = process.memory.read_pointer(member_entry.wrapping_add(self.offsets.next_member)) {
-                member_entry = next_ptr;
-            } else {
-                break;
-            }
-        }
-
-        if !found_obj {
-            return;
-        }
-
-        let next_member_entry = match process.memory.read_pointer(member_entry.wrapping_add(self.offsets.next_member)) {
-            Ok(ptr) => ptr,
-            Err(_) => return,
-        };
+    /// PropSize: where an ObjectProperty keeps its size (8)
+    fn find_property_size_offset(probe: &Probe, offsets: &UEOffset, chains: &[Vec<(usize, String)>]) -> Option<usize> {
+        let members: Vec<&(usize, String)> = Self::voters(chains, |t| t.contains("ObjectProperty")).collect();
+        let proposals: Vec<Option<usize>> = members
+            .par_iter()
+            .map(|(member_entry, type_name)| {
+                let target_type_size = Self::get_type_size(type_name);
+                let search_start = member_entry.wrapping_add(offsets.outer).wrapping_add(0x8);
+                let window = probe.window(search_start, 0x100)?;
+                Self::scan_memory_for_int(&window, target_type_size, None, 2).map(|at| search_start + at - member_entry)
+            })
+            .collect();
+        vote(proposals.into_iter().flatten()).map(|(prop_size, ..)| prop_size)
+    }
 
-        for i in (self.offsets.next_member + 0x8..=0x100).step_by(2) {
-            if let Ok(temp_int_1) = process.memory.read::<u16>(member_entry.wrapping_add(i)) {
-                if let Ok(temp_int_2) = process.memory.read::<u16>(next_member_entry.wrapping_add(i)) {
+    /// Offset: the u16 slot where a member's offset plus its size is the next member's offset
+    fn find_offset_offset(probe: &Probe, offsets: &UEOffset, chains: &[Vec<(usize, String)>]) -> Option<usize> {
+        let members: Vec<&(usize, String)> = Self::voters(chains, |t| t.contains("ObjectProperty") || t.contains("ClassProperty") || t.contains("FloatProperty") || t.contains("IntProperty")).collect();
+        let proposals: Vec<Option<usize>> = members
+            .par_iter()
+            .map(|&&(member_entry, ref type_name)| {
+                let target_type_size = Self::get_type_size(type_name);
+                let next_member_entry = probe.mem.try_read_pointer(member_entry.wrapping_add(offsets.next_member))?;
+                (offsets.next_member + 0x8..=0x100).step_by(2).find(|&i| {
+                    let (Some(temp_int_1), Some(temp_int_2)) = (probe.mem.try_read::<u16>(member_entry.wrapping_add(i)), probe.mem.try_read::<u16>(next_member_entry.wrapping_add(i))) else { return false };
                     let next_val_expected = (temp_int_1 as u32) + target_type_size;
-                    if next_val_expected >= 0x20 && next_val_expected == (temp_int_2 as u32) {
-                        self.offsets.offset = i;
-                        break;
-                    }
-                }
-            }
-        }
+                    next_val_expected >= 0x20 && next_val_expected == (temp_int_2 as u32)
+                })
+            })
+            .collect();
+        vote(proposals.into_iter().flatten()).map(|(offset, ..)| offset)
     }
 
-    pub fn find_bit_mask_offset(&mut self, process: &Process, name_pool: &FNamePool, object_manager: &ObjectManager, actor_address: usize) {
-        let mut member_entry = match process.memory.read_pointer(actor_address.wrapping_add(self.offsets.member)) {
-            Ok(ptr) => ptr,
-            Err(_) => return,
-        };
-
-        let mut found_obj = false;
-        let mut next_member_entry = 0;
-
-        for _ in 0..=300 {
-            if let Some(temp_obj) = object_manager.try_save_object(member_entry, process, name_pool, &self.offsets, 0, 5, true) {
-                if temp_obj.type_name.contains("BoolProperty") {
-                    if let Ok(next) = process.memory.read_pointer(member_entry.wrapping_add(self.offsets.next_member)) {
-                        next_member_entry = next;
-
-                        if let Ok(temp_int_1) = process.memory.read::<u16>(member_entry.wrapping_add(self.offsets.offset)) {
-                            if let Ok(temp_int_2) = process.memory.read::<u16>(next_member_entry.wrapping_add(self.offsets.offset)) {
-                                if temp_int_1 == temp_int_2 {
-                                    found_obj = true;
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            if let Ok(next) = process.memory.read_pointer(member_entry.wrapping_add(self.offsets.next_member)) {
-                member_entry = next;
-            } else {
-                break;
-            }
-        }
-
-        if !found_obj {
-            return;
-        }
-
-        for i in 0x70..=0x100 {
-            if let Ok(byte_1) = process.memory.read::<u8>(member_entry.wrapping_add(i)) {
-                if let Ok(byte_2) = process.memory.read::<u8>(next_member_entry.wrapping_add(i)) {
-                    if byte_1 == 1 && byte_2 % 2 == 0 && byte_1 < byte_2 {
-                        self.offsets.bit_mask = i;
-                        break;
-                    }
-                }
-            }
-        }
+    /// BitMask: the byte where the first of two bitfield bools sharing a byte has mask 1 and the second a higher one
+    fn find_bit_mask_offset(probe: &Probe, offsets: &UEOffset, chains: &[Vec<(usize, String)>]) -> Option<usize> {
+        let pairs: Vec<(usize, usize)> = chains
+            .par_iter()
+            .flat_map_iter(|chain| {
+                chain
+                    .iter()
+                    .filter(|(_, t)| t.contains("BoolProperty"))
+                    .filter_map(|&(member_entry, _)| {
+                        let next_member_entry = probe.mem.try_read_pointer(member_entry.wrapping_add(offsets.next_member))?;
+                        let temp_int_1 = probe.mem.try_read::<u16>(member_entry.wrapping_add(offsets.offset))?;
+                        let temp_int_2 = probe.mem.try_read::<u16>(next_member_entry.wrapping_add(offsets.offset))?;
+                        (temp_int_1 == temp_int_2).then_some((member_entry, next_member_entry))
+                    })
+                    .take(MEMBER_VOTERS)
+                    .collect::<Vec<_>>()
+            })
+            .collect();
+        let proposals: Vec<Option<usize>> = pairs
+            .par_iter()
+            .map(|&(member_entry, next_member_entry)| {
+                (0x70..=0x100).find(|&i| {
+                    let (Some(byte_1), Some(byte_2)) = (probe.mem.try_read::<u8>(member_entry.wrapping_add(i)), probe.mem.try_read::<u8>(next_member_entry.wrapping_add(i))) else { return false };
+                    byte_1 == 1 && byte_2 % 2 == 0 && byte_1 < byte_2
+                })
+            })
+            .collect();
+        vote(proposals.into_iter().flatten()).map(|(bit_mask, ..)| bit_mask)
     }
 
     /// Simplified translation of AutoConfig.cpp dynamically scanning UObject memory structure
     pub fn scan_basic_offsets(&mut self, process: &Process, name_pool: &FNamePool, object_manager: &ObjectManager, gu_object_base: usize, element_size: usize) -> Result<(), String> {
-        self.find_basic_info_offset(process, name_pool, gu_object_base, element_size)?;
+        let start = std::time::Instant::now();
+        let probe = Probe { process, mem: CachedMemory::new(&process.memory, PAGE_4K), names: name_pool, objects: object_manager };
+
+        self.find_basic_info_offset(&probe, gu_object_base, element_size)?;
 
         // Find GameEngine or Pawn
-        let mut actor_engine_address = 0;
-        let object_array_entry = process.memory.read_pointer(gu_object_base.wrapping_add(0x10)).map_err(|e| format!("Failed to read GUObjectArray entry: {}", e))?;
-
-        for i in 0..=5000 {
-            // Fallback basic search for an Actor or GameEngine
-            let chunk_ptr = process.memory.read_pointer(object_array_entry.wrapping_add((i / 65536) * 8)).unwrap_or(0);
-            if chunk_ptr == 0 {
-                continue;
+        let candidates = self.find_engine_candidates(&probe, gu_object_base, element_size)?;
+
+        let proposals: Vec<(SuperMember, usize)> = candidates.par_iter().map(|&address| Self::find_super_and_member_offset(&probe, &self.offsets, address)).collect();
+        if let Some((winner, votes, voters)) = vote(proposals.iter().map(|(p, _)| *p).filter(|p| p.super_struct.is_some() || p.member.is_some())) {
+            println!("[AutoConfig] Super/Member: {} of {} candidates agree", votes, voters);
+            if let Some(super_struct) = winner.super_struct {
+                self.offsets.super_struct = super_struct;
             }
-            let object_entry = process.memory.read_pointer(chunk_ptr.wrapping_add((i % 65536) * element_size)).unwrap_or(0);
-            if object_entry == 0 {
-                continue;
+            if let Some((member, next_member, member_fname_index)) = winner.member {
+                self.offsets.member = member;
+                self.offsets.next_member = next_member;
+                self.offsets.member_fname_index = member_fname_index;
             }
 
-            if let Some(obj) = object_manager.try_save_object(object_entry, process, name_pool, &self.offsets, 0, 5, true) {
-                if obj.full_name.contains("Engine.GameEngine") || obj.full_name.contains("Engine.Pawn") {
-                    actor_engine_address = object_entry;
-                    break;
-                }
-            }
-        }
+            // Member chains of every Super (Engine or Actor) the winning candidates found
+            let supers: Vec<usize> = proposals.iter().filter(|(p, address)| *p == winner && *address != 0).map(|(_, address)| *address).collect();
+            let chains: Vec<Vec<(usize, String)>> = supers.par_iter().map(|&address| probe.member_chain(&self.offsets, address)).collect();
 
-        if actor_engine_address != 0 {
-            if let Ok(super_address) = self.find_super_and_member_offset(process, name_pool, object_manager, actor_engine_address) {
-                self.find_property_size_offset(process, name_pool, object_manager, super_address);
-                self.find_offset_offset(process, name_pool, object_manager, super_address);
-                self.find_bit_mask_offset(process, name_pool, object_manager, super_address);
+            if !chains.is_empty() {
+                // PropSize and Offset only need the member chain; BitMask compares Offset values
+                let (prop_size, offset) = rayon::join(|| Self::find_property_size_offset(&probe, &self.offsets, &chains), || Self::find_offset_offset(&probe, &self.offsets, &chains));
+                if let Some(prop_size) = prop_size {
+                    self.offsets.prop_size = prop_size;
+                }
+                if let Some(offset) = offset {
+                    self.offsets.offset = offset;
+                }
+                if let Some(bit_mask) = Self::find_bit_mask_offset(&probe, &self.offsets, &chains) {
+                    self.offsets.bit_mask = bit_mask;
+                }
             }
         }
 
+        let stats = probe.mem.stats();
         println!(
             "===========================================================\n\
             [AutoConfig] Discovered Base Offsets:\n\
@@ -434,8 +450,23 @@ impl AutoConfig {
             NextMember       : 0x{:02X}    MemberFNameIndex : 0x{:02X}\n\
             Offset           : 0x{:02X}    PropSize         : 0x{:02X}\n\
             BitMask          : 0x{:02X}\n\
+            -----------------------------------------------------------\n\
+            {} candidates, {} page reads, {:?}\n\
             ===========================================================",
-            self.offsets.id, self.offsets.class, self.offsets.fname_index, self.offsets.outer, self.offsets.super_struct, self.offsets.member, self.offsets.next_member, self.offsets.member_fname_index, self.offsets.offset, self.offsets.prop_size, self.offsets.bit_mask
+            self.offsets.id,
+            self.offsets.class,
+            self.offsets.fname_index,
+            self.offsets.outer,
+            self.offsets.super_struct,
+            self.offsets.member,
+            self.offsets.next_member,
+            self.offsets.member_fname_index,
+            self.offsets.offset,
+            self.offsets.prop_size,
+            self.offsets.bit_mask,
+            candidates.len(),
+            stats.misses,
+            start.elapsed()
         );
 
         Ok(())
@@ -0,0 +1,227 @@
+use crate::backend::os::process::Process;
+use crate::backend::state::BaseAddresses;
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::offsets::UEOffset;
+use std::path::PathBuf;
+
+/// Identity of a game build: the executable path plus the PE header fields that change on every relink.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct BuildKey {
+    pub exe_path: String,
+    pub time_date_stamp: u32,
+    pub checksum: u32,
+    pub size_of_image: u32,
+}
+
+impl BuildKey {
+    /// Read the key from the PE header of the attached main module (already mapped, so no file I/O is needed)
+    pub fn read(process: &Process) -> Result<Self, String> {
+        let base = process.main_module_base;
+        if process.memory.read::<u16>(base)? != 0x5A4D {
+            return Err("Main module has no MZ header".to_string());
+        }
+        let nt = base + process.memory.read::<u32>(base + 0x3C)? as usize;
+        if process.memory.read::<u32>(nt)? != 0x4550 {
+            return Err("Main module has no PE signature".to_string());
+        }
+
+        // IMAGE_FILE_HEADER starts at nt + 4, IMAGE_OPTIONAL_HEADER64 at nt + 0x18
+        Ok(Self { exe_path: process.exe_path.clone(), time_date_stamp: process.memory.read::<u32>(nt + 0x8)?, size_of_image: process.memory.read::<u32>(nt + 0x18 + 0x38)?, checksum: process.memory.read::<u32>(nt + 0x18 + 0x40)? })
+    }
+
+    /// One file per build: FNV-1a of the lower-cased path keeps different installs apart, the PE fields keep builds apart
+    fn file_name(&self) -> String {
+        let mut hash: u64 = 0xCBF2_9CE4_8422_2325;
+        for b in self.exe_path.to_lowercase().bytes() {
+            hash ^= b as u64;
+            hash = hash.wrapping_mul(0x0100_0000_01B3);
+        }
+        format!("{:016X}_{:08X}_{:08X}.json", hash, self.time_date_stamp, self.checksum)
+    }
+}
+
+/// What we remember about a build. Addresses are stored as RVAs so ASLR does not invalidate them.
+#[derive(Debug, Clone, Default, serde::Serialize, serde::Deserialize)]
+pub struct BuildCacheEntry {
+    pub exe_path: String,
+    pub time_date_stamp: u32,
+    pub checksum: u32,
+    pub size_of_image: u32,
+    pub fname_pool_rva: Option<usize>,
+    pub guobject_array_rva: Option<usize>,
+    pub guobject_element_size: Option<usize>,
+    pub gworld_rva: Option<usize>,
+    pub offsets: Option<UEOffset>,
+}
+
+impl BuildCacheEntry {
+    fn matches(&self, key: &BuildKey) -> bool {
+        self.exe_path.eq_ignore_ascii_case(&key.exe_path) && self.time_date_stamp == key.time_date_stamp && self.checksum == key.checksum && self.size_of_image == key.size_of_image
+    }
+}
+
+/// Values recovered from the cache after validation against the live process
+pub struct RestoredBuild {
+    pub base_addresses: BaseAddresses,
+    pub offsets: Option<UEOffset>,
+}
+
+/// Links followed from Object's class looking for "Object"
+const SUPER_CHECK_DEPTH: usize = 6;
+/// GUObjectArray slots searched for a class or struct with members (CoreUObject's own structs come first)
+const MEMBER_CHECK_OBJECTS: usize = 2048;
+/// Members of that owner decoded before the member offsets are trusted
+const MEMBER_CHECK_DEPTH: usize = 8;
+
+/// Disk cache of per-build discovery results (base addresses, element size, AutoConfig offsets)
+pub struct BuildCache;
+
+impl BuildCache {
+    /// %LOCALAPPDATA%\uedp\build_cache, or the temp directory when that is unavailable
+    fn cache_dir() -> PathBuf {
+        let root = std::env::var_os("LOCALAPPDATA").map(PathBuf::from).unwrap_or_else(std::env::temp_dir);
+        root.join("uedp").join("build_cache")
+    }
+
+    fn load(key: &BuildKey) -> Option<BuildCacheEntry> {
+        let text = std::fs::read_to_string(Self::cache_dir().join(key.file_name())).ok()?;
+        let entry: BuildCacheEntry = serde_json::from_str(&text).ok()?;
+        entry.matches(key).then_some(entry)
+    }
+
+    fn save(key: &BuildKey, entry: &BuildCacheEntry) -> Result<(), String> {
+        let dir = Self::cache_dir();
+        std::fs::create_dir_all(&dir).map_err(|e| format!("Failed to create cache dir: {}", e))?;
+        let json = serde_json::to_string_pretty(entry).map_err(|e| e.to_string())?;
+
+        // Write then rename so a crash mid-write never leaves a truncated entry behind
+        let path = dir.join(key.file_name());
+        let tmp = path.with_extension("json.tmp");
+        std::fs::write(&tmp, json).map_err(|e| format!("Failed to write cache entry: {}", e))?;
+        std::fs::rename(&tmp, &path).map_err(|e| format!("Failed to commit cache entry: {}", e))
+    }
+
+    /// Merge new results into this build's entry
+    fn update(process: &Process, apply: impl FnOnce(&mut BuildCacheEntry)) {
+        let key = match BuildKey::read(process) {
+            Ok(key) => key,
+            Err(e) => {
+                println!("[BuildCache] Skipping store: {}", e);
+                return;
+            }
+        };
+        let mut entry = Self::load(&key).unwrap_or_else(|| BuildCacheEntry { exe_path: key.exe_path.clone(), time_date_stamp: key.time_date_stamp, checksum: key.checksum, size_of_image: key.size_of_image, ..Default::default() });
+        apply(&mut entry);
+        if let Err(e) = Self::save(&key, &entry) {
+            println!("[BuildCache] {}", e);
+        }
+    }
+
+    /// Remember the resolved base addresses for this build
+    pub fn store_base_addresses(process: &Process, ba: &BaseAddresses) {
+        let base = process.main_module_base;
+        Self::update(process, |entry| {
+            entry.fname_pool_rva = ba.fname_pool.map(|a| a - base).or(entry.fname_pool_rva);
+            if let (Some(addr), Some(size)) = (ba.guobject_array, ba.guobject_element_size) {
+                entry.guobject_array_rva = Some(addr - base);
+                entry.guobject_element_size = Some(size);
+            }
+            entry.gworld_rva = ba.gworld.map(|a| a - base).or(entry.gworld_rva);
+        });
+    }
+
+    /// Remember the AutoConfig result for this build
+    pub fn store_offsets(process: &Process, offsets: &UEOffset) {
+        Self::update(process, |entry| entry.offsets = Some(offsets.clone()));
+    }
+
+    /// Load this build's entry and keep only what still checks out against live memory.
+    /// Returns None when there is no entry or nothing survives validation, so callers fall back to full discovery.
+    pub fn restore(process: &Process) -> Option<RestoredBuild> {
+        let key = BuildKey::read(process).ok()?;
+        let entry = Self::load(&key)?;
+        let base = process.main_module_base;
+        let mut ba = BaseAddresses::default();
+
+        // FNamePool: entry 0 is always "None"
+        ba.fname_pool = entry.fname_pool_rva.map(|rva| base + rva).filter(|&addr| FNamePool::new(addr).get_name(process, 0).map(|n| n == "None").unwrap_or(false));
+        let name_pool = ba.fname_pool.map(FNamePool::new);
+
+        // GUObjectArray: the first chunk must be readable; offsets are then checked against the first objects
+        let objects = match (entry.guobject_array_rva, entry.guobject_element_size) {
+            (Some(rva), Some(size)) => process.memory.try_read_pointer(base + rva + 0x10).and_then(|entry_ptr| process.memory.try_read_pointer(entry_ptr)).filter(|&chunk| chunk > 0x10000).map(|chunk| (base + rva, size, chunk)),
+            _ => None,
+        };
+        if let Some((addr, size, _)) = objects {
+            ba.guobject_array = Some(addr);
+            ba.guobject_element_size = Some(size);
+        }
+
+        // GWorld may legitimately be null before a map loads, so only require the slot to be readable
+        ba.gworld = entry.gworld_rva.map(|rva| base + rva).filter(|&addr| process.memory.try_read_pointer(addr).is_some());
+
+        let offsets = match (&name_pool, objects, entry.offsets) {
+            (Some(pool), Some((_, size, chunk)), Some(offsets)) if Self::offsets_hold(process, pool, chunk, size, &offsets) => Some(offsets),
+            _ => None,
+        };
+
+        if ba.fname_pool.is_none() && ba.guobject_array.is_none() && ba.gworld.is_none() {
+            return None;
+        }
+        Some(RestoredBuild { base_addresses: ba, offsets })
+    }
+
+    /// Same invariant find_basic_info_offset relies on: among the first objects is "Object", whose outer is in Core and whose class is a Class.
+    /// The struct offsets are checked too, since a cache entry from a slightly different layout can pass the basic ones alone.
+    fn offsets_hold(process: &Process, name_pool: &FNamePool, chunk: usize, element_size: usize, offsets: &UEOffset) -> bool {
+        let name_of = |object: usize| process.memory.try_read::<u32>(object + offsets.fname_index).and_then(|id| name_pool.name(process, id).ok());
+
+        let object = (0..=10).filter_map(|i| process.memory.try_read_pointer(chunk + i * element_size)).filter(|&object| object > 0x10000).find(|&object| {
+            name_of(object).as_deref() == Some("Object")
+                && process.memory.try_read_pointer(object + offsets.outer).and_then(name_of).map(|n| n.contains("Core")).unwrap_or(false)
+                && process.memory.try_read_pointer(object + offsets.class).and_then(name_of).map(|n| n.contains("Class")).unwrap_or(false)
+        });
+        let Some(object) = object else { return false };
+        Self::super_holds(process, offsets, object, &name_of) && Self::members_hold(process, name_pool, chunk, element_size, offsets, &name_of)
+    }
+
+    /// SuperStruct: Class -> Struct -> Field -> Object, so the chain from Object's class reaches "Object" within a few links
+    fn super_holds<'n>(process: &Process, offsets: &UEOffset, object: usize, name_of: &impl Fn(usize) -> Option<&'n str>) -> bool {
+        let mut current = process.memory.try_read_pointer(object + offsets.class).unwrap_or(0);
+        for _ in 0..SUPER_CHECK_DEPTH {
+            match process.memory.try_read_pointer(current.wrapping_add(offsets.super_struct)) {
+                Some(parent) if parent > 0x10000 && parent != current => current = parent,
+                _ => return false,
+            }
+            if name_of(current) == Some("Object") {
+                return true;
+            }
+        }
+        false
+    }
+
+    /// Member/NextMember/MemberFNameIndex/Offset/PropSize: the first class or struct among the early objects that has members
+    /// must decode them into identifier names with sane offsets and sizes
+    fn members_hold<'n>(process: &Process, name_pool: &FNamePool, chunk: usize, element_size: usize, offsets: &UEOffset, name_of: &impl Fn(usize) -> Option<&'n str>) -> bool {
+        let mem = &process.memory;
+        let owner = (0..MEMBER_CHECK_OBJECTS).filter_map(|i| mem.try_read_pointer(chunk + i * element_size)).filter(|&object| object > 0x10000).find_map(|object| {
+            let is_struct = mem.try_read_pointer(object + offsets.class).and_then(name_of).is_some_and(|n| n == "ScriptStruct" || n == "Class");
+            is_struct.then(|| mem.try_read_pointer(object + offsets.member)).flatten().filter(|&member| member > 0x10000)
+        });
+        let Some(mut member) = owner else { return false };
+
+        for _ in 0..MEMBER_CHECK_DEPTH {
+            let name = mem.try_read::<u32>(member + offsets.member_fname_index).and_then(|id| name_pool.name(process, id).ok()).unwrap_or_default();
+            let size = mem.try_read::<i32>(member + offsets.prop_size).unwrap_or(-1);
+            let offset = mem.try_read::<i32>(member + offsets.offset).unwrap_or(-1);
+            if name.is_empty() || !name.bytes().all(|b| b.is_ascii_alphanumeric() || b == b'_') || !(1..=0x10000).contains(&size) || !(0..0x100000).contains(&offset) {
+                return false;
+            }
+            match mem.try_read_pointer(member + offsets.next_member) {
+                Some(next) if next > 0x10000 => member = next,
+                _ => return true,
+            }
+        }
+        true
+    }
+}
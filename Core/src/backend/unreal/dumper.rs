@@ -1,6 +1,37 @@
 use crate::backend::os::process::Process;
 use crate::backend::os::scanner::Scanner;
 
+/// AOB, displacement_offset, instruction_length
+type Signature = (&'static str, usize, usize);
+
+const FNAME_POOL_SIGNATURES: &[Signature] = &[
+    ("4C 8D 05 ? ? ? ? EB 16 48 8D 0D ? ? ? ? E8", 3, 7),
+    ("48 8D 0D ? ? ? ? E8 ? ? ? ? ? 8B ? C6", 3, 7),
+    ("48 83 EC 28 48 8B 05 ? ? ? ? 48 85 C0 75 ? B9 ? ? 00 00 48 89 5C 24 20 E8", 7, 11),
+    ("C3 ? DB 48 89 1D ? ? ? ? ? ? 48 8B 5C 24 20", 6, 10),
+    ("33 F6 89 35 ? ? ? ? 8B C6 5E", 4, 8),
+    ("8B 07 8B 0D ? ? ? ? 8B 04 81", 4, 8),
+];
+
+const GUOBJECT_ARRAY_SIGNATURES: &[Signature] = &[
+    ("44 8B ? ? ? 48 8D 05 ? ? ? ? ? ? ? ? ? 48 89 71 10", 8, 12),
+    ("40 53 48 83 EC 20 48 8B D9 48 85 D2 74 ? 8B", 22, 26),
+    ("4C 8B 05 ? ? ? ? 45 3B 88", 3, 7),
+    ("4C 8B 44 24 60 8B 44 24 78 ? ? ? 48 8D", 15, 19),
+    ("8B 44 24 04 56 8B F1 85 C0 74 17 8B 40 08", 16, 20),
+    ("8B 15 ? ? ? ? 8B 04 82 85", 2, 6),
+    ("56 48 83 ? ? 48 89 ? ? ? 48 89 ? 48 8D", 16, 20),
+];
+
+const GWORLD_SIGNATURES: &[Signature] = &[("48 8B 1D ? ? ? ? 48 85 DB 74 33 41 B0 01", 3, 7)];
+
+/// Outcome of `BaseAddressDumper::resolve_all`, one result per global
+pub struct ResolvedBaseAddresses {
+    pub fname_pool: Result<usize, String>,
+    pub guobject_array: Result<usize, String>,
+    pub gworld: Result<usize, String>,
+}
+
 pub struct BaseAddressDumper;
 
 impl BaseAddressDumper {
@@ -19,17 +50,7 @@ impl BaseAddressDumper {
 
     /// Attempts to find the FNamePool base address
     pub fn get_fname_pool(process: &Process) -> Result<usize, String> {
-        let aobs = vec![
-            // AOB, displacement_offset, instruction_length
-            ("4C 8D 05 ? ? ? ? EB 16 48 8D 0D ? ? ? ? E8", 3, 7),
-            ("48 8D 0D ? ? ? ? E8 ? ? ? ? ? 8B ? C6", 3, 7),
-            ("48 83 EC 28 48 8B 05 ? ? ? ? 48 85 C0 75 ? B9 ? ? 00 00 48 89 5C 24 20 E8", 7, 11),
-            ("C3 ? DB 48 89 1D ? ? ? ? ? ? 48 8B 5C 24 20", 6, 10),
-            ("33 F6 89 35 ? ? ? ? 8B C6 5E", 4, 8),
-            ("8B 07 8B 0D ? ? ? ? 8B 04 81", 4, 8),
-        ];
-
-        Self::scan_and_resolve(process, aobs, "FNamePool")
+        Self::scan_and_resolve(process, FNAME_POOL_SIGNATURES, "FNamePool")
     }
 
     /// Attempts to find the GUObjectArray base address and element size
@@ -43,24 +64,13 @@ impl BaseAddressDumper {
 
     /// Attempts to find the GUObjectArray base address
     pub fn get_guobject_array(process: &Process) -> Result<usize, String> {
-        let aobs = vec![
-            // AOB, displacement_offset, instruction_length
-            ("44 8B ? ? ? 48 8D 05 ? ? ? ? ? ? ? ? ? 48 89 71 10", 8, 12),
-            ("40 53 48 83 EC 20 48 8B D9 48 85 D2 74 ? 8B", 22, 26),
-            ("4C 8B 05 ? ? ? ? 45 3B 88", 3, 7),
-            ("4C 8B 44 24 60 8B 44 24 78 ? ? ? 48 8D", 15, 19),
-            ("8B 44 24 04 56 8B F1 85 C0 74 17 8B 40 08", 16, 20),
-            ("8B 15 ? ? ? ? 8B 04 82 85", 2, 6),
-            ("56 48 83 ? ? 48 89 ? ? ? 48 89 ? 48 8D", 16, 20),
-        ];
-
-        Self::scan_and_resolve(process, aobs, "GUObjectArray")
+        Self::scan_and_resolve(process, GUOBJECT_ARRAY_SIGNATURES, "GUObjectArray")
     }
 
     /// Detect GUObjectArray element size by probing, matching C++ ValidateGUObjectArray logic.
     /// Iterates byte offsets from the base, reads the first valid chunk pointer,
     /// then probes element sizes k=0x4..0x1C to find which one produces consistent object indices.
-    fn detect_element_size(process: &Process, base_address: usize) -> Result<usize, String> {
+    pub fn detect_element_size(process: &Process, base_address: usize) -> Result<usize, String> {
         // Scan offsets -0x50..0x200 from base to find a valid multi-level pointer entry
         for i_raw in (-0x50i32..=0x200).step_by(4) {
             let entry_addr = base_address.wrapping_add(i_raw as usize);
@@ -151,42 +161,71 @@ impl BaseAddressDumper {
 
     /// Attempts to find the GWorld base address
     pub fn get_gworld(process: &Process) -> Result<usize, String> {
-        let aobs = vec![("48 8B 1D ? ? ? ? 48 85 DB 74 33 41 B0 01", 3, 7)];
+        Self::scan_and_resolve(process, GWORLD_SIGNATURES, "GWorld")
+    }
 
-        Self::scan_and_resolve(process, aobs, "GWorld")
+    /// Resolve FNamePool, GUObjectArray and GWorld with a single pass over the main module.
+    /// All signatures are registered with `Scanner::scan_many`, so the module is enumerated and read once.
+    pub fn resolve_all(process: &Process) -> ResolvedBaseAddresses {
+        let groups: [(&[Signature], &str); 3] = [(FNAME_POOL_SIGNATURES, "FNamePool"), (GUOBJECT_ARRAY_SIGNATURES, "GUObjectArray"), (GWORLD_SIGNATURES, "GWorld")];
+        let signatures: Vec<&str> = groups.iter().flat_map(|(aobs, _)| aobs.iter().map(|(aob, _, _)| *aob)).collect();
+
+        println!("Scanning for {} signatures in one pass...", signatures.len());
+        let all_hits = Scanner::scan_many(&process.memory, process.main_module_base, process.main_module_base + process.main_module_size, &signatures);
+
+        let mut resolved = Vec::with_capacity(groups.len());
+        let mut first = 0;
+        for (aobs, target_name) in groups {
+            let result = match &all_hits {
+                Ok(hits) => Self::resolve_hits(process, aobs, &hits[first..first + aobs.len()], target_name),
+                Err(e) => Err(format!("Scanning pipeline failed for {}: {}", target_name, e)),
+            };
+            resolved.push(result);
+            first += aobs.len();
+        }
+
+        let gworld = resolved.pop().unwrap();
+        let guobject_array = resolved.pop().unwrap();
+        let fname_pool = resolved.pop().unwrap();
+        ResolvedBaseAddresses { fname_pool, guobject_array, gworld }
     }
 
     /// Generic scanner that goes through a list of (AOB, disp_offset, instr_len),
-    /// scans the main module, and resolves the RIP relative pointer to find the global address.
-    fn scan_and_resolve(process: &Process, aobs: Vec<(&str, usize, usize)>, target_name: &str) -> Result<usize, String> {
-        for (idx, (aob, disp_offset, instr_len)) in aobs.iter().enumerate() {
-            println!("Scanning for {} (AOB {})...", target_name, idx);
-            match Scanner::scan(&process.memory, process.main_module_base, process.main_module_base + process.main_module_size, aob) {
-                Ok(results) => {
-                    if results.is_empty() {
-                        println!("  -> AOB {} failed: Signature not found in memory.", idx);
-                        continue;
-                    }
+    /// scans the main module once for all of them, and resolves the RIP relative pointer to find the global address.
+    fn scan_and_resolve(process: &Process, aobs: &[Signature], target_name: &str) -> Result<usize, String> {
+        println!("Scanning for {} ({} AOBs)...", target_name, aobs.len());
+        let signatures: Vec<&str> = aobs.iter().map(|(aob, _, _)| *aob).collect();
+        match Scanner::scan_many(&process.memory, process.main_module_base, process.main_module_base + process.main_module_size, &signatures) {
+            Ok(hits) => Self::resolve_hits(process, aobs, &hits, target_name),
+            Err(e) => {
+                println!("  -> {} scanning pipeline failed: {}", target_name, e);
+                Err(format!("Could not find {} with any of the known AOB signatures", target_name))
+            }
+        }
+    }
 
-                    for &addr in &results {
-                        match Self::resolve_rip(process, addr, *disp_offset, *instr_len) {
-                            Ok(resolved) => {
-                                // Quick heuristic to validate if it's a valid pointer within user space
-                                if resolved > 0x10000 && resolved < 0x7FFFFFFFFFFF {
-                                    println!("  -> Found {} at 0x{:X} [{}]", target_name, resolved, aob);
-                                    return Ok(resolved);
-                                } else {
-                                    println!("  -> AOB {} failed at 0x{:X}: Resolved address (0x{:X}) is out of valid user-space memory bounds.", idx, addr, resolved);
-                                }
-                            }
-                            Err(e) => {
-                                println!("  -> AOB {} failed at 0x{:X}: Could not read displacement. Error: {}", idx, addr, e);
-                            }
+    /// Walk the per-signature hit lists in priority order and return the first hit that resolves to a plausible global.
+    fn resolve_hits(process: &Process, aobs: &[Signature], hits: &[Vec<usize>], target_name: &str) -> Result<usize, String> {
+        for (idx, ((aob, disp_offset, instr_len), results)) in aobs.iter().zip(hits).enumerate() {
+            if results.is_empty() {
+                println!("  -> AOB {} failed: Signature not found in memory.", idx);
+                continue;
+            }
+
+            for &addr in results {
+                match Self::resolve_rip(process, addr, *disp_offset, *instr_len) {
+                    Ok(resolved) => {
+                        // Quick heuristic to validate if it's a valid pointer within user space
+                        if resolved > 0x10000 && resolved < 0x7FFFFFFFFFFF {
+                            println!("  -> Found {} at 0x{:X} [{}]", target_name, resolved, aob);
+                            return Ok(resolved);
+                        } else {
+                            println!("  -> AOB {} failed at 0x{:X}: Resolved address (0x{:X}) is out of valid user-space memory bounds.", idx, addr, resolved);
                         }
                     }
-                }
-                Err(e) => {
-                    println!("  -> AOB {} failed during scanning pipeline: {}", idx, e);
+                    Err(e) => {
+                        println!("  -> AOB {} failed at 0x{:X}: Could not read displacement. Error: {}", idx, addr, e);
+                    }
                 }
             }
         }
@@ -0,0 +1,166 @@
+use crate::backend::unreal::object_array::{ObjectHandle, ObjectManager, INVALID_HANDLE};
+
+// ═══════════════════════════════════════════════════════════════
+//  ClassHierarchy — SuperStruct forest over the object table
+//  Every handle is a node; its parent is the recorded SuperStruct link.
+//  Nodes are numbered in DFS pre-order, so a subtree is the interval [enter, exit]:
+//    "X inherits from Y"  ⇔  enter[Y] <= enter[X] <= exit[Y]
+//  Instances are bucketed by the tour position of their class, so the instances
+//  of a class and all its subclasses are one contiguous slice of `instances`.
+// ═══════════════════════════════════════════════════════════════
+
+pub struct ClassHierarchy {
+    /// SuperStruct handle per handle (INVALID_HANDLE for roots)
+    parent: Vec<ObjectHandle>,
+    /// Pre-order position per handle, and the last position inside its subtree
+    enter: Vec<u32>,
+    exit: Vec<u32>,
+    /// Handle at each pre-order position
+    order: Vec<ObjectHandle>,
+    /// Postings: instances whose class sits at tour position p are instances[starts[p]..starts[p + 1]]
+    starts: Vec<u32>,
+    instances: Vec<ObjectHandle>,
+    /// ObjectManager::index_revision of the table this was built from
+    built_from: u64,
+}
+
+impl ClassHierarchy {
+    /// Built from the links already in the table; no process memory is read
+    pub fn build(objects: &ObjectManager) -> Self {
+        let built_from = objects.index_revision();
+        let n = objects.row_count() as usize;
+
+        let mut parent = vec![INVALID_HANDLE; n];
+        let mut class_of = vec![INVALID_HANDLE; n];
+        for handle in 0..n as u32 {
+            let (saved, class, super_struct) = objects.links(handle);
+            if (super_struct as usize) < n && super_struct != handle {
+                parent[handle as usize] = super_struct;
+            }
+            if saved && (class as usize) < n {
+                class_of[handle as usize] = class;
+            }
+        }
+
+        // Children in CSR form
+        let mut child_starts = vec![0u32; n + 1];
+        for &p in &parent {
+            if p != INVALID_HANDLE {
+                child_starts[p as usize + 1] += 1;
+            }
+        }
+        for i in 0..n {
+            child_starts[i + 1] += child_starts[i];
+        }
+        let mut children = vec![0 as ObjectHandle; child_starts[n] as usize];
+        let mut fill = child_starts.clone();
+        for (handle, &p) in parent.iter().enumerate() {
+            if p != INVALID_HANDLE {
+                children[fill[p as usize] as usize] = handle as ObjectHandle;
+                fill[p as usize] += 1;
+            }
+        }
+
+        // Iterative DFS from the roots; nodes left unvisited sit on a SuperStruct cycle (bad reads) and start their own tree
+        let mut enter = vec![u32::MAX; n];
+        let mut exit = vec![u32::MAX; n];
+        let mut order = Vec::with_capacity(n);
+        let mut stack: Vec<(ObjectHandle, u32)> = Vec::new();
+        let roots = (0..n as u32).filter(|&h| parent[h as usize] == INVALID_HANDLE).chain(0..n as u32);
+        for root in roots {
+            if enter[root as usize] != u32::MAX {
+                continue;
+            }
+            enter[root as usize] = order.len() as u32;
+            order.push(root);
+            stack.push((root, child_starts[root as usize]));
+
+            while let Some((node, next)) = stack.last_mut() {
+                let node = *node as usize;
+                if *next < child_starts[node + 1] {
+                    let child = children[*next as usize];
+                    *next += 1;
+                    if enter[child as usize] == u32::MAX {
+                        enter[child as usize] = order.len() as u32;
+                        order.push(child);
+                        stack.push((child, child_starts[child as usize]));
+                    }
+                } else {
+                    exit[node] = order.len() as u32 - 1;
+                    stack.pop();
+                }
+            }
+        }
+
+        // Instance postings, counting-sorted by the tour position of their class
+        let mut starts = vec![0u32; n + 1];
+        for &class in &class_of {
+            if class != INVALID_HANDLE {
+                starts[enter[class as usize] as usize + 1] += 1;
+            }
+        }
+        for i in 0..n {
+            starts[i + 1] += starts[i];
+        }
+        let mut instances = vec![0 as ObjectHandle; starts[n] as usize];
+        let mut fill = starts.clone();
+        for (handle, &class) in class_of.iter().enumerate() {
+            if class != INVALID_HANDLE {
+                let pos = enter[class as usize] as usize;
+                instances[fill[pos] as usize] = handle as ObjectHandle;
+                fill[pos] += 1;
+            }
+        }
+
+        Self { parent, enter, exit, order, starts, instances, built_from }
+    }
+
+    /// Still describes `objects`: no class link, SuperStruct or eviction since the build. Rows added after it are
+    /// outside the forest, which is right for them until one of those changes happens.
+    pub fn is_current(&self, objects: &ObjectManager) -> bool {
+        self.built_from == objects.index_revision()
+    }
+
+    fn contains(&self, handle: ObjectHandle) -> bool {
+        (handle as usize) < self.parent.len()
+    }
+
+    pub fn parent(&self, handle: ObjectHandle) -> Option<ObjectHandle> {
+        self.parent.get(handle as usize).copied().filter(|&p| p != INVALID_HANDLE)
+    }
+
+    /// True when `handle` is `ancestor` or inherits from it
+    pub fn is_subclass_of(&self, handle: ObjectHandle, ancestor: ObjectHandle) -> bool {
+        if !self.contains(handle) || !self.contains(ancestor) {
+            return false;
+        }
+        let pos = self.enter[handle as usize];
+        self.enter[ancestor as usize] <= pos && pos <= self.exit[ancestor as usize]
+    }
+
+    /// `class` and every class/struct below it, in pre-order
+    pub fn subclasses(&self, class: ObjectHandle) -> &[ObjectHandle] {
+        if !self.contains(class) {
+            return &[];
+        }
+        &self.order[self.enter[class as usize] as usize..=self.exit[class as usize] as usize]
+    }
+
+    /// Objects whose class is exactly `class`
+    pub fn direct_instances(&self, class: ObjectHandle) -> &[ObjectHandle] {
+        if !self.contains(class) {
+            return &[];
+        }
+        let pos = self.enter[class as usize] as usize;
+        &self.instances[self.starts[pos] as usize..self.starts[pos + 1] as usize]
+    }
+
+    /// Objects whose class is `class` or any of its subclasses
+    pub fn instances(&self, class: ObjectHandle) -> &[ObjectHandle] {
+        if !self.contains(class) {
+            return &[];
+        }
+        let (first, last) = (self.enter[class as usize] as usize, self.exit[class as usize] as usize);
+        &self.instances[self.starts[first] as usize..self.starts[last + 1] as usize]
+    }
+}
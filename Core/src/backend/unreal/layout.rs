@@ -0,0 +1,244 @@
+use crate::backend::os::memory::CachedMemory;
+use crate::backend::os::process::Process;
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::ObjectManager;
+use crate::backend::unreal::offsets::UEOffset;
+use std::sync::Arc;
+
+// ═══════════════════════════════════════════════════════════════
+//  ClassLayout — a class's member chain, read once and kept
+//  Everything about a property that doesn't depend on the instance (name, type,
+//  offset, size, bit mask, resolved sub types) is resolved when the layout is
+//  built. Inspecting an instance is then one read of its PropSize bytes, decoded
+//  against the layout. Inherited members come from the SuperStruct's own
+//  cached layout, so a base class is walked once however many subclasses share it.
+// ═══════════════════════════════════════════════════════════════
+
+/// How an instance's value row is rendered (the checks get_instance_details has always applied, in its order)
+#[derive(Clone, Copy, PartialEq, Eq, Debug)]
+pub enum ValueKind {
+    Bool,
+    Name,
+    Array,
+    MapOrSet,
+    Int,
+    Float,
+    Double,
+    Byte,
+    /// Shown as a pointer
+    Raw,
+}
+
+/// Members whose value row is more than a plain read
+#[derive(Clone, Copy, PartialEq, Eq, Debug)]
+pub enum MemberRole {
+    /// Object/Class/SoftObject/WeakObject/Interface property: a pointer to follow
+    Object,
+    /// StructProperty: the struct lives inline in the instance
+    Struct,
+    Plain,
+}
+
+pub struct LayoutMember {
+    /// Class or struct that declares the member
+    pub owner: usize,
+    pub name: String,
+    pub type_name: String,
+    /// type_name contains "Property"; the instance view only shows these
+    pub is_property: bool,
+    pub offset: usize,
+    pub element_size: usize,
+    pub bit_mask: u8,
+    /// "A8", or "F4:0" with the bit index for bools (what PropertyWrite parses back)
+    pub offset_label: String,
+    pub role: MemberRole,
+    pub value: ValueKind,
+    /// Instance view sub type: PropertyClass, struct, enum or inner element types
+    pub sub_type: String,
+    /// UScriptStruct of a StructProperty, 0 otherwise
+    pub struct_address: usize,
+    /// get_object_details view of the sub type, and the address to jump to
+    pub detail_sub_type: String,
+    pub detail_sub_type_address: usize,
+}
+
+pub struct ClassLayout {
+    pub address: usize,
+    /// PropertiesSize of the class, inherited members included
+    pub prop_size: usize,
+    /// SuperStruct layout, if the class has one
+    pub parent: Option<Arc<ClassLayout>>,
+    /// Members declared by this class, in chain order
+    pub own: Vec<LayoutMember>,
+}
+
+/// Same cap get_object_details walks with; guards against a corrupt chain
+const MEMBER_LIMIT: usize = 2000;
+/// Largest instance read in one piece; PropSize beyond this is treated as garbage
+pub const MAX_INSTANCE_READ: usize = 0x10_0000;
+
+impl ClassLayout {
+    /// Root class first, then each subclass's own members, ending with this class's
+    pub fn members(&self) -> impl Iterator<Item = &LayoutMember> {
+        let mut chain = Vec::new();
+        let mut current = Some(self);
+        while let Some(layout) = current {
+            chain.push(layout);
+            current = layout.parent.as_deref();
+        }
+        chain.into_iter().rev().flat_map(|layout| layout.own.iter())
+    }
+
+    /// Bytes of an instance the layout reads: PropSize, stretched to cover every member
+    pub fn instance_span(&self) -> usize {
+        let members_end = self.members().map(|m| m.offset + m.element_size.max(8)).max().unwrap_or(0);
+        self.prop_size.max(members_end).min(MAX_INSTANCE_READ)
+    }
+
+    /// Walk the member chain of the class at `address`; `parent` is its SuperStruct's layout
+    pub fn build(address: usize, parent: Option<Arc<ClassLayout>>, process: &Process, objects: &ObjectManager, names: &FNamePool, offsets: &UEOffset) -> Self {
+        let mem = CachedMemory::new(&process.memory, crate::backend::os::memory::PAGE_4K);
+        let prop_size = mem.try_read::<i32>(address.wrapping_add(offsets.prop_size)).unwrap_or(0).max(0) as usize;
+
+        // Instance view: cached object name first, then the FName at the address
+        let resolve_name = |addr: usize| -> String {
+            if addr < 0x10000 {
+                return String::new();
+            }
+            if let Some(cached) = objects.get(addr, names) {
+                if !cached.name().is_empty() && cached.name() != "None" {
+                    return cached.name().to_string();
+                }
+            }
+            let name_id = mem.try_read::<i32>(addr.wrapping_add(offsets.fname_index)).unwrap_or(0);
+            names.get_name(process, name_id as u32).unwrap_or_default()
+        };
+        // Details view: any cached object wins, else a non-empty FName read from the address
+        let detail_name = |addr: usize| -> Option<(String, usize)> {
+            if addr <= 0x10000 {
+                return None;
+            }
+            if let Some(sub_obj) = objects.get(addr, names) {
+                return Some((sub_obj.name().to_string(), sub_obj.address()));
+            }
+            let sub_name_id = mem.try_read::<i32>(addr.wrapping_add(offsets.fname_index)).unwrap_or(0);
+            names.name(process, sub_name_id as u32).ok().filter(|n| !n.is_empty()).map(|n| (n.to_string(), addr))
+        };
+        // Element type of an Array/Set/Map inner property, with object classes resolved
+        let inner_type = |prop: usize| -> Option<String> {
+            if prop <= 0x10000 {
+                return None;
+            }
+            let type_ptr = mem.try_read_pointer(prop.wrapping_add(offsets.member_type_offset)).unwrap_or(0);
+            let type_id = mem.try_read::<i32>(type_ptr.wrapping_add(offsets.member_type)).unwrap_or(0);
+            if type_id <= 0 || type_id >= 2000000 {
+                return None;
+            }
+            let type_name = names.get_name(process, type_id as u32).unwrap_or_default();
+            if !type_name.to_lowercase().contains("property") {
+                return None;
+            }
+            let mut part = type_name.replace("Property", "");
+            if part.to_lowercase().contains("object") || part.to_lowercase().contains("class") {
+                let name = resolve_name(mem.try_read_pointer(prop.wrapping_add(offsets.property)).unwrap_or(0));
+                if !name.is_empty() {
+                    part = name;
+                }
+            }
+            Some(part)
+        };
+
+        let mut own = Vec::new();
+        let mut child_addr = mem.try_read_pointer(address.wrapping_add(offsets.member)).unwrap_or(0);
+        let mut safety = 0;
+        while child_addr > 0x10000 && safety < MEMBER_LIMIT {
+            safety += 1;
+
+            let name_id = mem.try_read::<i32>(child_addr.wrapping_add(offsets.member_fname_index)).unwrap_or(0);
+            let name = names.name(process, name_id as u32).unwrap_or_default().to_string();
+            let type_ptr = mem.try_read_pointer(child_addr.wrapping_add(offsets.member_type_offset)).unwrap_or(0);
+            let type_id = mem.try_read::<i32>(type_ptr.wrapping_add(offsets.member_type)).unwrap_or(0);
+            let type_name = names.name(process, type_id as u32).unwrap_or_default().to_string();
+
+            if !name.is_empty() && !type_name.is_empty() {
+                let t = type_name.to_lowercase();
+                let offset = mem.try_read::<i32>(child_addr.wrapping_add(offsets.offset)).unwrap_or(0) as usize;
+                let element_size = mem.try_read::<i32>(child_addr.wrapping_add(offsets.prop_size)).unwrap_or(0).clamp(0, MAX_INSTANCE_READ as i32) as usize;
+                let prop_0 = mem.try_read_pointer(child_addr.wrapping_add(offsets.property)).unwrap_or(0);
+                let prop_8 = mem.try_read_pointer(child_addr.wrapping_add(offsets.property + 8)).unwrap_or(0);
+                let type_obj = mem.try_read_pointer(child_addr.wrapping_add(offsets.type_object)).unwrap_or(0);
+
+                let is_bool = t.contains("boolproperty");
+                let bit_mask = if is_bool { mem.try_read::<u8>(child_addr.wrapping_add(offsets.bit_mask)).unwrap_or(0) } else { 0 };
+                let offset_label = if is_bool { format!("{:X}:{}", offset, if bit_mask > 0 { bit_mask.trailing_zeros() } else { 0 }) } else { format!("{:X}", offset) };
+
+                let role = if t.contains("objectproperty") || t.contains("classproperty") || t.contains("softobjectproperty") || t.contains("weakobjectproperty") || t.contains("interfaceproperty") {
+                    MemberRole::Object
+                } else if t.contains("structproperty") || t.contains("scriptstruct") {
+                    MemberRole::Struct
+                } else {
+                    MemberRole::Plain
+                };
+                let value = if is_bool {
+                    ValueKind::Bool
+                } else if t.contains("nameproperty") {
+                    ValueKind::Name
+                } else if t.contains("arrayproperty") {
+                    ValueKind::Array
+                } else if t.contains("mapproperty") || t.contains("setproperty") {
+                    ValueKind::MapOrSet
+                } else if t.contains("intproperty") || t.contains("int32") {
+                    ValueKind::Int
+                } else if t.contains("floatproperty") {
+                    ValueKind::Float
+                } else if t.contains("doubleproperty") {
+                    ValueKind::Double
+                } else if t.contains("byteproperty") {
+                    ValueKind::Byte
+                } else {
+                    ValueKind::Raw
+                };
+
+                // Instance view sub type
+                let mut sub_type = String::new();
+                let mut struct_address = 0;
+                match role {
+                    // PropertyClass: prop_8 → prop_0 → type_obj
+                    MemberRole::Object => {
+                        sub_type = [prop_8, prop_0, type_obj].into_iter().map(&resolve_name).find(|n| !n.is_empty() && !n.to_lowercase().contains("property")).unwrap_or_default();
+                    }
+                    MemberRole::Struct => {
+                        for addr in [prop_0, type_obj, prop_8] {
+                            let name = resolve_name(addr);
+                            if !name.is_empty() && !name.to_lowercase().contains("property") {
+                                sub_type = name;
+                                struct_address = addr;
+                                break;
+                            }
+                        }
+                    }
+                    MemberRole::Plain if t.contains("enumproperty") => sub_type = resolve_name(type_obj),
+                    MemberRole::Plain if t.contains("arrayproperty") || t.contains("setproperty") => sub_type = inner_type(prop_0).unwrap_or_default(),
+                    MemberRole::Plain if t.contains("mapproperty") => sub_type = [prop_0, prop_8].into_iter().filter_map(&inner_type).collect::<Vec<_>>().join(", "),
+                    MemberRole::Plain => {}
+                }
+
+                // Details view sub type (old C++ GetProperty order: Property_8 → Property_0 → TypeObject)
+                let (mut detail_sub_type, mut detail_sub_type_address) = (String::new(), 0);
+                const WITH_SUB_TYPE: [&str; 10] = ["StructProperty", "ObjectProperty", "ClassProperty", "ArrayProperty", "EnumProperty", "ByteProperty", "SoftClassProperty", "SoftObjectProperty", "SetProperty", "InterfaceProperty"];
+                if WITH_SUB_TYPE.iter().any(|k| type_name.contains(k)) {
+                    if let Some((n, a)) = [prop_8, prop_0, type_obj].into_iter().find_map(&detail_name) {
+                        (detail_sub_type, detail_sub_type_address) = (n, a);
+                    }
+                } else if type_name.contains("MapProperty") {
+                    detail_sub_type = [prop_0, prop_8].into_iter().filter_map(&detail_name).map(|(n, _)| n).collect::<Vec<_>>().join(", ");
+                }
+
+                own.push(LayoutMember { owner: address, name, type_name, is_property: t.contains("property"), offset, element_size, bit_mask, offset_label, role, value, sub_type, struct_address, detail_sub_type, detail_sub_type_address });
+            }
+            child_addr = mem.try_read_pointer(child_addr.wrapping_add(offsets.next_member)).unwrap_or(0);
+        }
+
+        Self { address, prop_size, parent, own }
+    }
+}
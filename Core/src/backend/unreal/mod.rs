@@ -1,6 +1,14 @@
 pub mod autoconfig;
+pub mod build_cache;
 pub mod dumper;
+pub mod hierarchy;
+pub mod layout;
 pub mod name_pool;
 pub mod object_array;
 pub mod offsets;
+pub mod package_index;
+pub mod ref_index;
+pub mod sdk;
+pub mod search_index;
+pub mod snapshot;
 pub mod types;
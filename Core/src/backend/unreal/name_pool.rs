@@ -1,13 +1,62 @@
 use crate::backend::os::process::Process;
+use crate::backend::os::profile::{LookupCounters, LookupStats};
+use crate::backend::os::text;
 use dashmap::DashMap;
 use rayon::prelude::*;
 use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::OnceLock;
 use tauri::Emitter;
 
+/// FNameBlockOffsets entries per block, addressed with a 2-byte stride
+pub const NAME_BLOCK_SIZE: usize = 0x10000 * 2;
+/// Bytes fetched per ReadProcessMemory while streaming a block
+const NAME_CHUNK_SIZE: usize = 0x10000;
+/// FNameMaxBlocks — the block index is the upper 13 bits of an FName id
+pub const NAME_MAX_BLOCKS: usize = 8192;
+
+/// Every name of one FNamePool block packed into a single string.
+/// `offsets` holds the entry offsets (in 2-byte units) in ascending order, `ends[i]` where entry i stops in `text`.
+struct NameBlock {
+    text: String,
+    offsets: Vec<u16>,
+    ends: Vec<u32>,
+    /// Units walked when the block was decoded; ids past this were not allocated yet
+    walked: usize,
+}
+
+impl NameBlock {
+    #[inline]
+    fn lookup(&self, unit: u32) -> Option<&str> {
+        let i = self.offsets.binary_search(&(unit as u16)).ok()?;
+        let start = if i == 0 { 0 } else { self.ends[i - 1] as usize };
+        Some(&self.text[start..self.ends[i] as usize])
+    }
+
+    fn len(&self) -> usize {
+        self.offsets.len()
+    }
+}
+
 pub struct FNamePool {
     base_address: usize,
     string_offset: AtomicUsize,
-    cache: DashMap<u32, String>,
+    /// Decoded blocks, filled once (by `parse_pool` or on first lookup) and read without locking afterwards
+    blocks: Box<[OnceLock<NameBlock>]>,
+    /// Names appended by the game after their block was decoded. Entries are never removed or replaced,
+    /// so the boxed strings stay put for the lifetime of the pool.
+    late: DashMap<u32, Box<str>>,
+    /// Lookups answered by an already decoded block, against those that had to decode it first
+    block_lookups: LookupCounters,
+    late_lookups: LookupCounters,
+}
+
+/// Lookup counters of one pool, for /api/metrics
+#[derive(Debug, Clone, Copy, Default, serde::Serialize)]
+pub struct NamePoolStats {
+    pub decoded_blocks: usize,
+    pub late_names: usize,
+    pub blocks: LookupStats,
+    pub late: LookupStats,
 }
 
 #[derive(Clone, serde::Serialize)]
@@ -20,72 +69,122 @@ struct ProgressPayload {
 
 impl FNamePool {
     pub fn new(base_address: usize) -> Self {
-        Self { base_address, string_offset: AtomicUsize::new(usize::MAX), cache: DashMap::new() }
+        Self { base_address, string_offset: AtomicUsize::new(usize::MAX), blocks: (0..NAME_MAX_BLOCKS).map(|_| OnceLock::new()).collect(), late: DashMap::new(), block_lookups: LookupCounters::new(), late_lookups: LookupCounters::new() }
+    }
+
+    pub fn base_address(&self) -> usize {
+        self.base_address
+    }
+
+    pub fn stats(&self) -> NamePoolStats {
+        NamePoolStats { decoded_blocks: self.blocks.iter().filter(|b| b.get().is_some()).count(), late_names: self.late.len(), blocks: self.block_lookups.stats(), late: self.late_lookups.stats() }
     }
 
+    /// Owned copy of `name`, for callers that store the result
     pub fn get_name(&self, process: &Process, id: u32) -> Result<String, String> {
-        if let Some(cached_name) = self.cache.get(&id) {
-            return Ok(cached_name.clone());
+        self.name(process, id).map(str::to_owned)
+    }
+
+    /// Borrowed lookup. Once a block is decoded this is a binary search in its table — no allocation, no lock.
+    pub fn name(&self, process: &Process, id: u32) -> Result<&str, String> {
+        let block = (id >> 16) as usize;
+        let unit = id & 0xFFFF;
+
+        let slot = self.blocks.get(block).ok_or_else(|| format!("Invalid name block: {}", block))?;
+        let decoded = slot.get();
+        self.block_lookups.hit(decoded.is_some());
+        let names = match decoded {
+            Some(names) => names,
+            None => self.load_block(process, block)?,
+        };
+
+        if let Some(name) = names.lookup(unit) {
+            return Ok(name);
         }
+        if (unit as usize) < names.walked {
+            return Err(format!("No name entry at id {}", id));
+        }
+        self.late_name(process, id)
+    }
 
-        let block = id >> 16;
-        let offset = (id & 65535) as usize;
+    /// Bytes of `block` walked when it was decoded, None while it has not been decoded
+    pub fn decoded_bytes(&self, block: usize) -> Option<usize> {
+        self.blocks.get(block)?.get().map(|names| names.walked * 2)
+    }
 
-        // FNamePool_Entry is at base_address + 0x10
-        let name_pool_entry = self.base_address.wrapping_add(0x10);
-        let current_block_address = process.memory.read_pointer(name_pool_entry.wrapping_add((block as usize) * 8))?;
+    /// Lookup that never touches process memory: only names already decoded (or resolved late) are returned
+    pub fn cached_name(&self, id: u32) -> Option<&str> {
+        if let Some(name) = self.blocks.get((id >> 16) as usize)?.get().and_then(|names| names.lookup(id & 0xFFFF)) {
+            return Some(name);
+        }
+        // SAFETY: see `late`
+        self.late_lookups.get(&self.late, &id).map(|name| unsafe { &*(&**name as *const str) })
+    }
 
-        // Offset shift is 2 (2 bytes per char pointer essentially)
-        let name_entry_address = current_block_address.wrapping_add(offset * 2);
+    fn ensure_string_offset(&self, process: &Process) -> Result<usize, String> {
+        let offset = self.string_offset.load(Ordering::Acquire);
+        if offset != usize::MAX {
+            return Ok(offset);
+        }
+        // Block 0 always holds "None", "ByteProperty", ... so the string offset can be found from its head
+        let block0 = process.memory.read_pointer(self.base_address.wrapping_add(0x10))?;
+        let mut head = [0u8; 0x80];
+        if !process.memory.read_into(block0, &mut head) {
+            return Err(format!("Failed to read memory at 0x{:X}", block0));
+        }
+        self.discover_string_offset(&head)
+    }
 
-        let name_length = process.memory.read::<u16>(name_entry_address)? >> 6;
+    fn load_block(&self, process: &Process, block: usize) -> Result<&NameBlock, String> {
+        let string_offset = self.ensure_string_offset(process)?;
+        let block_address = process.memory.read_pointer(self.base_address.wrapping_add(0x10).wrapping_add(block * 8))?;
+        if block_address <= 0x10000 {
+            return Err(format!("Name block {} is not allocated", block));
+        }
+        let names = Self::decode_block(process, block_address, string_offset);
+        Ok(self.blocks[block].get_or_init(|| names))
+    }
 
-        if name_length < 1 || name_length > 200 {
-            return Err(format!("Invalid name length: {}", name_length));
+    /// Direct read of a single entry that was not there yet when its block was decoded
+    fn late_name(&self, process: &Process, id: u32) -> Result<&str, String> {
+        if let Some(name) = self.late_lookups.get(&self.late, &id) {
+            // SAFETY: the Box<str> is never dropped or mutated while `self` lives (see `late`)
+            return Ok(unsafe { &*(&**name as *const str) });
         }
 
-        let mut offset_val = self.string_offset.load(Ordering::Acquire);
-
-        // Lazy offset discovery
-        if offset_val == usize::MAX {
-            if id > 0 && id < 7 && name_length > 10 && name_length < 15 {
-                for i in 2..0x20 {
-                    if let Ok(buf) = process.memory.read_bytes(name_entry_address.wrapping_add(i), name_length as usize) {
-                        if let Ok(s) = std::str::from_utf8(&buf) {
-                            if s == "ByteProperty" || s.contains("ByteProperty") {
-                                self.string_offset.compare_exchange(usize::MAX, i, Ordering::Release, Ordering::Relaxed).ok();
-                                offset_val = i;
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-            // If still uninitialized, we can't read it yet, or we fall back
-            if offset_val == usize::MAX {
-                return Err("Name pool string offset not initialized yet".to_string());
-            }
+        let string_offset = self.ensure_string_offset(process)?;
+        let block_address = process.memory.read_pointer(self.base_address.wrapping_add(0x10).wrapping_add((id >> 16) as usize * 8))?;
+        let name_entry_address = block_address.wrapping_add((id & 0xFFFF) as usize * 2);
+
+        let header = process.memory.read::<u16>(name_entry_address)?;
+        let name_length = header >> 6;
+        if name_length < 1 || name_length > 200 {
+            return Err(format!("Invalid name length: {}", name_length));
         }
 
-        let name_str_address = name_entry_address.wrapping_add(offset_val);
-        let read_str = process.memory.read_string(name_str_address, name_length as usize)?;
+        let name_str_address = name_entry_address.wrapping_add(string_offset);
+        let is_wide = header & 1 != 0;
+        let byte_length = if is_wide { name_length as usize * 2 } else { name_length as usize };
+        let read_str = process.memory.read_with(name_str_address, byte_length, |bytes| decode_name(bytes, is_wide)).ok_or_else(|| format!("Failed to read memory at 0x{:X}", name_str_address))?;
 
-        self.cache.insert(id, read_str.clone());
-        Ok(read_str)
+        let name = self.late.entry(id).or_insert_with(|| read_str.into_boxed_str());
+        // SAFETY: as above
+        Ok(unsafe { &*(&**name as *const str) })
     }
 
-    /// Multithreaded parser that counts chunks, emits progress
-    pub fn parse_pool(&self, process: &Process, app_handle: &tauri::AppHandle) -> Result<(u32, u32), String> {
+    /// Multithreaded parser that counts chunks, emits progress (unless `app_handle` is None, e.g. for benchmark runs).
+    /// Each name block is streamed in `NAME_CHUNK_SIZE` reads and its FNameEntry headers are walked locally.
+    pub fn parse_pool(&self, process: &Process, app_handle: Option<&tauri::AppHandle>) -> Result<(u32, u32), String> {
         // 讀取 NamePool 的 Chunk 數量
         let name_pool_entry = self.base_address.wrapping_add(0x10);
-        let mut valid_blocks = 0;
+        let mut block_addresses = Vec::new();
         let mut null_cnt = 0;
 
         for i in 0..500 {
             if let Ok(block_address) = process.memory.read_pointer(name_pool_entry.wrapping_add(i * 8)) {
                 // Confirm it's a valid pointer by trying to read from it
                 if block_address > 0x10000 && process.memory.read_pointer(block_address).is_ok() {
-                    valid_blocks += 1;
+                    block_addresses.push((i, block_address));
                     null_cnt = 0; // Reset null count if we found a valid block, matching original C++ logic
                 } else {
                     null_cnt += 1;
@@ -98,48 +197,126 @@ impl FNamePool {
                 break;
             }
         }
+        let valid_blocks = block_addresses.len();
 
-        // 開始分析字串，停止條件為找到 /Script/CoreUObject 或讀取完所有字串 (總之先做多第一輪大規模的分析)
-        let total_names_capacity = valid_blocks << 0x10; // 2^16 (4bytes) = 65536
-        let batch_size = 0x200;
-        let num_batches = (total_names_capacity + batch_size - 1) / batch_size;
+        let string_offset = self.ensure_string_offset(process)?;
 
         let progress = AtomicUsize::new(0);
         let valid_names_count = AtomicUsize::new(0);
-        let dynamic_total_names = AtomicUsize::new(10_000);
-        let max_block_reached = AtomicUsize::new(0); // high-watermark for current_chunk
 
-        // Required to satisfy Send trait over rayon boundaries if Process contains raw HANDLE
-        // We know HANDLE is sync/send safe in our context.
-        let process_ref = process;
-
-        (0..num_batches).into_par_iter().for_each(|batch_idx| {
-            let start = batch_idx * batch_size;
-            let end = start + batch_size;
-            let mut local_valid_names = 0;
-
-            for id in start..end {
-                if self.get_name(process_ref, id as u32).is_ok() {
-                    local_valid_names += 1;
-                }
-            }
+        block_addresses.par_iter().for_each(|&(block, block_address)| {
+            // Blocks already decoded by an earlier lookup are kept as they are
+            let local_valid_names = self.blocks[block].get_or_init(|| Self::decode_block(process, block_address, string_offset)).len();
 
             let current_total_names = valid_names_count.fetch_add(local_valid_names, Ordering::Relaxed) + local_valid_names;
             let current = progress.fetch_add(1, Ordering::Relaxed) + 1;
 
-            if current % 100 == 0 || current == num_batches {
-                // Both use fetch_max so bars only ever advance, never jump back
-                let displayed_chunk = max_block_reached.fetch_max(start >> 16, Ordering::Relaxed).max(start >> 16);
-                let displayed_total = dynamic_total_names.fetch_max(current_total_names + 1, Ordering::Relaxed).max(current_total_names + 1);
-                app_handle.emit("fname-pool-progress", ProgressPayload { current_chunk: displayed_chunk, total_chunks: valid_blocks, current_names: current_total_names, total_names: displayed_total }).ok();
+            // Blocks finish out of order, so the estimate only ever grows to keep the bar from jumping back
+            let estimated_total = (current_total_names * valid_blocks / current).max(current_total_names + 1);
+            if let Some(app_handle) = app_handle {
+                app_handle.emit("fname-pool-progress", ProgressPayload { current_chunk: current, total_chunks: valid_blocks, current_names: current_total_names, total_names: estimated_total }).ok();
             }
         });
 
         let final_count = valid_names_count.load(Ordering::Relaxed);
         let final_target = final_count; // 最後一刻把 total 設成實際的 total，讓進度條 100% 滿格
 
-        app_handle.emit("fname-pool-progress", ProgressPayload { current_chunk: valid_blocks, total_chunks: valid_blocks, current_names: final_count, total_names: final_target }).ok();
+        if let Some(app_handle) = app_handle {
+            app_handle.emit("fname-pool-progress", ProgressPayload { current_chunk: valid_blocks, total_chunks: valid_blocks, current_names: final_count, total_names: final_target }).ok();
+        }
 
         Ok((valid_blocks as u32, final_count as u32))
     }
+
+    /// Find where the characters start relative to the entry header by looking for "ByteProperty" among the first ids of block 0
+    fn discover_string_offset(&self, head: &[u8]) -> Result<usize, String> {
+        for id in 1..7usize {
+            let Some(header) = head.get(id * 2..id * 2 + 2) else { break };
+            let name_length = (u16::from_le_bytes([header[0], header[1]]) >> 6) as usize;
+            if name_length <= 10 || name_length >= 15 {
+                continue;
+            }
+            for i in 2..0x20 {
+                if let Some(buf) = head.get(id * 2 + i..id * 2 + i + name_length) {
+                    if std::str::from_utf8(buf).map(|s| s.contains("ByteProperty")).unwrap_or(false) {
+                        self.string_offset.compare_exchange(usize::MAX, i, Ordering::Release, Ordering::Relaxed).ok();
+                        return Ok(self.string_offset.load(Ordering::Acquire));
+                    }
+                }
+            }
+        }
+        Err("Name pool string offset could not be discovered from block 0".to_string())
+    }
+
+    /// Walk every FNameEntry in one block, reading it `NAME_CHUNK_SIZE` bytes at a time.
+    /// Entries that straddle a chunk boundary are completed by carrying the unread tail into the next read.
+    fn decode_block(process: &Process, block_address: usize, string_offset: usize) -> NameBlock {
+        let mut buf: Vec<u8> = Vec::with_capacity(NAME_CHUNK_SIZE * 2);
+        let mut buf_start = 0; // block-relative offset of buf[0]
+        let mut pos = 0; // block-relative offset of the next entry
+        let mut names = NameBlock { text: String::new(), offsets: Vec::new(), ends: Vec::new(), walked: 0 };
+
+        // Make sure [pos, end) is buffered, dropping consumed bytes before each new read.
+        // Chunks are read straight into the buffer's spare capacity, so the block streams through one allocation.
+        let fill = |buf: &mut Vec<u8>, buf_start: &mut usize, pos: usize, end: usize| -> bool {
+            while *buf_start + buf.len() < end {
+                let read_from = *buf_start + buf.len();
+                if read_from >= NAME_BLOCK_SIZE {
+                    return false;
+                }
+                buf.drain(..pos - *buf_start);
+                *buf_start = pos;
+                let want = NAME_CHUNK_SIZE.min(NAME_BLOCK_SIZE - read_from);
+                buf.reserve(want);
+                let Some(read) = process.memory.read_uninit(block_address + read_from, &mut buf.spare_capacity_mut()[..want]).map(|chunk| chunk.len()) else { return false };
+                // SAFETY: read_uninit initialized the first `read` spare bytes
+                unsafe { buf.set_len(buf.len() + read) };
+            }
+            true
+        };
+
+        while pos + 2 <= NAME_BLOCK_SIZE && fill(&mut buf, &mut buf_start, pos, pos + 2) {
+            let local = pos - buf_start;
+            let header = u16::from_le_bytes([buf[local], buf[local + 1]]);
+            let name_length = (header >> 6) as usize;
+
+            // The allocator leaves the unused tail of a block zeroed
+            if name_length == 0 {
+                break;
+            }
+
+            let is_wide = header & 1 != 0;
+            let byte_length = if is_wide { name_length * 2 } else { name_length };
+            let entry_size = (string_offset + byte_length + 1) & !1; // entries are 2-byte aligned
+            if !fill(&mut buf, &mut buf_start, pos, pos + entry_size) {
+                break;
+            }
+
+            let local = pos - buf_start;
+            let bytes = &buf[local + string_offset..local + string_offset + byte_length];
+            if is_wide {
+                text::push_utf16le(bytes, &mut names.text);
+            } else {
+                text::push_latin1(bytes, &mut names.text);
+            }
+            names.offsets.push((pos / 2) as u16);
+            names.ends.push(names.text.len() as u32);
+            pos += entry_size;
+        }
+
+        names.walked = pos / 2;
+        names.text.shrink_to_fit();
+        names.offsets.shrink_to_fit();
+        names.ends.shrink_to_fit();
+        names
+    }
+}
+
+/// Narrow entries are Latin-1, wide entries are UTF-16LE
+fn decode_name(bytes: &[u8], is_wide: bool) -> String {
+    if is_wide {
+        text::utf16le(bytes)
+    } else {
+        text::latin1(bytes).into_owned()
+    }
 }
@@ -1,166 +1,827 @@
+use crate::backend::os::memory::{CachedMemory, Memory};
 use crate::backend::os::process::Process;
+use crate::backend::os::profile::{LookupCounters, LookupStats};
+use crate::backend::unreal::hierarchy::ClassHierarchy;
+use crate::backend::unreal::layout::ClassLayout;
 use crate::backend::unreal::name_pool::FNamePool;
 use crate::backend::unreal::offsets::UEOffset;
+use crate::backend::unreal::package_index::PackageIndex;
+use crate::backend::unreal::ref_index::RefIndex;
+use crate::backend::unreal::search_index::{is_searchable_type, SearchIndex};
 use dashmap::DashMap;
 use rayon::prelude::*;
-use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::atomic::{AtomicBool, AtomicI32, AtomicU32, AtomicU64, AtomicU8, AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex, OnceLock};
 use tauri::Emitter;
 
 // ─── Data Structures ─────────────────────────────────────────────
 
-/// Lightweight object reference (mirrors C++ BasicObjectData)
-#[derive(Debug, Clone, Default)]
-pub struct BasicObjectData {
-    pub id: i32,
-    pub offset: i16,
-    pub type_name: String,
-    pub name: String,
-    pub full_name: String,
-    pub address: usize,
-}
+/// Dense index of a row in the object table
+pub type ObjectHandle = u32;
+pub const INVALID_HANDLE: ObjectHandle = u32::MAX;
 
-/// Full cached object data (mirrors C++ ObjectData : BasicObjectData)
-#[derive(Debug, Clone)]
+/// Name column sentinel for objects whose FName could not be read (C++: "InvalidName")
+const INVALID_NAME: u32 = u32::MAX;
+
+/// Owned decode result, used by AutoConfig probing where nothing is cached
+#[derive(Debug, Clone, Default)]
 pub struct ObjectData {
-    // ─── BasicObjectData fields ───
     pub address: usize,
     pub id: i32,
     pub name: String,
     pub type_name: String,
     pub full_name: String,
     pub outer: usize,
+    pub class_ptr: usize,
+}
 
-    // ─── Extended fields (C++ ObjectData) ───
-    pub class_ptr: usize,            // Raw class pointer address
-    pub class_info: BasicObjectData, // Resolved class info (C++: ClassPtr)
-    pub super_ptr: usize,            // Raw super struct pointer address
-    pub super_info: BasicObjectData, // Resolved super info (C++: SuperPtr)
+#[derive(Clone, serde::Serialize)]
+struct ProgressPayload {
+    current_chunk: usize,
+    total_chunks: usize,
+    current_objects: usize,
+    total_objects: usize,
+}
 
-    pub offset: i16,
-    pub prop_size: i16,
-    pub property: Vec<BasicObjectData>, // Property sub-objects
-    pub sub_type: Vec<usize>,           // SubType addresses
+// ─── Object Table (Struct-of-Arrays) ─────────────────────────────
+
+const SEGMENT_BITS: u32 = 16;
+const SEGMENT_LEN: usize = 1 << SEGMENT_BITS;
+const MAX_SEGMENTS: usize = 256; // 16M rows — well above MAX_OBJECT_QUANTITY plus referenced-only rows
+
+/// Row lifecycle. Rows are created on first reference and only ever move forward.
+const ROW_RESERVED: u8 = 0; // address known (referenced as class/outer/...), nothing decoded yet
+const ROW_DECODED: u8 = 1; // basic info valid, not part of the cache (depth limit, duplicate id, None name)
+const ROW_SAVED: u8 = 2; // C++: present in the address table
+
+/// One 64K-row slice of every column. Columns are atomics so rows can be filled while others read them.
+struct Segment {
+    address: Box<[AtomicUsize]>,
+    id: Box<[AtomicI32]>,
+    name: Box<[AtomicU32]>,
+    type_name: Box<[AtomicU32]>,
+    outer: Box<[AtomicU32]>,
+    class: Box<[AtomicU32]>,
+    super_struct: Box<[AtomicU32]>,
+    member: Box<[AtomicU32]>,
+    property: Box<[AtomicU32]>,
+    state: Box<[AtomicU8]>,
+    /// Deep analysis ran (or is running) for the row; a shallow parse leaves it unset until a command asks
+    expanded: Box<[AtomicBool]>,
+}
 
-    pub member_ptr: BasicObjectData, // First member child (C++: MemberPtr)
-    pub member_size: usize,
+impl Segment {
+    fn new() -> Self {
+        fn column<T>(init: impl Fn() -> T) -> Box<[T]> {
+            (0..SEGMENT_LEN).map(|_| init()).collect()
+        }
+        let handle = || AtomicU32::new(INVALID_HANDLE);
+        Self { address: column(|| AtomicUsize::new(0)), id: column(|| AtomicI32::new(0)), name: column(|| AtomicU32::new(INVALID_NAME)), type_name: column(|| AtomicU32::new(0)), outer: column(handle), class: column(handle), super_struct: column(handle), member: column(handle), property: column(handle), state: column(|| AtomicU8::new(ROW_RESERVED)), expanded: column(|| AtomicBool::new(false)) }
+    }
+}
 
-    pub bit_mask: i32,
-    pub funct: usize, // Function address
+/// Append-only columnar store; a handle stays valid (and keeps its address) until `clear`
+struct ObjectTable {
+    segments: Box<[OnceLock<Segment>]>,
+    /// Handles handed out so far; rows at or above `len` may still be initialising
+    reserved: AtomicU32,
+    /// Published rows: every handle below it has its segment and address in place
+    len: AtomicU32,
 }
 
-impl ObjectData {
-    pub fn empty() -> Self {
-        Self {
-            address: 0,
-            id: 0,
-            name: String::new(),
-            type_name: String::new(),
-            full_name: String::new(),
-            outer: 0,
-            class_ptr: 0,
-            class_info: BasicObjectData::default(),
-            super_ptr: 0,
-            super_info: BasicObjectData::default(),
-            offset: 0,
-            prop_size: 0,
-            property: Vec::new(),
-            sub_type: Vec::new(),
-            member_ptr: BasicObjectData::default(),
-            member_size: 0,
-            bit_mask: 0,
-            funct: 0,
-        }
-    }
-
-    /// C++: BasicObjectDataWapper — pack ObjectData into BasicObjectData
-    pub fn to_basic(&self) -> BasicObjectData {
-        BasicObjectData { id: self.id, offset: self.offset, type_name: self.type_name.clone(), name: self.name.clone(), full_name: self.full_name.clone(), address: self.address }
+impl ObjectTable {
+    fn new() -> Self {
+        Self { segments: (0..MAX_SEGMENTS).map(|_| OnceLock::new()).collect(), reserved: AtomicU32::new(0), len: AtomicU32::new(0) }
+    }
+
+    #[inline]
+    fn row(&self, handle: ObjectHandle) -> (&Segment, usize) {
+        // Handles below `len` always have their segment initialised by `push`
+        (self.segments[(handle >> SEGMENT_BITS) as usize].get().expect("object handle out of range"), handle as usize & (SEGMENT_LEN - 1))
+    }
+
+    /// The row is filled before it is published, and rows are published in handle order, so `0..len()` walks never see
+    /// a handle whose segment or address is missing. The wait for earlier pushers is a few stores long, except for the
+    /// one push per segment that allocates it.
+    fn push(&self, address: usize) -> Option<ObjectHandle> {
+        let handle = self.reserved.fetch_add(1, Ordering::AcqRel);
+        if handle as usize >= MAX_SEGMENTS * SEGMENT_LEN {
+            self.reserved.fetch_sub(1, Ordering::AcqRel);
+            return None;
+        }
+        let segment = self.segments[(handle >> SEGMENT_BITS) as usize].get_or_init(Segment::new);
+        segment.address[handle as usize & (SEGMENT_LEN - 1)].store(address, Ordering::Release);
+        while self.len.compare_exchange_weak(handle, handle + 1, Ordering::Release, Ordering::Relaxed).is_err() {
+            std::thread::yield_now();
+        }
+        Some(handle)
+    }
+
+    fn len(&self) -> u32 {
+        self.len.load(Ordering::Acquire)
+    }
+
+    /// Rows are reset rather than freed so the segments can be reused by the next parse
+    fn clear(&self) {
+        for handle in 0..self.len() {
+            let (seg, i) = self.row(handle);
+            seg.state[i].store(ROW_RESERVED, Ordering::Relaxed);
+            seg.expanded[i].store(false, Ordering::Relaxed);
+            seg.name[i].store(INVALID_NAME, Ordering::Relaxed);
+            for column in [&seg.outer, &seg.class, &seg.super_struct, &seg.member, &seg.property] {
+                column[i].store(INVALID_HANDLE, Ordering::Relaxed);
+            }
+        }
+        self.len.store(0, Ordering::Release);
+        self.reserved.store(0, Ordering::Release);
     }
 }
 
-#[derive(Clone, serde::Serialize)]
-struct ProgressPayload {
-    current_chunk: usize,
-    total_chunks: usize,
-    current_objects: usize,
-    total_objects: usize,
+/// Borrowed view of one row; names resolve into the FNamePool arena without allocating
+#[derive(Clone, Copy)]
+pub struct ObjectView<'a> {
+    objects: &'a ObjectManager,
+    names: &'a FNamePool,
+    handle: ObjectHandle,
+}
+
+impl<'a> ObjectView<'a> {
+    #[inline]
+    fn row(&self) -> (&'a Segment, usize) {
+        self.objects.table.row(self.handle)
+    }
+
+    #[inline]
+    fn link(&self, column: fn(&Segment) -> &[AtomicU32]) -> Option<ObjectView<'a>> {
+        let (seg, i) = self.row();
+        self.objects.decoded_view(column(seg)[i].load(Ordering::Acquire), self.names)
+    }
+
+    pub fn handle(&self) -> ObjectHandle {
+        self.handle
+    }
+
+    pub fn address(&self) -> usize {
+        let (seg, i) = self.row();
+        seg.address[i].load(Ordering::Acquire)
+    }
+
+    pub fn id(&self) -> i32 {
+        let (seg, i) = self.row();
+        seg.id[i].load(Ordering::Relaxed)
+    }
+
+    pub fn name(&self) -> &'a str {
+        let (seg, i) = self.row();
+        match seg.name[i].load(Ordering::Relaxed) {
+            INVALID_NAME => "InvalidName",
+            id => self.names.cached_name(id).unwrap_or("InvalidName"),
+        }
+    }
+
+    /// FName id of the name (u32::MAX when it could not be read)
+    pub fn name_id(&self) -> u32 {
+        let (seg, i) = self.row();
+        seg.name[i].load(Ordering::Relaxed)
+    }
+
+    pub fn type_name(&self) -> &'a str {
+        let (seg, i) = self.row();
+        self.names.cached_name(seg.type_name[i].load(Ordering::Relaxed)).unwrap_or_default()
+    }
+
+    /// Outer object, if it has been decoded
+    pub fn outer(&self) -> Option<ObjectView<'a>> {
+        self.link(|seg| &seg.outer)
+    }
+
+    pub fn outer_address(&self) -> usize {
+        let (seg, i) = self.row();
+        self.objects.address_of(seg.outer[i].load(Ordering::Relaxed))
+    }
+
+    pub fn class(&self) -> Option<ObjectView<'a>> {
+        self.link(|seg| &seg.class)
+    }
+
+    /// Raw class pointer (0 when the object was decoded through the FField path)
+    pub fn class_ptr(&self) -> usize {
+        let (seg, i) = self.row();
+        self.objects.address_of(seg.class[i].load(Ordering::Relaxed))
+    }
+
+    pub fn super_struct(&self) -> Option<ObjectView<'a>> {
+        self.link(|seg| &seg.super_struct)
+    }
+
+    pub fn super_ptr(&self) -> usize {
+        let (seg, i) = self.row();
+        self.objects.address_of(seg.super_struct[i].load(Ordering::Relaxed))
+    }
+
+    /// First member child (C++: MemberPtr)
+    pub fn member(&self) -> Option<ObjectView<'a>> {
+        self.link(|seg| &seg.member)
+    }
+
+    /// C++: SubType — the first property object, or its own first property when it has one
+    pub fn sub_type(&self) -> Option<ObjectView<'a>> {
+        let prop = self.link(|seg| &seg.property)?;
+        prop.link(|seg| &seg.property).or(Some(prop))
+    }
+
+    fn is_prop_or_func(&self) -> bool {
+        let type_name = self.type_name();
+        type_name.contains("Property") || type_name.contains("Function")
+    }
+
+    pub fn full_name(&self) -> String {
+        let mut out = String::new();
+        self.write_full_name(&mut out);
+        out
+    }
+
+    /// C++ GetFullName: chase up to 10 Outers, joining with ':' where a Property/Function meets its owner.
+    /// Writes into `out` (cleared first) so hot loops can reuse one buffer.
+    pub fn write_full_name(&self, out: &mut String) {
+        out.clear();
+        let mut chain: [(&str, &str); 11] = [("", ""); 11];
+        chain[0] = (self.name(), "");
+        let mut n = 1;
+
+        if !self.type_name().contains("Property") {
+            let mut current = *self;
+            while n < chain.len() {
+                let Some(new_obj) = current.outer() else { break };
+                chain[n - 1].1 = if current.is_prop_or_func() && !new_obj.is_prop_or_func() { ":" } else { "." };
+                chain[n] = (new_obj.name(), "");
+                n += 1;
+                current = new_obj;
+            }
+        }
+
+        for k in (0..n).rev() {
+            out.push_str(chain[k].0);
+            if k > 0 {
+                out.push_str(chain[k - 1].1);
+            }
+        }
+    }
+}
+
+/// One table row in snapshot form. Links are handles, i.e. row indexes, so a table imported in order is identical.
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct RowRecord {
+    pub address: u64,
+    pub id: i32,
+    pub name: u32,
+    pub type_name: u32,
+    pub outer: u32,
+    pub class: u32,
+    pub super_struct: u32,
+    pub member: u32,
+    pub property: u32,
+    pub state: u32,
+    /// ROW_FLAG_BY_ID: the row owns its id in the ID table
+    pub flags: u32,
+}
+
+const ROW_FLAG_BY_ID: u32 = 1;
+
+/// An `in_flight` entry owned by the decoding worker; dropping it lets the waiters look at the row
+struct Claim<'a> {
+    in_flight: &'a DashMap<usize, ()>,
+    address: usize,
 }
 
-// ─── ObjectManager (Two-Tier DashMap Cache) ──────────────────────
+impl Drop for Claim<'_> {
+    fn drop(&mut self) {
+        self.in_flight.remove(&self.address);
+    }
+}
 
-/// Thread-safe object cache using DashMap for concurrent read/write
+/// Basic info read straight from memory (C++ GetBasicInfo_1/_2); name ids are FName ids
+struct BasicInfo {
+    id: i32,
+    name: u32,
+    type_name: u32,
+    outer: usize,
+    class_ptr: usize,
+}
+
+// ─── ObjectManager ───────────────────────────────────────────────
+
+/// Thread-safe object cache: a columnar table of dense handles plus address/ID indexes
 pub struct ObjectManager {
-    /// Primary cache: Address -> ObjectData (prevents duplicate analysis)
-    pub cache_by_address: DashMap<usize, ObjectData>,
-    /// Secondary cache: ID -> Address (quick lookup by object ID)
-    pub cache_by_id: DashMap<i32, usize>,
+    table: ObjectTable,
+    /// Address -> handle for every row (saved or merely referenced)
+    by_address: DashMap<usize, ObjectHandle>,
+    /// ID -> handle (quick lookup by object ID, non-Property objects only)
+    by_id: DashMap<i32, ObjectHandle>,
     /// Object counter
     pub total_object_count: AtomicUsize,
+    /// SuperStruct/instance index, rebuilt on demand once the table has changed
+    hierarchy: Mutex<Option<Arc<ClassHierarchy>>>,
+    /// Name index for global_search, same lifetime rules as `hierarchy`
+    search_index: Mutex<Option<Arc<SearchIndex>>>,
+    /// Package/category listing for the PackageViewer; extended in place of a rebuild when the table only grew
+    package_index: Mutex<Option<Arc<PackageIndex>>>,
+    /// Pointer reverse index; optional (it reads every object), so only built when asked for, then extended like `package_index`
+    ref_index: Mutex<Option<Arc<RefIndex>>>,
+    /// Member layouts by class address, for the instance inspector; dropped when anything is evicted or the offsets change
+    layouts: DashMap<usize, Arc<ClassLayout>>,
+    layouts_epoch: AtomicU64,
+    /// GUObjectArray slots as of the last parse or resync, per (item chunk, batch start); what `GUObjectArray::resync` diffs against
+    slots: DashMap<(usize, usize), Box<[Slot]>>,
+    /// Saved rows dropped by a resync; row and object counts alone can't tell a free followed by a new object
+    evictions: AtomicU64,
+    /// Bumped by every change the hierarchy, search and reference indexes read: a saved UObject (it has a class) or
+    /// searchable type, a SuperStruct link, an eviction. Reserved rows and the FField rows an expand saves leave it alone.
+    index_revision: AtomicU64,
+    /// Addresses whose header a worker is decoding right now; the entry is the claim
+    in_flight: DashMap<usize, ()>,
+    /// The last parse was shallow; a resync decodes its fresh slots the same way
+    shallow: AtomicBool,
+    decode: DecodeCounters,
+    /// by_address, by_id and layouts lookups (hits, misses, shards found locked), reset by `clear`
+    address_lookups: LookupCounters,
+    id_lookups: LookupCounters,
+    layout_lookups: LookupCounters,
+}
+
+/// Scheduler counters, reset by `clear`
+#[derive(Default)]
+struct DecodeCounters {
+    decoded: AtomicU64,
+    reused: AtomicU64,
+    waited: AtomicU64,
+    tasks: AtomicU64,
+    deferred: AtomicU64,
+    expanded: AtomicU64,
+}
+
+/// Snapshot of the decode scheduler counters
+#[derive(Clone, Copy, Debug, Default, serde::Serialize)]
+pub struct DecodeStats {
+    /// Headers read and decoded from process memory
+    pub decoded: u64,
+    /// Lookups answered by a row another worker had already decoded
+    pub reused: u64,
+    /// Lookups that found the address claimed and waited for that worker instead of decoding it again
+    pub waited: u64,
+    /// Deep-analysis tasks spawned onto the work-stealing pool
+    pub tasks: u64,
+    /// Objects a shallow parse saved without their deep analysis
+    pub deferred: u64,
+    /// Deferred deep analyses a command has since asked for
+    pub expanded: u64,
+}
+
+/// Index and cache counters of the ObjectManager, for /api/metrics
+#[derive(Clone, Copy, Debug, Default, serde::Serialize)]
+pub struct ObjectManagerStats {
+    pub objects: usize,
+    pub rows: usize,
+    pub layouts: usize,
+    pub addresses: LookupStats,
+    pub ids: LookupStats,
+    pub layout_cache: LookupStats,
+    pub decode: DecodeStats,
+}
+
+impl DecodeStats {
+    /// Header decodes that would have been repeated without claims and row reuse
+    pub fn duplicates_avoided(&self) -> u64 {
+        self.reused + self.waited
+    }
 }
 
 impl ObjectManager {
     pub fn new() -> Self {
-        Self { cache_by_address: DashMap::new(), cache_by_id: DashMap::new(), total_object_count: AtomicUsize::new(0) }
+        Self { table: ObjectTable::new(), by_address: DashMap::new(), by_id: DashMap::new(), total_object_count: AtomicUsize::new(0), hierarchy: Mutex::new(None), search_index: Mutex::new(None), package_index: Mutex::new(None), ref_index: Mutex::new(None), layouts: DashMap::new(), layouts_epoch: AtomicU64::new(0), slots: DashMap::new(), evictions: AtomicU64::new(0), index_revision: AtomicU64::new(0), in_flight: DashMap::new(), shallow: AtomicBool::new(false), decode: DecodeCounters::default(), address_lookups: LookupCounters::new(), id_lookups: LookupCounters::new(), layout_lookups: LookupCounters::new() }
     }
 
     pub fn clear(&self) {
-        self.cache_by_address.clear();
-        self.cache_by_id.clear();
+        self.by_address.clear();
+        self.by_id.clear();
+        self.table.clear();
         self.total_object_count.store(0, Ordering::Relaxed);
+        self.index_revision.fetch_add(1, Ordering::AcqRel);
+        *self.hierarchy.lock().unwrap() = None;
+        *self.search_index.lock().unwrap() = None;
+        *self.package_index.lock().unwrap() = None;
+        *self.ref_index.lock().unwrap() = None;
+        self.layouts.clear();
+        self.slots.clear();
+        for counter in [&self.decode.decoded, &self.decode.reused, &self.decode.waited, &self.decode.tasks, &self.decode.deferred, &self.decode.expanded] {
+            counter.store(0, Ordering::Relaxed);
+        }
+        for lookups in [&self.address_lookups, &self.id_lookups, &self.layout_lookups] {
+            lookups.reset();
+        }
+    }
+
+    pub fn decode_stats(&self) -> DecodeStats {
+        let c = &self.decode;
+        DecodeStats { decoded: c.decoded.load(Ordering::Relaxed), reused: c.reused.load(Ordering::Relaxed), waited: c.waited.load(Ordering::Relaxed), tasks: c.tasks.load(Ordering::Relaxed), deferred: c.deferred.load(Ordering::Relaxed), expanded: c.expanded.load(Ordering::Relaxed) }
+    }
+
+    pub fn stats(&self) -> ObjectManagerStats {
+        ObjectManagerStats { objects: self.len(), rows: self.table.len() as usize, layouts: self.layouts.len(), addresses: self.address_lookups.stats(), ids: self.id_lookups.stats(), layout_cache: self.layout_lookups.stats(), decode: self.decode_stats() }
+    }
+
+    // ─── Lookups ───
+
+    fn state(&self, handle: ObjectHandle) -> u8 {
+        let (seg, i) = self.table.row(handle);
+        seg.state[i].load(Ordering::Acquire)
+    }
+
+    fn address_of(&self, handle: ObjectHandle) -> usize {
+        if handle == INVALID_HANDLE {
+            return 0;
+        }
+        let (seg, i) = self.table.row(handle);
+        seg.address[i].load(Ordering::Acquire)
+    }
+
+    fn decoded_view<'a>(&'a self, handle: ObjectHandle, names: &'a FNamePool) -> Option<ObjectView<'a>> {
+        (handle != INVALID_HANDLE && self.state(handle) >= ROW_DECODED).then_some(ObjectView { objects: self, names, handle })
+    }
+
+    /// Number of cached (saved) objects
+    pub fn len(&self) -> usize {
+        self.total_object_count.load(Ordering::Relaxed)
+    }
+
+    pub fn id_count(&self) -> usize {
+        self.by_id.len()
+    }
+
+    /// C++: address table membership
+    pub fn contains(&self, address: usize) -> bool {
+        self.address_lookups.get(&self.by_address, &address).map(|h| self.state(*h) == ROW_SAVED).unwrap_or(false)
+    }
+
+    pub fn contains_id(&self, id: i32) -> bool {
+        self.by_id.contains_key(&id)
+    }
+
+    pub fn address_by_id(&self, id: i32) -> Option<usize> {
+        self.id_lookups.get(&self.by_id, &id).map(|h| self.address_of(*h))
+    }
+
+    /// Cached object at `address`
+    pub fn get<'a>(&'a self, address: usize, names: &'a FNamePool) -> Option<ObjectView<'a>> {
+        let handle = *self.address_lookups.get(&self.by_address, &address)?;
+        (self.state(handle) == ROW_SAVED).then_some(ObjectView { objects: self, names, handle })
+    }
+
+    /// All cached objects in handle order
+    pub fn iter<'a>(&'a self, names: &'a FNamePool) -> impl Iterator<Item = ObjectView<'a>> + 'a {
+        (0..self.table.len()).filter(move |&h| self.state(h) == ROW_SAVED).map(move |handle| ObjectView { objects: self, names, handle })
+    }
+
+    /// Handle of the row at `address`, saved or merely referenced
+    pub fn handle_of(&self, address: usize) -> Option<ObjectHandle> {
+        self.address_lookups.get(&self.by_address, &address).map(|h| *h)
+    }
+
+    /// Cached object for `handle`
+    pub fn view<'a>(&'a self, handle: ObjectHandle, names: &'a FNamePool) -> Option<ObjectView<'a>> {
+        (handle < self.table.len() && self.state(handle) == ROW_SAVED).then_some(ObjectView { objects: self, names, handle })
+    }
+
+    /// Rows in the table, including referenced-only ones; handles are `0..row_count()`
+    pub fn row_count(&self) -> u32 {
+        self.table.len()
+    }
+
+    /// Changes whenever rows are added, saved or evicted; index builders record it to detect staleness
+    pub fn revision(&self) -> (u32, usize, u64) {
+        (self.row_count(), self.len(), self.evictions.load(Ordering::Acquire))
+    }
+
+    /// Changes only with the rows class/struct indexes consume (see `index_revision`), so expanding an object on demand
+    /// doesn't make the next query rebuild them
+    pub fn index_revision(&self) -> u64 {
+        self.index_revision.load(Ordering::Acquire)
+    }
+
+    /// (saved, class handle, super handle) of a row, for index builders
+    pub fn links(&self, handle: ObjectHandle) -> (bool, ObjectHandle, ObjectHandle) {
+        let (seg, i) = self.table.row(handle);
+        (seg.state[i].load(Ordering::Acquire) == ROW_SAVED, seg.class[i].load(Ordering::Acquire), seg.super_struct[i].load(Ordering::Acquire))
+    }
+
+    /// Every row in handle order, for snapshots
+    pub fn export_rows(&self) -> Vec<RowRecord> {
+        let owned: std::collections::HashSet<ObjectHandle> = self.by_id.iter().map(|entry| *entry.value()).collect();
+        (0..self.table.len())
+            .map(|handle| {
+                let (seg, i) = self.table.row(handle);
+                let link = |column: &[AtomicU32]| column[i].load(Ordering::Acquire);
+                RowRecord {
+                    address: seg.address[i].load(Ordering::Acquire) as u64,
+                    id: seg.id[i].load(Ordering::Relaxed),
+                    name: seg.name[i].load(Ordering::Relaxed),
+                    type_name: seg.type_name[i].load(Ordering::Relaxed),
+                    outer: link(&seg.outer),
+                    class: link(&seg.class),
+                    super_struct: link(&seg.super_struct),
+                    member: link(&seg.member),
+                    property: link(&seg.property),
+                    state: seg.state[i].load(Ordering::Acquire) as u32,
+                    flags: if owned.contains(&handle) { ROW_FLAG_BY_ID } else { 0 },
+                }
+            })
+            .collect()
+    }
+
+    /// Replace the table with exported rows; nothing is decoded, the columns are copied as they are
+    pub fn import_rows(&self, rows: impl Iterator<Item = RowRecord>) -> Result<(), String> {
+        self.clear();
+        for (expected, row) in rows.enumerate() {
+            let handle = self.table.push(row.address as usize).ok_or("Snapshot has more rows than the object table holds")?;
+            if handle as usize != expected {
+                return Err("Object table was modified while the snapshot was loading".to_string());
+            }
+            let (seg, i) = self.table.row(handle);
+            seg.id[i].store(row.id, Ordering::Relaxed);
+            seg.name[i].store(row.name, Ordering::Relaxed);
+            seg.type_name[i].store(row.type_name, Ordering::Relaxed);
+            for (column, value) in [(&seg.outer, row.outer), (&seg.class, row.class), (&seg.super_struct, row.super_struct), (&seg.member, row.member), (&seg.property, row.property)] {
+                column[i].store(value, Ordering::Relaxed);
+            }
+            seg.state[i].store(row.state.min(ROW_SAVED as u32) as u8, Ordering::Release);
+            self.by_address.insert(row.address as usize, handle);
+            if row.flags & ROW_FLAG_BY_ID != 0 {
+                self.by_id.insert(row.id, handle);
+            }
+            if row.state == ROW_SAVED as u32 {
+                self.total_object_count.fetch_add(1, Ordering::Relaxed);
+            }
+        }
+        self.index_revision.fetch_add(1, Ordering::AcqRel);
+        Ok(())
+    }
+
+    /// Class hierarchy index for the current table, built on first use after a change
+    pub fn hierarchy(&self) -> Arc<ClassHierarchy> {
+        let mut cached = self.hierarchy.lock().unwrap();
+        match cached.as_ref() {
+            Some(h) if h.is_current(self) => Arc::clone(h),
+            _ => {
+                let start = std::time::Instant::now();
+                let h = Arc::new(ClassHierarchy::build(self));
+                println!("[ ClassHierarchy ] Indexed {} rows in {:?}", self.row_count(), start.elapsed());
+                *cached = Some(Arc::clone(&h));
+                h
+            }
+        }
+    }
+
+    /// Search index for the current table, built on first use after a change
+    pub fn search_index(&self, names: &FNamePool, process: &Process, offsets: &UEOffset) -> Arc<SearchIndex> {
+        let mut cached = self.search_index.lock().unwrap();
+        match cached.as_ref() {
+            Some(index) if index.is_current(self) => Arc::clone(index),
+            _ => {
+                let start = std::time::Instant::now();
+                let index = Arc::new(SearchIndex::build(self, names, process, offsets));
+                println!("[ SearchIndex ] Built in {:?}", start.elapsed());
+                *cached = Some(Arc::clone(&index));
+                index
+            }
+        }
+    }
+
+    /// Package index for the current table, built on first use and extended after a parse or resync that only added rows
+    pub fn package_index(&self, names: &FNamePool) -> Arc<PackageIndex> {
+        let mut cached = self.package_index.lock().unwrap();
+        match cached.as_ref() {
+            Some(index) if index.is_current(self) => Arc::clone(index),
+            previous => {
+                let start = std::time::Instant::now();
+                let index = Arc::new(match previous {
+                    Some(index) if index.can_extend(self) => index.extend(self, names),
+                    _ => PackageIndex::build(self, names),
+                });
+                println!("[ PackageIndex ] {} rows indexed in {:?}", self.row_count(), start.elapsed());
+                *cached = Some(Arc::clone(&index));
+                index
+            }
+        }
+    }
+
+    /// Reference index for the current table: built on first use, extended with the new rows after a parse or resync
+    pub fn ref_index(&self, names: &FNamePool, process: &Process, offsets: &UEOffset) -> Arc<RefIndex> {
+        let mut cached = self.ref_index.lock().unwrap();
+        match cached.as_ref() {
+            Some(index) if index.is_current(self) => Arc::clone(index),
+            previous => {
+                let start = std::time::Instant::now();
+                let index = Arc::new(match previous {
+                    Some(index) if index.can_extend(self) => index.extend(self, process, names, offsets),
+                    _ => RefIndex::build(self, process, names, offsets),
+                });
+                println!("[ RefIndex ] {} references from {} objects ({} KB read) in {:?}", index.len(), index.stats.objects_read, index.stats.bytes_read / 1024, start.elapsed());
+                *cached = Some(Arc::clone(&index));
+                index
+            }
+        }
+    }
+
+    /// Re-read the pointers of `referrers` in the reference index (building it first if there is none)
+    pub fn refresh_references(&self, referrers: &[ObjectHandle], names: &FNamePool, process: &Process, offsets: &UEOffset) -> Arc<RefIndex> {
+        let current = self.ref_index(names, process, offsets);
+        let index = Arc::new(current.refresh(referrers, self, process, names, offsets));
+        *self.ref_index.lock().unwrap() = Some(Arc::clone(&index));
+        index
+    }
+
+    /// Layout of the class or struct at `address`, its SuperStruct chain included; built on first use
+    pub fn class_layout(&self, address: usize, process: &Process, names: &FNamePool, offsets: &UEOffset) -> Arc<ClassLayout> {
+        // An evicted address may now hold a different class
+        let epoch = self.evictions.load(Ordering::Acquire);
+        if self.layouts_epoch.swap(epoch, Ordering::AcqRel) != epoch {
+            self.layouts.clear();
+        }
+        self.layout_at(address, process, names, offsets, 0)
+    }
+
+    fn layout_at(&self, address: usize, process: &Process, names: &FNamePool, offsets: &UEOffset, depth: usize) -> Arc<ClassLayout> {
+        if let Some(layout) = self.layout_lookups.get(&self.layouts, &address) {
+            return Arc::clone(&layout);
+        }
+        let super_addr = process.memory.try_read_pointer(address.wrapping_add(offsets.super_struct)).unwrap_or(0);
+        // Same depth cap add_inspector uses for the hierarchy
+        let parent = (super_addr > 0x10000 && super_addr != address && depth < 50).then(|| self.layout_at(super_addr, process, names, offsets, depth + 1));
+        let layout = Arc::new(ClassLayout::build(address, parent, process, self, names, offsets));
+        Arc::clone(self.layouts.entry(address).or_insert(layout).value())
+    }
+
+    /// Offsets changed (AutoConfig); layouts were read with the old ones
+    pub fn clear_layouts(&self) {
+        self.layouts.clear();
+    }
+
+    /// Get or create the row for `address`
+    fn reserve(&self, address: usize) -> ObjectHandle {
+        if address < 0x10000 {
+            return INVALID_HANDLE;
+        }
+        if let Some(handle) = self.address_lookups.get(&self.by_address, &address) {
+            return *handle;
+        }
+        *self.by_address.entry(address).or_insert_with(|| self.table.push(address).unwrap_or(INVALID_HANDLE))
+    }
+
+    fn set_link(&self, handle: ObjectHandle, column: fn(&Segment) -> &[AtomicU32], target: ObjectHandle) {
+        let (seg, i) = self.table.row(handle);
+        column(seg)[i].store(target, Ordering::Release);
+    }
+
+    /// SuperStruct link; the hierarchy is built from these, so setting one is an index change
+    fn set_super(&self, handle: ObjectHandle, super_addr: usize) {
+        let target = self.reserve(super_addr);
+        let (seg, i) = self.table.row(handle);
+        if seg.super_struct[i].swap(target, Ordering::AcqRel) != target {
+            self.index_revision.fetch_add(1, Ordering::AcqRel);
+        }
+    }
+
+    /// Drop the object at `address` from the cache (its slot was freed or reused). The row goes back to reserved rather than
+    /// away, so handles stay stable and a new object allocated at the same address simply decodes into it again.
+    fn evict(&self, address: usize) -> bool {
+        let Some(handle) = self.handle_of(address) else { return false };
+        let (seg, i) = self.table.row(handle);
+        let previous = seg.state[i].swap(ROW_RESERVED, Ordering::AcqRel);
+        if previous == ROW_RESERVED {
+            return false;
+        }
+        self.by_id.remove_if(&seg.id[i].load(Ordering::Relaxed), |_, h| *h == handle);
+        seg.expanded[i].store(false, Ordering::Relaxed);
+        seg.name[i].store(INVALID_NAME, Ordering::Relaxed);
+        for column in [&seg.outer, &seg.class, &seg.super_struct, &seg.member, &seg.property] {
+            column[i].store(INVALID_HANDLE, Ordering::Relaxed);
+        }
+        if previous == ROW_SAVED {
+            self.total_object_count.fetch_sub(1, Ordering::Relaxed);
+            self.evictions.fetch_add(1, Ordering::AcqRel);
+            self.index_revision.fetch_add(1, Ordering::AcqRel);
+        }
+        previous == ROW_SAVED
     }
 
     // ═══════════════════════════════════════════════════════════════
     //  TrySaveObject — 100% faithful port of C++ Object.cpp:256-377
     // ═══════════════════════════════════════════════════════════════
 
-    pub fn try_save_object(&self, address: usize, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, depth: usize, max_depth: usize, is_autoconfig: bool) -> Option<ObjectData> {
-        // ─── IsPointer check (C++ line 264) ───
-        if address < 0x10000 {
-            return None;
+    /// Returns once the object and everything its deep analysis discovered are saved.
+    /// An object a shallow parse already saved gets its deferred deep analysis here.
+    pub fn try_save_object<'a>(&'a self, address: usize, process: &Process, name_pool: &'a FNamePool, offsets: &UEOffset, depth: usize, max_depth: usize) -> Option<ObjectView<'a>> {
+        let handle = rayon::scope(|tasks| {
+            let mem = Reader::direct(process);
+            let handle = self.save_object(address, mem, name_pool, offsets, depth, max_depth, true, tasks)?.handle;
+            self.expand_row(handle, mem, name_pool, offsets, depth, max_depth, tasks);
+            Some(handle)
+        })?;
+        Some(ObjectView { objects: self, names: name_pool, handle })
+    }
+
+    /// Run the deep analysis a shallow parse skipped for the object at `address`; false if it is not saved or already expanded
+    pub fn expand(&self, address: usize, process: &Process, name_pool: &FNamePool, offsets: &UEOffset) -> bool {
+        let Some(handle) = self.get(address, name_pool).map(|obj| obj.handle) else { return false };
+        rayon::scope(|tasks| self.expand_row(handle, Reader::direct(process), name_pool, offsets, 0, 5, tasks))
+    }
+
+    /// Memoized: the `expanded` swap lets exactly one caller run the analysis, whether that is the parse itself or a later command
+    fn expand_row<'s>(&'s self, handle: ObjectHandle, mem: Reader<'s>, name_pool: &'s FNamePool, offsets: &'s UEOffset, depth: usize, max_depth: usize, tasks: &rayon::Scope<'s>) -> bool {
+        let (seg, i) = self.table.row(handle);
+        if seg.state[i].load(Ordering::Acquire) != ROW_SAVED || seg.expanded[i].swap(true, Ordering::AcqRel) {
+            return false;
         }
-        if process.memory.try_read_pointer(address).is_none() {
-            return None;
+        self.decode.expanded.fetch_add(1, Ordering::Relaxed);
+        let (address, class_ptr) = (seg.address[i].load(Ordering::Acquire), self.address_of(seg.class[i].load(Ordering::Relaxed)));
+        self.deep_analysis(handle, address, class_ptr, mem, name_pool, offsets, depth, max_depth, tasks);
+        true
+    }
+
+    /// Whether the last parse deferred deep analysis
+    pub fn is_shallow(&self) -> bool {
+        self.shallow.load(Ordering::Relaxed)
+    }
+
+    /// TrySaveObject for one GUObjectArray batch: fetch the headers of the batch, then of the Class/Outer/Super/Member/FieldClass
+    /// objects they point at, in a few coalesced reads, and decode from those local copies instead of one syscall per field.
+    /// Without `deep` only the basic info, Outer chain and SuperStruct link are recorded (what listing and search need).
+    pub fn save_batch(&self, addresses: &[usize], process: &Process, name_pool: &FNamePool, offsets: &UEOffset, max_depth: usize, deep: bool) {
+        let roots: Vec<usize> = addresses.iter().copied().filter(|&a| a >= 0x10000 && !self.contains(a)).collect();
+        if roots.is_empty() {
+            return;
         }
 
-        // ─── Check cache: if already processed, return immediately (C++ line 267) ───
-        if !is_autoconfig {
-            if let Some(cached) = self.cache_by_address.get(&address) {
-                if !cached.full_name.is_empty() || cached.type_name.contains("Property") || cached.type_name.contains("Function") {
-                    return Some(cached.clone());
+        let header_size = Prefetch::header_size(offsets);
+        let mut prefetch = Prefetch::default();
+        prefetch.fetch(&process.memory, &mut roots.clone(), header_size);
+
+        // Second wave: everything the first decode step of each root dereferences (Super and Member only matter to deep analysis)
+        let followed: &[usize] = if deep { &[offsets.class, offsets.outer, offsets.super_struct, offsets.member, offsets.member_type_offset] } else { &[offsets.class, offsets.outer, offsets.member_type_offset] };
+        let mut linked = Vec::with_capacity(roots.len() * followed.len());
+        for &address in &roots {
+            for &offset in followed {
+                if let Some(ptr) = prefetch.read::<u64>(address.wrapping_add(offset)) {
+                    linked.push(ptr as usize);
                 }
             }
         }
+        prefetch.fetch(&process.memory, &mut linked, header_size);
 
-        // ─── GetBasicInfo (C++ line 270-271) ───
-        let mut obj = ObjectData::empty();
-        // C++: ClassPtr is captured by GetBasicInfo_2 into obj.class_ptr
-        if !self.get_basic_info_1(address, &mut obj, process, name_pool, offsets) {
-            if !self.get_basic_info_2(address, &mut obj, process, name_pool, offsets) {
-                return None;
+        let mem = Reader { process, prefetch: Some(&prefetch), cache: None };
+        rayon::scope(|tasks| {
+            for &address in &roots {
+                self.save_object(address, mem, name_pool, offsets, 0, max_depth, deep, tasks);
+
+                // 終止條件: too many objects
+                if self.total_object_count.load(Ordering::Relaxed) > MAX_OBJECT_QUANTITY {
+                    return;
+                }
             }
+        });
+    }
+
+    /// The decode itself runs inline because callers branch on its result; the deep analysis of a newly saved object
+    /// (C++ lines 320-368) is spawned onto `tasks` instead of recursing, so idle workers steal it
+    fn save_object<'s>(&'s self, address: usize, mem: Reader<'s>, name_pool: &'s FNamePool, offsets: &'s UEOffset, depth: usize, max_depth: usize, deep: bool, tasks: &rayon::Scope<'s>) -> Option<ObjectView<'s>> {
+        // ─── IsPointer check (C++ line 264) ───
+        if address < 0x10000 {
+            return None;
         }
-        obj.address = address;
-        if obj.name.is_empty() {
-            obj.name = "InvalidName".to_string();
-        }
-        if obj.type_name.is_empty() || obj.type_name.len() > 100 {
+        if mem.try_read_pointer(address).is_none() {
             return None;
         }
 
+        // ─── Check cache: if already processed, return immediately (C++ line 267) ───
+        if let Some(cached) = self.get(address, name_pool) {
+            self.decode.reused.fetch_add(1, Ordering::Relaxed);
+            return Some(cached);
+        }
+
+        // ─── GetBasicInfo (C++ line 270-271), once per address ───
+        let (handle, info) = self.claim_basic_info(address, mem, name_pool, offsets)?;
+        let obj = ObjectView { objects: self, names: name_pool, handle };
+
         // ─── Early return for None/InvalidName (C++ lines 273-274) ───
-        if obj.name == "None" || obj.name == "InvalidName" {
+        if obj.name() == "None" || obj.name() == "InvalidName" {
             return Some(obj);
         }
 
         // ─── GetFullName (C++ lines 277-278) ───
-        if !obj.type_name.contains("Property") && obj.address != obj.outer {
-            if obj.outer > 0x10000 {
-                self.resolve_full_name(&mut obj, process, name_pool, offsets, depth, max_depth, is_autoconfig);
-            } else {
-                obj.full_name = obj.name.clone();
-            }
-        } else {
-            obj.full_name = obj.name.clone();
+        // The name itself is assembled on demand from the Outer handles; what matters here is saving the Outers
+        if !obj.type_name().contains("Property") && address != info.outer && info.outer > 0x10000 {
+            self.save_outer_chain(info.outer, mem, name_pool, offsets, depth, max_depth, deep, tasks);
         }
 
         // ─── Level/depth overflow check (C++ line 282) ───
@@ -169,133 +830,236 @@ impl ObjectManager {
             return Some(obj);
         }
 
-        // ─── Early return for AutoConfig (SearchMode logic) ───
-        if is_autoconfig {
-            return Some(obj);
-        }
-
         // ─── First-time save block (C++ lines 284-303) ───
         {
-            // Save to ID table (C++ lines 286-293) — only for non-Property objects
-            if self.cache_by_id.contains_key(&obj.id) {
-                return Some(obj);
-            }
-            if !obj.type_name.contains("Property") {
-                if (obj.id as u32) < 0xFFFFFFFF {
-                    self.cache_by_id.insert(obj.id, address);
+            // Save to ID table (C++ lines 286-293) — only for non-Property objects; the entry makes check-and-insert one step
+            if !obj.type_name().contains("Property") && (info.id as u32) < 0xFFFFFFFF {
+                match self.by_id.entry(info.id) {
+                    dashmap::Entry::Occupied(_) => return Some(obj),
+                    dashmap::Entry::Vacant(slot) => {
+                        slot.insert(handle);
+                    }
                 }
+            } else if self.by_id.contains_key(&info.id) {
+                return Some(obj);
             }
 
-            // Save to address table (C++ lines 296-297)
-            if self.cache_by_address.contains_key(&address) {
+            // Save to address table (C++ lines 296-297) — exactly one thread wins the row
+            let (seg, i) = self.table.row(handle);
+            if seg.state[i].compare_exchange(ROW_DECODED, ROW_SAVED, Ordering::AcqRel, Ordering::Acquire).is_err() {
                 return Some(obj);
             }
-            self.cache_by_address.insert(address, obj.clone());
         }
 
         // ─── Object counter (C++ line 312) ───
         self.total_object_count.fetch_add(1, Ordering::Relaxed);
+        if info.class_ptr >= 0x10000 || is_searchable_type(obj.type_name()) {
+            self.index_revision.fetch_add(1, Ordering::AcqRel);
+        }
 
-        // ═══════════════════════════════════════════════════════════
-        //  Deep analysis — C++ lines 320-368
-        //  These recursive calls discover additional objects!
-        // ═══════════════════════════════════════════════════════════
-
-        // ─── Recursive: resolve ClassPtr (C++ lines 320-327) ───
-        if obj.class_ptr > 0x10000 {
-            if let Some(class_obj) = self.try_save_object(obj.class_ptr, process, name_pool, offsets, depth + 1, max_depth, is_autoconfig) {
-                obj.class_info = class_obj.to_basic();
+        if !deep {
+            // Shallow: the SuperStruct is a GUObjectArray object of its own, so reserving it is enough for the hierarchy;
+            // the rest of the analysis waits for `expand_row`
+            let super_addr = mem.try_read_pointer(address.wrapping_add(offsets.super_struct)).unwrap_or(0);
+            if super_addr > 0x10000 && super_addr != address {
+                self.set_super(handle, super_addr);
             }
+            self.decode.deferred.fetch_add(1, Ordering::Relaxed);
+            return Some(obj);
         }
 
-        // ─── Recursive: resolve SuperPtr (C++ lines 333-343) ───
-        let super_addr = process.memory.try_read_pointer(address.wrapping_add(offsets.super_struct)).unwrap_or(0);
+        let (seg, i) = self.table.row(handle);
+        seg.expanded[i].store(true, Ordering::Release);
+        self.decode.tasks.fetch_add(1, Ordering::Relaxed);
+        let class_ptr = info.class_ptr;
+        tasks.spawn(move |tasks| self.deep_analysis(handle, address, class_ptr, mem, name_pool, offsets, depth, max_depth, tasks));
+
+        Some(obj)
+    }
+
+    // ═══════════════════════════════════════════════════════════════
+    //  Deep analysis — C++ lines 320-368
+    //  These calls discover additional objects!
+    // ═══════════════════════════════════════════════════════════════
+
+    fn deep_analysis<'s>(&'s self, handle: ObjectHandle, address: usize, class_ptr: usize, mem: Reader<'s>, name_pool: &'s FNamePool, offsets: &'s UEOffset, depth: usize, max_depth: usize, tasks: &rayon::Scope<'s>) {
+        // ─── Resolve ClassPtr (C++ lines 320-327) ───
+        if class_ptr > 0x10000 {
+            self.save_object(class_ptr, mem, name_pool, offsets, depth + 1, max_depth, true, tasks);
+        }
+
+        // ─── Resolve SuperPtr (C++ lines 333-343) ───
+        let super_addr = mem.try_read_pointer(address.wrapping_add(offsets.super_struct)).unwrap_or(0);
         if super_addr > 0x10000 {
-            obj.super_ptr = super_addr;
-            if let Some(super_obj) = self.try_save_object(super_addr, process, name_pool, offsets, depth + 1, max_depth, is_autoconfig) {
-                obj.super_info = super_obj.to_basic();
-            }
+            self.set_super(handle, super_addr);
+            self.save_object(super_addr, mem, name_pool, offsets, depth + 1, max_depth, true, tasks);
         }
 
-        // ─── Property / Member / Function branches (C++ lines 346-368) ───
-        if obj.type_name.contains("Property") {
+        // ─── Property / Member branches (C++ lines 346-368) ───
+        // Offset/PropSize/BitMask/Func are not kept: every consumer re-reads them live from the object
+        let (seg, i) = self.table.row(handle);
+        if name_pool.cached_name(seg.type_name[i].load(Ordering::Relaxed)).unwrap_or_default().contains("Property") {
             // GetProperty (C++ lines 347-351)
-            self.get_property(&mut obj, address, process, name_pool, offsets, depth, max_depth, is_autoconfig);
+            self.get_property(handle, address, mem, name_pool, offsets, depth, max_depth, tasks);
         } else {
             // GetMember (C++ lines 354-358)
-            self.get_member(&mut obj, address, process, name_pool, offsets, depth, max_depth, is_autoconfig);
+            self.get_member(handle, address, mem, name_pool, offsets, depth, max_depth, tasks);
+        }
+    }
+
+    /// GetBasicInfo for a row, decoding the header at most once: a row that is already decoded answers from its columns,
+    /// and concurrent first lookups are settled by the `in_flight` entry (the losers wait for the winner's row)
+    fn claim_basic_info(&self, address: usize, mem: Reader<'_>, name_pool: &FNamePool, offsets: &UEOffset) -> Option<(ObjectHandle, BasicInfo)> {
+        if let Some(found) = self.decoded_info(address) {
+            self.decode.reused.fetch_add(1, Ordering::Relaxed);
+            return Some(found);
         }
 
-        if obj.type_name.contains("Function") {
-            // GetFunction (C++ lines 365-367)
-            obj.funct = process.memory.try_read_pointer(address.wrapping_add(offsets.funct)).unwrap_or(0);
+        let claimed = match self.in_flight.entry(address) {
+            dashmap::Entry::Occupied(_) => false,
+            dashmap::Entry::Vacant(slot) => {
+                slot.insert(());
+                true
+            }
+        };
+        if !claimed {
+            // The owner only reads one header, so this is a short wait; None means its decode failed
+            self.decode.waited.fetch_add(1, Ordering::Relaxed);
+            while self.in_flight.contains_key(&address) {
+                std::thread::yield_now();
+            }
+            return self.decoded_info(address);
         }
 
-        // ─── Final save: update with complete data (C++ line 371) ───
-        self.cache_by_address.insert(address, obj.clone());
+        // Released on every way out of the decode, a panic included, so waiters never spin on an abandoned claim
+        let _claim = Claim { in_flight: &self.in_flight, address };
+
+        // The previous owner may have finished between the first check and the claim
+        self.decoded_info(address).or_else(|| {
+            self.decode.decoded.fetch_add(1, Ordering::Relaxed);
+            let info = Self::get_basic_info(address, mem, name_pool, offsets)?;
+            let handle = self.reserve(address);
+            if handle == INVALID_HANDLE {
+                return None;
+            }
+            let (seg, i) = self.table.row(handle);
+            seg.id[i].store(info.id, Ordering::Relaxed);
+            seg.name[i].store(info.name, Ordering::Relaxed);
+            seg.type_name[i].store(info.type_name, Ordering::Relaxed);
+            seg.outer[i].store(self.reserve(info.outer), Ordering::Relaxed);
+            seg.class[i].store(self.reserve(info.class_ptr), Ordering::Relaxed);
+            seg.state[i].fetch_max(ROW_DECODED, Ordering::AcqRel);
+            Some((handle, info))
+        })
+    }
+
+    /// Basic info of an already decoded row, rebuilt from its columns
+    fn decoded_info(&self, address: usize) -> Option<(ObjectHandle, BasicInfo)> {
+        let handle = self.handle_of(address).filter(|&h| h != INVALID_HANDLE && self.state(h) >= ROW_DECODED)?;
+        let (seg, i) = self.table.row(handle);
+        let info = BasicInfo { id: seg.id[i].load(Ordering::Relaxed), name: seg.name[i].load(Ordering::Relaxed), type_name: seg.type_name[i].load(Ordering::Relaxed), outer: self.address_of(seg.outer[i].load(Ordering::Relaxed)), class_ptr: self.address_of(seg.class[i].load(Ordering::Relaxed)) };
+        Some((handle, info))
+    }
+
+    /// AutoConfig variant of TrySaveObject (C++ SearchMode): decode basic info and full name, never touch the object cache.
+    /// Reads go through `cache`, which the discovery probes share.
+    pub fn probe_object(&self, address: usize, process: &Process, cache: &CachedMemory<'_>, name_pool: &FNamePool, offsets: &UEOffset) -> Option<ObjectData> {
+        let mem = Reader { process, prefetch: None, cache: Some(cache) };
+        let mut obj = Self::probe_basic(address, mem, name_pool, offsets)?;
+        if obj.name == "None" || obj.name == "InvalidName" {
+            return Some(obj);
+        }
+
+        obj.full_name = obj.name.clone();
+        if obj.type_name.contains("Property") || obj.address == obj.outer {
+            return Some(obj);
+        }
+
+        let mut old_obj = obj.clone();
+        for _ in 0..10 {
+            if old_obj.outer < 0x10000 {
+                break;
+            }
+            let new_obj = match Self::probe_basic(old_obj.outer, mem, name_pool, offsets) {
+                Some(o) => o,
+                None => break,
+            };
+
+            let is_old_prop_or_func = old_obj.type_name.contains("Property") || old_obj.type_name.contains("Function");
+            let is_new_prop_or_func = new_obj.type_name.contains("Property") || new_obj.type_name.contains("Function");
+            let sep = if is_old_prop_or_func && !is_new_prop_or_func { ":" } else { "." };
+
+            obj.full_name = format!("{}{}{}", new_obj.name, sep, obj.full_name);
+            old_obj = new_obj;
+        }
 
         Some(obj)
     }
 
+    fn probe_basic(address: usize, mem: Reader<'_>, name_pool: &FNamePool, offsets: &UEOffset) -> Option<ObjectData> {
+        if address < 0x10000 || mem.try_read_pointer(address).is_none() {
+            return None;
+        }
+        let info = Self::get_basic_info(address, mem, name_pool, offsets)?;
+        let name = if info.name == INVALID_NAME { "InvalidName".to_string() } else { name_pool.name(mem.process, info.name).unwrap_or("InvalidName").to_string() };
+        Some(ObjectData { address, id: info.id, name, type_name: name_pool.name(mem.process, info.type_name).unwrap_or_default().to_string(), full_name: String::new(), outer: info.outer, class_ptr: info.class_ptr })
+    }
+
     // ═══════════════════════════════════════════════════════════════
-    //  GetBasicInfo_1 — C++ Object.cpp lines 23-46
-    //  For special objects (Members/Properties): reads via MemberTypeOffset
+    //  GetBasicInfo_1 / _2 — C++ Object.cpp lines 23-70
+    //  _1 for special objects (Members/Properties): reads via MemberTypeOffset
+    //  _2 standard path: reads via Class pointer
+    //  Also applies the TrySaveObject name/type validation (C++ line 270-272)
     // ═══════════════════════════════════════════════════════════════
 
-    fn get_basic_info_1(&self, address: usize, obj: &mut ObjectData, process: &Process, name_pool: &FNamePool, offsets: &UEOffset) -> bool {
+    fn get_basic_info(address: usize, mem: Reader<'_>, name_pool: &FNamePool, offsets: &UEOffset) -> Option<BasicInfo> {
+        let name_of = |id: i32| name_pool.name(mem.process, id as u32).ok().filter(|n| !n.is_empty());
+
+        let info = Self::get_basic_info_1(address, mem, offsets, &name_of).or_else(|| Self::get_basic_info_2(address, mem, offsets, &name_of))?;
+
+        let type_name = name_of(info.type_name as i32)?;
+        if type_name.len() > 100 {
+            return None;
+        }
+        Some(info)
+    }
+
+    fn get_basic_info_1<'n>(address: usize, mem: Reader<'_>, offsets: &UEOffset, name_of: &impl Fn(i32) -> Option<&'n str>) -> Option<BasicInfo> {
         // ID
-        obj.id = process.memory.try_read::<i32>(address.wrapping_add(offsets.id)).unwrap_or(0);
+        let id = mem.try_read::<i32>(address.wrapping_add(offsets.id)).unwrap_or(0);
         // Outer
-        obj.outer = process.memory.try_read_pointer(address.wrapping_add(offsets.outer)).unwrap_or(0);
+        let outer = mem.try_read_pointer(address.wrapping_add(offsets.outer)).unwrap_or(0);
 
         // Type via MemberTypeOffset chain
-        let type_ptr = process.memory.try_read_pointer(address.wrapping_add(offsets.member_type_offset)).unwrap_or(0);
-        let type_id = match process.memory.try_read::<i32>(type_ptr.wrapping_add(offsets.member_type)) {
-            Some(v) => v,
-            None => return false,
-        };
-        obj.type_name = name_pool.get_name(process, type_id as u32).unwrap_or_default();
-        if obj.type_name.is_empty() {
-            return false;
-        }
+        let type_ptr = mem.try_read_pointer(address.wrapping_add(offsets.member_type_offset)).unwrap_or(0);
+        let type_id = mem.try_read::<i32>(type_ptr.wrapping_add(offsets.member_type))?;
+        name_of(type_id)?;
 
         // Name via MemberFNameIndex
-        let name_id = process.memory.try_read::<i32>(address.wrapping_add(offsets.member_fname_index)).unwrap_or(0);
-        obj.name = name_pool.get_name(process, name_id as u32).unwrap_or_default();
-        if obj.name.is_empty() {
-            return !obj.type_name.is_empty();
-        }
+        let name_id = mem.try_read::<i32>(address.wrapping_add(offsets.member_fname_index)).unwrap_or(0);
+        let name = if name_of(name_id).is_some() { name_id as u32 } else { INVALID_NAME };
 
-        true
+        Some(BasicInfo { id, name, type_name: type_id as u32, outer, class_ptr: 0 })
     }
 
-    // ═══════════════════════════════════════════════════════════════
-    //  GetBasicInfo_2 — C++ Object.cpp lines 48-70
-    //  Standard path: reads via Class pointer
-    // ═══════════════════════════════════════════════════════════════
-
-    fn get_basic_info_2(&self, address: usize, obj: &mut ObjectData, process: &Process, name_pool: &FNamePool, offsets: &UEOffset) -> bool {
+    fn get_basic_info_2<'n>(address: usize, mem: Reader<'_>, offsets: &UEOffset, name_of: &impl Fn(i32) -> Option<&'n str>) -> Option<BasicInfo> {
         // Class
-        obj.class_ptr = process.memory.try_read_pointer(address.wrapping_add(offsets.class)).unwrap_or(0);
+        let class_ptr = mem.try_read_pointer(address.wrapping_add(offsets.class)).unwrap_or(0);
 
         // Type (from Class's FNameIndex)
-        let type_id = match process.memory.try_read::<i32>(obj.class_ptr.wrapping_add(offsets.fname_index)) {
-            Some(v) => v,
-            None => return false,
-        };
-        obj.type_name = name_pool.get_name(process, type_id as u32).unwrap_or_default();
+        let type_id = mem.try_read::<i32>(class_ptr.wrapping_add(offsets.fname_index))?;
 
         // Name
-        let name_id = process.memory.try_read::<i32>(address.wrapping_add(offsets.fname_index)).unwrap_or(0);
-        obj.name = name_pool.get_name(process, name_id as u32).unwrap_or_default();
+        let name_id = mem.try_read::<i32>(address.wrapping_add(offsets.fname_index)).unwrap_or(0);
+        let name = if name_of(name_id).is_some() { name_id as u32 } else { INVALID_NAME };
 
         // ID
-        obj.id = process.memory.try_read::<i32>(address.wrapping_add(offsets.id)).unwrap_or(0);
+        let id = mem.try_read::<i32>(address.wrapping_add(offsets.id)).unwrap_or(0);
 
         // Outer
-        obj.outer = process.memory.try_read_pointer(address.wrapping_add(offsets.outer)).unwrap_or(0);
+        let outer = mem.try_read_pointer(address.wrapping_add(offsets.outer)).unwrap_or(0);
 
-        true
+        Some(BasicInfo { id, name, type_name: type_id as u32, outer, class_ptr })
     }
 
     // ═══════════════════════════════════════════════════════════════
@@ -303,62 +1067,30 @@ impl ObjectManager {
     //  Chase the Outer chain, calling TrySaveObject on each Outer
     // ═══════════════════════════════════════════════════════════════
 
-    fn resolve_full_name(&self, obj: &mut ObjectData, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, depth: usize, max_depth: usize, is_autoconfig: bool) {
+    fn save_outer_chain<'s>(&'s self, outer: usize, mem: Reader<'s>, name_pool: &'s FNamePool, offsets: &'s UEOffset, depth: usize, max_depth: usize, deep: bool, tasks: &rayon::Scope<'s>) {
         // C++: int ConcateOuterCnt = 0; int MaxConcateOuterCnt = 10;
-        let mut concat_count = 0;
-        let max_concat = 10;
-
-        // C++: std::string TempStr = RetObjectData.Name;
-        let mut result = obj.name.clone();
-        // C++: NewObj = RetObjectData;
-        let mut current = obj.clone();
-
-        loop {
-            if concat_count >= max_concat {
-                break;
-            }
-            concat_count += 1;
-
-            // C++: OldObj = NewObj;
-            let old_obj = current.clone();
-
+        let mut current_outer = outer;
+        for _ in 0..10 {
             // C++: if (NewObj.Outer == NULL or !TrySaveObject(NewObj.Outer, NewObj, Level - 1)) break;
-            if current.outer == 0 || current.outer < 0x10000 {
+            if current_outer < 0x10000 {
                 break;
             }
-            let new_obj = match self.try_save_object(current.outer, process, name_pool, offsets, depth.saturating_sub(1), max_depth, is_autoconfig) {
-                Some(o) => o,
+            match self.save_object(current_outer, mem, name_pool, offsets, depth.saturating_sub(1), max_depth, deep, tasks) {
+                Some(new_obj) => current_outer = new_obj.outer_address(),
                 None => break,
-            };
-
-            // C++: separator logic
-            let is_old_prop_or_func = old_obj.type_name.contains("Property") || old_obj.type_name.contains("Function");
-            let is_new_prop_or_func = new_obj.type_name.contains("Property") || new_obj.type_name.contains("Function");
-            let sep = if is_old_prop_or_func && !is_new_prop_or_func { ":" } else { "." };
-
-            result = format!("{}{}{}", new_obj.name, sep, result);
-            current = new_obj;
+            }
         }
-
-        obj.full_name = result;
     }
 
     // ═══════════════════════════════════════════════════════════════
     //  PropertyProcess — C++ Object.cpp lines 111-127
-    //  TrySaveObject on a sub-object address, push to property/sub_type
+    //  TrySaveObject on a sub-object address, record the first one as the property link
     // ═══════════════════════════════════════════════════════════════
 
-    fn property_process(&self, obj: &mut ObjectData, address: usize, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, depth: usize, max_depth: usize, is_autoconfig: bool) -> bool {
-        if let Some(prop_obj) = self.try_save_object(address, process, name_pool, offsets, depth + 1, max_depth, is_autoconfig) {
-            let basic = prop_obj.to_basic();
-            obj.property.push(basic);
-
-            // SubType: if the property object has no sub-properties, use its address; otherwise use its first property's address
-            if prop_obj.property.is_empty() {
-                obj.sub_type.push(prop_obj.address);
-            } else {
-                obj.sub_type.push(prop_obj.property[0].address);
-            }
+    fn property_process<'s>(&'s self, handle: ObjectHandle, address: usize, mem: Reader<'s>, name_pool: &'s FNamePool, offsets: &'s UEOffset, depth: usize, max_depth: usize, tasks: &rayon::Scope<'s>) -> bool {
+        if let Some(prop_obj) = self.save_object(address, mem, name_pool, offsets, depth + 1, max_depth, true, tasks) {
+            let (seg, i) = self.table.row(handle);
+            seg.property[i].compare_exchange(INVALID_HANDLE, prop_obj.handle, Ordering::AcqRel, Ordering::Relaxed).ok();
             true
         } else {
             false
@@ -367,64 +1099,199 @@ impl ObjectManager {
 
     // ═══════════════════════════════════════════════════════════════
     //  GetProperty — C++ Object.cpp lines 129-184
-    //  Read Offset, PropSize, Property_0/8, TypeObject, BitMask
-    //  Then recursively resolve sub-types
+    //  Read Property_0/8, TypeObject, then recursively resolve sub-types
     // ═══════════════════════════════════════════════════════════════
 
-    fn get_property(&self, obj: &mut ObjectData, address: usize, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, depth: usize, max_depth: usize, is_autoconfig: bool) {
-        // Read Offset, PropSize
-        obj.offset = process.memory.try_read::<i16>(address.wrapping_add(offsets.offset)).unwrap_or(0);
-        obj.prop_size = process.memory.try_read::<i16>(address.wrapping_add(offsets.prop_size)).unwrap_or(0);
-
-        // Read Property_0, Property_8, TypeObject, BitMask
-        let property_0 = process.memory.try_read_pointer(address.wrapping_add(offsets.property)).unwrap_or(0);
-        let property_8 = process.memory.try_read_pointer(address.wrapping_add(offsets.property + 8)).unwrap_or(0);
-        let type_object = process.memory.try_read_pointer(address.wrapping_add(offsets.type_object)).unwrap_or(0);
-        obj.bit_mask = process.memory.try_read::<i32>(address.wrapping_add(offsets.bit_mask)).unwrap_or(0);
+    fn get_property<'s>(&'s self, handle: ObjectHandle, address: usize, mem: Reader<'s>, name_pool: &'s FNamePool, offsets: &'s UEOffset, depth: usize, max_depth: usize, tasks: &rayon::Scope<'s>) {
+        // Read Property_0, Property_8, TypeObject
+        let property_0 = mem.try_read_pointer(address.wrapping_add(offsets.property)).unwrap_or(0);
+        let property_8 = mem.try_read_pointer(address.wrapping_add(offsets.property + 8)).unwrap_or(0);
+        let type_object = mem.try_read_pointer(address.wrapping_add(offsets.type_object)).unwrap_or(0);
 
-        let type_name = &obj.type_name;
+        let (seg, i) = self.table.row(handle);
+        let type_name = name_pool.cached_name(seg.type_name[i].load(Ordering::Relaxed)).unwrap_or_default();
 
         if type_name.contains("StructProperty") || type_name.contains("ObjectProperty") || type_name.contains("ClassProperty") || type_name.contains("ArrayProperty") || type_name.contains("EnumProperty") || type_name.contains("ByteProperty") {
             // C++ lines 161-166: try Property_8 → Property_0 → TypeObject
-            if !self.property_process(obj, property_8, process, name_pool, offsets, depth, max_depth, is_autoconfig) {
-                if !self.property_process(obj, property_0, process, name_pool, offsets, depth, max_depth, is_autoconfig) {
-                    self.property_process(obj, type_object, process, name_pool, offsets, depth, max_depth, is_autoconfig);
+            if !self.property_process(handle, property_8, mem, name_pool, offsets, depth, max_depth, tasks) {
+                if !self.property_process(handle, property_0, mem, name_pool, offsets, depth, max_depth, tasks) {
+                    self.property_process(handle, type_object, mem, name_pool, offsets, depth, max_depth, tasks);
                 }
             }
         } else if type_name.contains("MapProperty") {
             // C++ lines 169-177: MapProperty
-            if self.try_save_object(property_8, process, name_pool, offsets, depth + 1, max_depth, is_autoconfig).is_some() {
-                self.property_process(obj, property_0, process, name_pool, offsets, depth, max_depth, is_autoconfig);
-                self.property_process(obj, property_8, process, name_pool, offsets, depth, max_depth, is_autoconfig);
-            } else if self.try_save_object(property_0, process, name_pool, offsets, depth + 1, max_depth, is_autoconfig).is_some() {
-                self.property_process(obj, type_object, process, name_pool, offsets, depth, max_depth, is_autoconfig);
-                self.property_process(obj, property_0, process, name_pool, offsets, depth, max_depth, is_autoconfig);
+            if self.save_object(property_8, mem, name_pool, offsets, depth + 1, max_depth, true, tasks).is_some() {
+                self.property_process(handle, property_0, mem, name_pool, offsets, depth, max_depth, tasks);
+                self.property_process(handle, property_8, mem, name_pool, offsets, depth, max_depth, tasks);
+            } else if self.save_object(property_0, mem, name_pool, offsets, depth + 1, max_depth, true, tasks).is_some() {
+                self.property_process(handle, type_object, mem, name_pool, offsets, depth, max_depth, tasks);
+                self.property_process(handle, property_0, mem, name_pool, offsets, depth, max_depth, tasks);
             }
-        } else if type_name.contains("BoolProperty") {
-            // C++ lines 180-181: BoolProperty — just store BitMask (already read above)
         }
     }
 
     // ═══════════════════════════════════════════════════════════════
     //  GetMember — C++ Object.cpp lines 186-199
-    //  Read the first Member child and its size
+    //  Link the first Member child
     // ═══════════════════════════════════════════════════════════════
 
-    fn get_member(&self, obj: &mut ObjectData, address: usize, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, depth: usize, max_depth: usize, is_autoconfig: bool) {
-        let member_address = process.memory.try_read_pointer(address.wrapping_add(offsets.member)).unwrap_or(0);
+    fn get_member<'s>(&'s self, handle: ObjectHandle, address: usize, mem: Reader<'s>, name_pool: &'s FNamePool, offsets: &'s UEOffset, depth: usize, max_depth: usize, tasks: &rayon::Scope<'s>) {
+        let member_address = mem.try_read_pointer(address.wrapping_add(offsets.member)).unwrap_or(0);
         // C++: TrySaveObject(MemberAddress, MemberObject, Level - 1, true)  — SkipGetFullName = true
-        if let Some(member_obj) = self.try_save_object(member_address, process, name_pool, offsets, depth + 1, max_depth, is_autoconfig) {
-            obj.member_ptr = member_obj.to_basic();
-            obj.member_size = process.memory.try_read::<usize>(address.wrapping_add(offsets.member + 8)).unwrap_or(0);
+        if let Some(member_obj) = self.save_object(member_address, mem, name_pool, offsets, depth + 1, max_depth, true, tasks) {
+            self.set_link(handle, |seg| &seg.member, member_obj.handle);
         }
     }
 }
 
+// ─── Batched Header Prefetch ─────────────────────────────────────
+
+/// Headers closer than this are fetched by the same read (the bytes in between are cheaper than another syscall)
+const PREFETCH_MAX_GAP: usize = 0x400;
+/// Upper bound for one coalesced read
+const PREFETCH_MAX_SPAN: usize = 0x10000;
+
+/// Local copies of UObject/FField headers for one batch, sorted by start address
+#[derive(Default)]
+struct Prefetch {
+    spans: Vec<(usize, Vec<u8>)>,
+}
+
+impl Prefetch {
+    /// Bytes from the start of an object that TrySaveObject reads with these offsets
+    fn header_size(offsets: &UEOffset) -> usize {
+        let ends = [offsets.id + 4, offsets.class + 8, offsets.fname_index + 4, offsets.outer + 8, offsets.super_struct + 8, offsets.member + 8, offsets.member_type_offset + 8, offsets.member_type + 4, offsets.member_fname_index + 4, offsets.property + 16, offsets.type_object + 8];
+        ends.into_iter().max().unwrap_or(0x80).min(0x400)
+    }
+
+    fn find(&self, address: usize, size: usize) -> Option<&[u8]> {
+        let idx = self.spans.partition_point(|(start, _)| *start <= address).checked_sub(1)?;
+        let (start, data) = &self.spans[idx];
+        let offset = address - start;
+        data.get(offset..offset.checked_add(size)?)
+    }
+
+    #[inline]
+    fn read<T: Copy>(&self, address: usize) -> Option<T> {
+        let bytes = self.find(address, std::mem::size_of::<T>())?;
+        Some(unsafe { std::ptr::read_unaligned(bytes.as_ptr() as *const T) })
+    }
+
+    /// Fetch the headers at `addresses` (skipping those already held), merging neighbours into one read
+    fn fetch(&mut self, memory: &Memory, addresses: &mut Vec<usize>, header_size: usize) {
+        addresses.retain(|&a| a >= 0x10000 && self.find(a, header_size).is_none());
+        addresses.sort_unstable();
+        addresses.dedup();
+
+        let mut i = 0;
+        while i < addresses.len() {
+            let start = addresses[i];
+            let mut end = start.saturating_add(header_size);
+            let mut j = i + 1;
+            while j < addresses.len() && addresses[j] <= end.saturating_add(PREFETCH_MAX_GAP) && addresses[j].saturating_add(header_size) - start <= PREFETCH_MAX_SPAN {
+                end = end.max(addresses[j].saturating_add(header_size));
+                j += 1;
+            }
+
+            match memory.read_bytes(start, end - start) {
+                Ok(data) => self.spans.push((start, data)),
+                // The merged range crosses an unreadable page: fall back to one read per header
+                Err(_) if j - i > 1 => {
+                    for &a in &addresses[i..j] {
+                        if let Ok(data) = memory.read_bytes(a, header_size) {
+                            self.spans.push((a, data));
+                        }
+                    }
+                }
+                Err(_) => {}
+            }
+            i = j;
+        }
+        self.spans.sort_unstable_by_key(|(start, _)| *start);
+    }
+}
+
+/// Memory access for the decoder: prefetched headers first, then the page cache if there is one, else a live read
+#[derive(Clone, Copy)]
+struct Reader<'a> {
+    process: &'a Process,
+    prefetch: Option<&'a Prefetch>,
+    cache: Option<&'a CachedMemory<'a>>,
+}
+
+impl<'a> Reader<'a> {
+    fn direct(process: &'a Process) -> Self {
+        Self { process, prefetch: None, cache: None }
+    }
+
+    #[inline]
+    fn try_read<T: Copy>(&self, address: usize) -> Option<T> {
+        if let Some(value) = self.prefetch.and_then(|p| p.read::<T>(address)) {
+            return Some(value);
+        }
+        match self.cache {
+            Some(cache) => cache.try_read::<T>(address),
+            None => self.process.memory.try_read::<T>(address),
+        }
+    }
+
+    #[inline]
+    fn try_read_pointer(&self, address: usize) -> Option<usize> {
+        self.try_read::<u64>(address).map(|v| v as usize)
+    }
+}
+
 // ─── GUObjectArray Parser ────────────────────────────────────────
 
 const MAX_OBJECT_ARRAY: usize = 0x1000;
 const MAX_OBJECT_QUANTITY: usize = 2_000_000;
 
+/// FUObjectItem: Object, Flags, ClusterRootIndex, SerialNumber
+const SLOT_SERIAL_OFFSET: usize = 0x10;
+/// Addresses listed per direction in a resync delta; the counts are always exact
+const DELTA_ADDRESS_LIMIT: usize = 4096;
+
+/// One FUObjectItem as last read
+#[derive(Clone, Copy, Default, PartialEq, Eq)]
+struct Slot {
+    object: usize,
+    /// 0 until a weak pointer to the object is made, so 0 -> N is not a reuse; items too small to hold one read as 0
+    serial: i32,
+}
+
+impl Slot {
+    fn decode(items: &[u8], element_size: usize) -> Box<[Slot]> {
+        let serial_at = (element_size >= SLOT_SERIAL_OFFSET + 4).then_some(SLOT_SERIAL_OFFSET);
+        (0..items.len() / element_size.max(1))
+            .map(|k| k * element_size)
+            .take_while(|&at| at + 8 <= items.len())
+            .map(|at| Slot { object: usize::from_ne_bytes(items[at..at + 8].try_into().unwrap()), serial: serial_at.map_or(0, |s| i32::from_ne_bytes(items[at + s..at + s + 4].try_into().unwrap())) })
+            .collect()
+    }
+
+    /// Still the object decoded last time
+    fn same_object(&self, now: &Slot) -> bool {
+        self.object == now.object && (self.serial == now.serial || self.serial == 0)
+    }
+}
+
+/// What a resync changed, emitted to the UI as `guobject-array-delta`
+#[derive(Clone, Default, serde::Serialize)]
+pub struct ObjectArrayDelta {
+    /// Slots that were empty and now hold an object
+    pub added: usize,
+    /// Slots whose object went away
+    pub freed: usize,
+    /// Slots holding a different object than before (new pointer or new serial)
+    pub reused: usize,
+    pub slots_scanned: usize,
+    pub total_objects: usize,
+    pub elapsed_ms: u64,
+    /// Addresses of the objects that entered / left the cache, at most DELTA_ADDRESS_LIMIT each
+    pub added_addresses: Vec<String>,
+    pub removed_addresses: Vec<String>,
+}
+
 pub struct GUObjectArray {
     base_address: usize,
 }
@@ -445,6 +1312,7 @@ impl GUObjectArray {
         start: usize,
         end: usize,
         element_size: usize,
+        deep: bool,
     ) {
         // Read Address_Level_2 from Address_Level_1 (dereference)
         let addr_level_2 = match process.memory.try_read_pointer(address) {
@@ -456,61 +1324,28 @@ impl GUObjectArray {
 
         // Pre-fetch the entire memory chunk for this batch in ONE syscall
         // If this fails, the whole chunk is invalid memory, and we can safely return early.
-        let chunk_data = match process.memory.read_bytes(addr_level_2.wrapping_add(start * element_size), batch_size_bytes) {
-            Ok(data) => data,
-            Err(_) => return, // Whole block is virtually unreadable, skip it.
+        // The items land in this thread's scratch buffer; only the decoded slots are kept (for a later resync)
+        let slots = match process.memory.read_with(addr_level_2.wrapping_add(start * element_size), batch_size_bytes, |items| Slot::decode(items, element_size)) {
+            Some(slots) => slots,
+            None => return, // Whole block is virtually unreadable, skip it.
         };
 
-        for i in start..=end {
-            // Relative byte offset inside our prefetched chunk
-            let local_offset = (i - start) * element_size;
-
-            // Safety check: Ensure we don't read past the chunk length
-            if local_offset + 8 > chunk_data.len() {
-                break;
-            }
-
-            // Read the 8-byte pointer directly from our Rust memory array
-            let addr_bytes: [u8; 8] = chunk_data[local_offset..local_offset + 8].try_into().unwrap_or([0; 8]);
-            let addr_level_3 = usize::from_ne_bytes(addr_bytes);
-
-            // IsPointer check — skip NULL/freed slots (holes in GUObjectArray)
-            if addr_level_3 < 0x10000 || process.memory.try_read_pointer(addr_level_3).is_none() {
-                continue;
-            }
+        // Skip NULL/freed slots (holes in GUObjectArray); the IsPointer check happens against the prefetched header
+        let addresses: Vec<usize> = slots.iter().map(|slot| slot.object).filter(|&addr_level_3| addr_level_3 >= 0x10000).collect();
+        obj_mgr.slots.insert((addr_level_2, start), slots);
 
-            // TrySaveObject
-            obj_mgr.try_save_object(addr_level_3, process, name_pool, offsets, 0, 5, false);
-
-            // 終止條件: too many objects
-            if obj_mgr.total_object_count.load(Ordering::Relaxed) > MAX_OBJECT_QUANTITY {
-                return;
-            }
-        }
+        // TrySaveObject, batched
+        obj_mgr.save_batch(&addresses, process, name_pool, offsets, 5, deep);
     }
 
-    /// Main parser: faithful port of C++ ParseGUObjectArray
-    pub fn parse_array(&self, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, element_size: usize, app_handle: &tauri::AppHandle, obj_mgr: &ObjectManager) -> Result<u32, String> {
+    /// The chunk walk of C++ ParseGUObjectArray: (byte index, Address_Level_1, SplitGUObjectArraySize) per valid chunk entry
+    fn chunk_table(&self, process: &Process, batch_size: usize) -> Vec<(usize, usize, usize)> {
         let loop_step: usize = 8; // ProcOffestAdd (64-bit)
-
-        // Matching original C++ variable names exactly
-        let guobject_array_element_cnt: usize = 0x200;
-        let guobject_array_element_size: usize = element_size; // Auto-detected, NOT hardcoded!
-        let guobject_array_batch_size: usize = guobject_array_element_size * guobject_array_element_cnt;
-
-        println!("[ GUObjectArray ] Using ElementSize = 0x{:X}, BatchSize = 0x{:X}", guobject_array_element_size, guobject_array_batch_size);
-
-        let dynamic_total = AtomicUsize::new(10_000);
+        let mut chunks = Vec::new();
         let mut null_cnt = 0usize; // C++: NullCnt — break after 3 consecutive null/invalid pointers
 
-        // 主程式開始，遞迴 GUObjectArray 找到目標 Object
         let mut i: usize = 0;
         while i < MAX_OBJECT_ARRAY {
-            // 終止條件
-            if obj_mgr.total_object_count.load(Ordering::Relaxed) > MAX_OBJECT_QUANTITY {
-                break;
-            }
-
             // ReadMem(Address_Level_1, GUObjectArrayBaseAddress + i)
             let addr_level_1 = match process.memory.read_pointer(self.base_address.wrapping_add(i)) {
                 Ok(addr) => addr,
@@ -547,20 +1382,172 @@ impl GUObjectArray {
             };
 
             // SplitGUObjectArraySize = floor((TempGUObjectArraySize / GUObjectArrayBatchSize) + 0.5)
-            let split_size = (region_size as f64 / guobject_array_batch_size as f64 + 0.5).floor() as usize;
-            if split_size == 0 {
-                i += loop_step;
-                continue;
+            let split_size = (region_size as f64 / batch_size as f64 + 0.5).floor() as usize;
+            if split_size > 0 {
+                println!("[ {:4} Get Region Size ] 0x{:X} \t{:08X}", i / loop_step + 1, addr_level_1, region_size);
+                chunks.push((i, addr_level_1, split_size));
+            }
+            i += loop_step;
+        }
+        chunks
+    }
+
+    /// Memory parse_array reads: the chunk table, each Address_Level_1 region and the FUObjectItem span behind it
+    /// (at most one 64K-element chunk). Snapshots capture these so the array can be parsed again from the file.
+    pub fn parse_ranges(&self, process: &Process, element_size: usize) -> Vec<(usize, usize)> {
+        let batch_size = element_size * 0x200;
+        let mut ranges = vec![(self.base_address, MAX_OBJECT_ARRAY)];
+        for (_, addr_level_1, split_size) in self.chunk_table(process, batch_size) {
+            ranges.push((addr_level_1, (split_size * batch_size).min(0x10_0000)));
+            if let Some(addr_level_2) = process.memory.try_read_pointer(addr_level_1) {
+                ranges.push((addr_level_2, ((split_size * batch_size + 1) * element_size).min((0x10000 + 1) * element_size)));
+            }
+        }
+        ranges
+    }
+
+    /// Incremental refresh against the slots recorded by the last parse_array/resync: re-read only the FUObjectItem arrays,
+    /// evict the objects of freed or reused slots and decode just the slots whose object changed
+    pub fn resync(&self, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, element_size: usize, obj_mgr: &ObjectManager) -> Result<ObjectArrayDelta, String> {
+        if obj_mgr.slots.is_empty() {
+            return Err("No previous GUObjectArray parse to resync against. Please run parse_guobject_array first.".to_string());
+        }
+        let start_time = std::time::Instant::now();
+        let batch_size = element_size * 0x200; // GUObjectArrayBatchSize, as in parse_array
+
+        // ─── 1. Re-read every batch and diff it against the recorded slots (no decoding yet) ───
+        let batches: Vec<(usize, usize)> = self
+            .chunk_table(process, batch_size)
+            .into_iter()
+            .filter_map(|(_, addr_level_1, split_size)| Some((process.memory.try_read_pointer(addr_level_1)?, split_size)))
+            .flat_map(|(addr_level_2, split_size)| (0..split_size).map(move |batch_idx| (addr_level_2, batch_idx.wrapping_mul(batch_size))))
+            .collect();
+
+        struct BatchDiff {
+            key: (usize, usize),
+            slots: Box<[Slot]>,
+            gone: Vec<usize>,
+            fresh: Vec<usize>,
+            added: usize,
+            freed: usize,
+            reused: usize,
+        }
+        let diffs: Vec<BatchDiff> = batches
+            .par_iter()
+            .filter_map(|&(addr_level_2, start)| {
+                // An unreadable batch tells us nothing; keep what we had
+                let slots = process.memory.read_with(addr_level_2.wrapping_add(start * element_size), (batch_size + 1) * element_size, |items| Slot::decode(items, element_size))?;
+                let previous = obj_mgr.slots.get(&(addr_level_2, start));
+                let mut diff = BatchDiff { key: (addr_level_2, start), slots: Box::new([]), gone: Vec::new(), fresh: Vec::new(), added: 0, freed: 0, reused: 0 };
+
+                // The last item of a batch is also the first of the next one; count it there
+                for (k, now) in slots.iter().enumerate().take(batch_size) {
+                    let before = previous.as_ref().and_then(|p| p.get(k).copied()).unwrap_or_default();
+                    if before.same_object(now) {
+                        continue;
+                    }
+                    let (was_live, is_live) = (before.object >= 0x10000, now.object >= 0x10000);
+                    match (was_live, is_live) {
+                        (false, true) => diff.added += 1,
+                        (true, false) => diff.freed += 1,
+                        (true, true) => diff.reused += 1,
+                        (false, false) => {}
+                    }
+                    if was_live {
+                        diff.gone.push(before.object);
+                    }
+                    if is_live {
+                        diff.fresh.push(now.object);
+                    }
+                }
+                drop(previous);
+                diff.slots = slots;
+                Some(diff)
+            })
+            .collect();
+
+        // Chunks or batches that no longer exist freed everything they held
+        let mut seen: std::collections::HashSet<(usize, usize)> = batches.iter().copied().collect();
+        let mut delta = ObjectArrayDelta::default();
+        let mut vanished = Vec::new();
+        for entry in obj_mgr.slots.iter() {
+            if seen.insert(*entry.key()) {
+                vanished.push(*entry.key());
+            }
+        }
+        for key in vanished {
+            if let Some((_, slots)) = obj_mgr.slots.remove(&key) {
+                let live: Vec<usize> = slots.iter().map(|slot| slot.object).filter(|&a| a >= 0x10000).collect();
+                delta.freed += live.len();
+                for address in live {
+                    if obj_mgr.evict(address) && delta.removed_addresses.len() < DELTA_ADDRESS_LIMIT {
+                        delta.removed_addresses.push(format!("0x{:X}", address));
+                    }
+                }
+            }
+        }
+
+        // ─── 2. Evict before decoding, so a new object at a recycled address decodes into a clean row ───
+        for diff in &diffs {
+            delta.added += diff.added;
+            delta.freed += diff.freed;
+            delta.reused += diff.reused;
+            delta.slots_scanned += diff.slots.len();
+            for &address in &diff.gone {
+                if obj_mgr.evict(address) && delta.removed_addresses.len() < DELTA_ADDRESS_LIMIT {
+                    delta.removed_addresses.push(format!("0x{:X}", address));
+                }
             }
+        }
+
+        // ─── 3. Decode only the changed slots, then make the new slots the baseline ───
+        diffs.par_iter().filter(|diff| !diff.fresh.is_empty()).for_each(|diff| obj_mgr.save_batch(&diff.fresh, process, name_pool, offsets, 5, !obj_mgr.is_shallow()));
+        for diff in diffs {
+            for &address in &diff.fresh {
+                if delta.added_addresses.len() < DELTA_ADDRESS_LIMIT && obj_mgr.contains(address) {
+                    delta.added_addresses.push(format!("0x{:X}", address));
+                }
+            }
+            obj_mgr.slots.insert(diff.key, diff.slots);
+        }
+
+        delta.total_objects = obj_mgr.len();
+        delta.elapsed_ms = start_time.elapsed().as_millis() as u64;
+        println!("[ GUObjectArray Resync ] +{} -{} ~{} of {} slots in {:?}; {} objects", delta.added, delta.freed, delta.reused, delta.slots_scanned, start_time.elapsed(), delta.total_objects);
+        Ok(delta)
+    }
 
-            println!("[ {:4} Get Region Size ] 0x{:X} \t{:08X}", i / loop_step + 1, addr_level_1, region_size);
+    /// Main parser: faithful port of C++ ParseGUObjectArray.
+    /// `shallow` saves every slot with its basic info only and leaves the deep analysis to `ObjectManager::expand`.
+    /// Progress is emitted through `app_handle` when there is one.
+    pub fn parse_array(&self, process: &Process, name_pool: &FNamePool, offsets: &UEOffset, element_size: usize, app_handle: Option<&tauri::AppHandle>, obj_mgr: &ObjectManager, shallow: bool) -> Result<u32, String> {
+        let loop_step: usize = 8; // ProcOffestAdd (64-bit)
+        obj_mgr.shallow.store(shallow, Ordering::Relaxed);
+
+        // Matching original C++ variable names exactly
+        let guobject_array_element_cnt: usize = 0x200;
+        let guobject_array_element_size: usize = element_size; // Auto-detected, NOT hardcoded!
+        let guobject_array_batch_size: usize = guobject_array_element_size * guobject_array_element_cnt;
+
+        println!("[ GUObjectArray ] Using ElementSize = 0x{:X}, BatchSize = 0x{:X}", guobject_array_element_size, guobject_array_batch_size);
+
+        let dynamic_total = AtomicUsize::new(10_000);
+
+        // 主程式開始，遞迴 GUObjectArray 找到目標 Object
+        for (i, addr_level_1, split_size) in self.chunk_table(process, guobject_array_batch_size) {
+            // 終止條件
+            if obj_mgr.total_object_count.load(Ordering::Relaxed) > MAX_OBJECT_QUANTITY {
+                break;
+            }
 
             // Emit progress for Object (Current) bar
             let batch_progress = AtomicUsize::new(0);
             let arr_idx = i / loop_step;
             let arr_total = MAX_OBJECT_ARRAY / loop_step;
 
-            app_handle.emit("guobject-array-progress", ProgressPayload { current_chunk: arr_idx, total_chunks: arr_total, current_objects: obj_mgr.total_object_count.load(Ordering::Relaxed), total_objects: dynamic_total.load(Ordering::Relaxed) }).ok();
+            if let Some(app_handle) = app_handle {
+                app_handle.emit("guobject-array-progress", ProgressPayload { current_chunk: arr_idx, total_chunks: arr_total, current_objects: obj_mgr.total_object_count.load(Ordering::Relaxed), total_objects: dynamic_total.load(Ordering::Relaxed) }).ok();
+            }
 
             // ═══ Rayon parallel: faithful port of Pool.submit_loop(0, SplitGUObjectArraySize, ...) ═══
             (0..split_size).into_par_iter().for_each(|batch_idx| {
@@ -575,29 +1562,31 @@ impl GUObjectArray {
                 let end = start.wrapping_add(guobject_array_batch_size);
 
                 // Thread_SearchAllObject(Address_Level_1, Start, End, GUObjectArrayElementSize, ...)
-                Self::thread_search_all_object(&obj_mgr, process, name_pool, offsets, addr_level_1, start, end, guobject_array_element_size);
+                Self::thread_search_all_object(&obj_mgr, process, name_pool, offsets, addr_level_1, start, end, guobject_array_element_size, !shallow);
 
                 // Progress update
                 let bp = batch_progress.fetch_add(1, Ordering::Relaxed) + 1;
                 let current_obj_count = obj_mgr.total_object_count.load(Ordering::Relaxed);
 
-                if bp % 500 == 0 || bp == split_size {
+                if let (Some(app_handle), true) = (app_handle, bp % 500 == 0 || bp == split_size) {
                     // Use high-watermark so total never shrinks — progress bar won't regress
                     let displayed_total = dynamic_total.fetch_max(current_obj_count + 1, Ordering::Relaxed).max(current_obj_count + 1);
                     app_handle.emit("guobject-array-progress", ProgressPayload { current_chunk: arr_idx, total_chunks: arr_total, current_objects: current_obj_count, total_objects: displayed_total }).ok();
                 }
             });
-
-            i += loop_step;
         }
 
         let final_count = obj_mgr.total_object_count.load(Ordering::Relaxed);
 
         // Final progress: 100%
-        app_handle.emit("guobject-array-progress", ProgressPayload { current_chunk: MAX_OBJECT_ARRAY / loop_step, total_chunks: MAX_OBJECT_ARRAY / loop_step, current_objects: final_count, total_objects: final_count }).ok();
+        if let Some(app_handle) = app_handle {
+            app_handle.emit("guobject-array-progress", ProgressPayload { current_chunk: MAX_OBJECT_ARRAY / loop_step, total_chunks: MAX_OBJECT_ARRAY / loop_step, current_objects: final_count, total_objects: final_count }).ok();
+        }
 
         println!("[ GUObjectArray Total Objects ] {}", final_count);
-        println!("[ GUObjectArray Cache Size ] {}", obj_mgr.cache_by_address.len());
+        println!("[ GUObjectArray Cache Size ] {}", obj_mgr.len());
+        let stats = obj_mgr.decode_stats();
+        println!("[ GUObjectArray Decode ] {} headers decoded, {} duplicate decodes avoided ({} reused, {} waited), {} tasks, {} deferred", stats.decoded, stats.duplicates_avoided(), stats.reused, stats.waited, stats.tasks, stats.deferred);
 
         Ok(final_count as u32)
     }
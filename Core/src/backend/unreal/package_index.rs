@@ -0,0 +1,157 @@
+use crate::backend::commands::package::package_of;
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::{ObjectHandle, ObjectManager};
+use std::collections::HashMap;
+
+// ═══════════════════════════════════════════════════════════════
+//  PackageIndex — package → category → handles, behind the PackageViewer
+//  Each package keeps one handle list per category, sorted by object name (ties in
+//  handle order, as the old scan produced them). Listing a category is a slice of
+//  that list. When the table has only grown since the build, the new rows are
+//  merged in; an eviction can change what a handle names, so it forces a rebuild.
+// ═══════════════════════════════════════════════════════════════
+
+/// PackageViewer categories, in column order
+pub const CATEGORIES: [&str; 4] = ["Class", "Struct", "Enum", "Function"];
+
+/// Bit i set: the type belongs to CATEGORIES[i] (same tests get_objects has always used)
+fn category_mask(type_name: &str) -> u8 {
+    let function = type_name.contains("Function");
+    (type_name.contains("Class") && !function) as u8 | ((type_name.contains("Struct") && !function) as u8) << 1 | (type_name.contains("Enum") as u8) << 2 | (function as u8) << 3
+}
+
+pub fn category_slot(category: &str) -> Option<usize> {
+    CATEGORIES.iter().position(|&c| c == category)
+}
+
+#[derive(Clone)]
+pub struct PackageEntry {
+    pub name: String,
+    /// Every saved object in the package, whatever its category
+    pub object_count: usize,
+    /// Shown in the package list (C++ rule: /Script/, /Engine/ and /Game/ only)
+    pub listed: bool,
+    categories: [Vec<ObjectHandle>; 4],
+}
+
+impl PackageEntry {
+    pub fn category(&self, slot: usize) -> &[ObjectHandle] {
+        &self.categories[slot]
+    }
+}
+
+#[derive(Clone)]
+pub struct PackageIndex {
+    /// Sorted by name
+    packages: Vec<PackageEntry>,
+    by_name: HashMap<String, u32>,
+    /// Rows already placed, by handle; the rows a later `extend` has to look at are the rest
+    indexed: Vec<bool>,
+    /// ObjectManager::revision of the table this was built from
+    built_from: (u32, usize, u64),
+}
+
+impl PackageIndex {
+    pub fn build(objects: &ObjectManager, names: &FNamePool) -> Self {
+        let mut index = Self { packages: Vec::new(), by_name: HashMap::new(), indexed: Vec::new(), built_from: (0, 0, 0) };
+        index.add_rows(objects, names);
+        index
+    }
+
+    pub fn is_current(&self, objects: &ObjectManager) -> bool {
+        self.built_from == objects.revision()
+    }
+
+    /// Nothing was evicted since the build, so every indexed handle still names the same object
+    pub fn can_extend(&self, objects: &ObjectManager) -> bool {
+        self.built_from.2 == objects.revision().2
+    }
+
+    /// A copy with the rows saved since this index was built merged in
+    pub fn extend(&self, objects: &ObjectManager, names: &FNamePool) -> Self {
+        let mut index = self.clone();
+        index.add_rows(objects, names);
+        index
+    }
+
+    fn add_rows(&mut self, objects: &ObjectManager, names: &FNamePool) {
+        self.built_from = objects.revision();
+        self.indexed.resize(self.built_from.0 as usize, false);
+
+        let mut added: HashMap<String, (usize, [Vec<ObjectHandle>; 4])> = HashMap::new();
+        let mut full_name = String::new();
+        for handle in 0..self.indexed.len() {
+            if self.indexed[handle] {
+                continue;
+            }
+            let Some(obj) = objects.view(handle as ObjectHandle, names) else { continue };
+            self.indexed[handle] = true;
+
+            obj.write_full_name(&mut full_name);
+            let package = package_of(&full_name);
+            if !added.contains_key(package) {
+                added.insert(package.to_string(), Default::default());
+            }
+            let slot = added.get_mut(package).unwrap();
+            slot.0 += 1;
+            let mask = category_mask(obj.type_name());
+            for (c, list) in slot.1.iter_mut().enumerate() {
+                if mask & (1 << c) != 0 {
+                    list.push(obj.handle());
+                }
+            }
+        }
+        if added.is_empty() {
+            return;
+        }
+
+        let name_of = |h: ObjectHandle| objects.view(h, names).map_or("", |o| o.name());
+        let order = |a: &ObjectHandle, b: &ObjectHandle| name_of(*a).cmp(name_of(*b)).then(a.cmp(b));
+        let mut grew = false;
+        for (package, (count, mut lists)) in added {
+            let entry = match self.by_name.get(&package) {
+                Some(&i) => &mut self.packages[i as usize],
+                None => {
+                    grew = true;
+                    let listed = package.starts_with("/Script/") || package.starts_with("/Engine/") || package.starts_with("/Game/");
+                    self.packages.push(PackageEntry { name: package.clone(), object_count: 0, listed, categories: Default::default() });
+                    self.by_name.insert(package, self.packages.len() as u32 - 1);
+                    self.packages.last_mut().unwrap()
+                }
+            };
+            entry.object_count += count;
+            for (list, new) in entry.categories.iter_mut().zip(lists.iter_mut()) {
+                if new.is_empty() {
+                    continue;
+                }
+                new.sort_by(order);
+                if list.is_empty() {
+                    *list = std::mem::take(new);
+                    continue;
+                }
+                // Both sides sorted: one linear merge instead of re-sorting the whole category
+                let old = std::mem::take(list);
+                list.reserve(old.len() + new.len());
+                let (mut a, mut b) = (old.into_iter().peekable(), new.drain(..).peekable());
+                while let (Some(x), Some(y)) = (a.peek(), b.peek()) {
+                    list.push(if order(x, y).is_le() { a.next().unwrap() } else { b.next().unwrap() });
+                }
+                list.extend(a);
+                list.extend(b);
+            }
+        }
+        if grew {
+            self.packages.sort_by(|a, b| a.name.cmp(&b.name));
+            self.by_name = self.packages.iter().enumerate().map(|(i, p)| (p.name.clone(), i as u32)).collect();
+        }
+    }
+
+    /// Listed packages, in name order
+    pub fn packages(&self) -> impl Iterator<Item = &PackageEntry> {
+        self.packages.iter().filter(|p| p.listed)
+    }
+
+    pub fn package(&self, name: &str) -> Option<&PackageEntry> {
+        self.by_name.get(name).map(|&i| &self.packages[i as usize])
+    }
+}
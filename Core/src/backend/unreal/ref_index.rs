@@ -0,0 +1,229 @@
+use crate::backend::os::process::Process;
+use crate::backend::unreal::layout::{ClassLayout, MAX_INSTANCE_READ};
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::{ObjectHandle, ObjectManager, INVALID_HANDLE};
+use crate::backend::unreal::offsets::UEOffset;
+use dashmap::DashMap;
+use rayon::prelude::*;
+use std::collections::HashSet;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::Arc;
+
+// ═══════════════════════════════════════════════════════════════
+//  RefIndex — "who points at this object"
+//  Every saved object is read once, but only up to its last object pointer
+//  property, and the pointers are pulled out at the offsets its class layout
+//  names (inline structs included). Edges land in a CSR keyed by the target
+//  handle, so finding an object's referrers is a single slice lookup.
+// ═══════════════════════════════════════════════════════════════
+
+/// Property types whose value is a raw UObject* at the member offset (an FScriptInterface starts with one)
+const POINTER_TYPES: [&str; 5] = ["ObjectProperty", "ObjectPtrProperty", "ClassProperty", "ClassPtrProperty", "InterfaceProperty"];
+/// Inline StructProperty nesting followed when collecting pointer offsets
+const STRUCT_DEPTH: usize = 4;
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq, PartialOrd, Ord)]
+pub struct Reference {
+    pub referrer: ObjectHandle,
+    /// Offset of the pointer inside the referrer
+    pub offset: u32,
+}
+
+#[derive(Clone, Copy, Debug, Default, serde::Serialize)]
+pub struct RefIndexStats {
+    pub objects_read: u64,
+    pub bytes_read: u64,
+    pub references: usize,
+    pub elapsed_ms: f64,
+}
+
+#[derive(Clone)]
+pub struct RefIndex {
+    /// References to target t are refs[starts[t]..starts[t + 1]], ordered by referrer
+    starts: Vec<u32>,
+    refs: Vec<Reference>,
+    /// Rows already read, by handle; the rows a later `extend` has to read are the rest (unsaved rows included, so a row
+    /// that is decoded into later is still picked up)
+    indexed: Vec<bool>,
+    /// ObjectManager::revision of the table this was built from, and its index_revision
+    built_from: (u32, usize, u64),
+    built_revision: u64,
+    pub stats: RefIndexStats,
+}
+
+/// Pointer offsets per class address, shared by the workers of one pass
+type Plans = DashMap<usize, Arc<[u32]>>;
+
+impl RefIndex {
+    pub fn build(objects: &ObjectManager, process: &Process, names: &FNamePool, offsets: &UEOffset) -> Self {
+        let mut index = Self { starts: vec![0], refs: Vec::new(), indexed: Vec::new(), built_from: (0, 0, 0), built_revision: 0, stats: RefIndexStats::default() };
+        index.add_rows(objects, process, names, offsets, None);
+        index
+    }
+
+    /// Only saved UObjects are read, and each of those changes the index revision; FField rows saved by an expand don't
+    pub fn is_current(&self, objects: &ObjectManager) -> bool {
+        self.built_revision == objects.index_revision()
+    }
+
+    /// Nothing was evicted since the build, so every indexed handle still names the same object
+    pub fn can_extend(&self, objects: &ObjectManager) -> bool {
+        self.built_from.2 == objects.revision().2
+    }
+
+    /// A copy with the rows saved since this index was built read and merged in
+    pub fn extend(&self, objects: &ObjectManager, process: &Process, names: &FNamePool, offsets: &UEOffset) -> Self {
+        let mut index = self.clone();
+        index.add_rows(objects, process, names, offsets, None);
+        index
+    }
+
+    /// A copy where `referrers` are read again (their pointers changed), plus any rows saved since the build
+    pub fn refresh(&self, referrers: &[ObjectHandle], objects: &ObjectManager, process: &Process, names: &FNamePool, offsets: &UEOffset) -> Self {
+        let mut index = self.clone();
+        let stale: HashSet<ObjectHandle> = referrers.iter().copied().collect();
+        for &handle in &stale {
+            if let Some(slot) = index.indexed.get_mut(handle as usize) {
+                *slot = false;
+            }
+        }
+        index.add_rows(objects, process, names, offsets, Some(&stale));
+        index
+    }
+
+    /// Referrers of `target`, in handle order
+    pub fn referrers(&self, target: ObjectHandle) -> &[Reference] {
+        let t = target as usize;
+        if t + 1 >= self.starts.len() {
+            return &[];
+        }
+        &self.refs[self.starts[t] as usize..self.starts[t + 1] as usize]
+    }
+
+    pub fn len(&self) -> usize {
+        self.refs.len()
+    }
+
+    /// Read the unindexed rows and rebuild the CSR with their edges; edges from `drop` referrers are discarded first
+    fn add_rows(&mut self, objects: &ObjectManager, process: &Process, names: &FNamePool, offsets: &UEOffset, drop: Option<&HashSet<ObjectHandle>>) {
+        let start = std::time::Instant::now();
+        self.built_revision = objects.index_revision();
+        self.built_from = objects.revision();
+        let rows = self.built_from.0 as usize;
+        self.indexed.resize(rows, false);
+
+        let plans = Plans::new();
+        let (objects_read, bytes_read) = (AtomicU64::new(0), AtomicU64::new(0));
+        let indexed = &self.indexed;
+        let (new_edges, read): (Vec<(ObjectHandle, Reference)>, Vec<ObjectHandle>) = (0..rows as u32)
+            .into_par_iter()
+            .filter(|&handle| !indexed[handle as usize])
+            .fold(
+                || (Vec::new(), Vec::new()),
+                |(mut edges, mut read), handle| {
+                    let (saved, class, _) = objects.links(handle);
+                    let Some(obj) = saved.then(|| objects.view(handle, names)).flatten() else { return (edges, read) };
+                    read.push(handle);
+                    let Some(class) = (class != INVALID_HANDLE).then(|| objects.view(class, names)).flatten() else { return (edges, read) };
+                    let plan = pointer_plan(class.address(), objects, process, names, offsets, &plans);
+                    let Some(&last) = plan.last() else { return (edges, read) };
+
+                    let span = last as usize + 8;
+                    let bytes = process.memory.read_with(obj.address(), span, |buffer| {
+                        for &offset in plan.iter() {
+                            let Some(bytes) = buffer.get(offset as usize..offset as usize + 8) else { break };
+                            let pointer = u64::from_le_bytes(bytes.try_into().unwrap()) as usize;
+                            if pointer <= 0x10000 || pointer == obj.address() {
+                                continue;
+                            }
+                            // Referenced-only rows are kept as targets too: they may be saved later without a rebuild
+                            if let Some(target) = objects.handle_of(pointer) {
+                                edges.push((target, Reference { referrer: handle, offset }));
+                            }
+                        }
+                        buffer.len()
+                    });
+                    objects_read.fetch_add(1, Ordering::Relaxed);
+                    bytes_read.fetch_add(bytes.unwrap_or(0) as u64, Ordering::Relaxed);
+                    (edges, read)
+                },
+            )
+            .reduce(
+                || (Vec::new(), Vec::new()),
+                |(mut a, mut read_a), (mut b, mut read_b)| {
+                    if a.len() < b.len() {
+                        std::mem::swap(&mut a, &mut b);
+                    }
+                    a.extend(b);
+                    if read_a.len() < read_b.len() {
+                        std::mem::swap(&mut read_a, &mut read_b);
+                    }
+                    read_a.extend(read_b);
+                    (a, read_a)
+                },
+            );
+        // Only rows that were saved (and so read) count as indexed; the rest are revisited by the next `extend`
+        for handle in read {
+            self.indexed[handle as usize] = true;
+        }
+
+        // Counting sort by target: old edges (minus the dropped referrers) and new ones, one pass each
+        let old = (0..self.starts.len().saturating_sub(1)).flat_map(|t| self.referrers(t as ObjectHandle).iter().map(move |r| (t as ObjectHandle, *r)));
+        let mut edges: Vec<(ObjectHandle, Reference)> = old.filter(|(_, r)| drop.map_or(true, |d| !d.contains(&r.referrer))).collect();
+        edges.extend(new_edges);
+
+        // A target row can be newer than `rows` when the table grew during the pass
+        let targets = edges.iter().map(|(target, _)| *target as usize + 1).max().unwrap_or(0).max(rows);
+        let mut starts = vec![0u32; targets + 1];
+        for (target, _) in &edges {
+            starts[*target as usize + 1] += 1;
+        }
+        for t in 0..targets {
+            starts[t + 1] += starts[t];
+        }
+        let mut cursor = starts.clone();
+        let mut refs = vec![Reference { referrer: INVALID_HANDLE, offset: 0 }; edges.len()];
+        for (target, reference) in edges {
+            let slot = &mut cursor[target as usize];
+            refs[*slot as usize] = reference;
+            *slot += 1;
+        }
+        for t in 0..targets {
+            refs[starts[t] as usize..starts[t + 1] as usize].sort_unstable();
+        }
+        self.starts = starts;
+        self.refs = refs;
+
+        self.stats.objects_read += objects_read.into_inner();
+        self.stats.bytes_read += bytes_read.into_inner();
+        self.stats.references = self.refs.len();
+        self.stats.elapsed_ms += start.elapsed().as_secs_f64() * 1000.0;
+    }
+}
+
+/// Ascending offsets of the object pointers in an instance of the class at `class`
+fn pointer_plan(class: usize, objects: &ObjectManager, process: &Process, names: &FNamePool, offsets: &UEOffset, plans: &Plans) -> Arc<[u32]> {
+    if let Some(plan) = plans.get(&class) {
+        return Arc::clone(&plan);
+    }
+    let layout = objects.class_layout(class, process, names, offsets);
+    let mut plan = Vec::new();
+    collect_pointers(&layout, 0, objects, process, names, offsets, 0, &mut plan);
+    plan.sort_unstable();
+    plan.dedup();
+    let plan: Arc<[u32]> = plan.into();
+    plans.insert(class, Arc::clone(&plan));
+    plan
+}
+
+#[allow(clippy::too_many_arguments)]
+fn collect_pointers(layout: &ClassLayout, base: usize, objects: &ObjectManager, process: &Process, names: &FNamePool, offsets: &UEOffset, depth: usize, out: &mut Vec<u32>) {
+    for member in layout.members().filter(|m| m.is_property && base + m.offset + 8 <= MAX_INSTANCE_READ) {
+        if POINTER_TYPES.contains(&member.type_name.as_str()) {
+            out.push((base + member.offset) as u32);
+        } else if member.struct_address > 0x10000 && depth < STRUCT_DEPTH && member.struct_address != layout.address {
+            let inner = objects.class_layout(member.struct_address, process, names, offsets);
+            collect_pointers(&inner, base + member.offset, objects, process, names, offsets, depth + 1, out);
+        }
+    }
+}
@@ -0,0 +1,610 @@
+use crate::backend::os::process::Process;
+use crate::backend::unreal::layout::{ClassLayout, LayoutMember};
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::{ObjectManager, ObjectView};
+use crate::backend::unreal::offsets::UEOffset;
+use crate::backend::unreal::package_index::{category_slot, PackageEntry};
+use rayon::prelude::*;
+use std::collections::{HashMap, HashSet};
+use std::io::{BufWriter, Write};
+use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std::sync::Mutex;
+use std::time::Instant;
+use tauri::Emitter;
+
+// ═══════════════════════════════════════════════════════════════
+//  SDK generator — per-package C++ headers and JSON type dumps
+//  Two parallel passes. The first builds the ClassLayout of every class and
+//  struct (the only pass that reads much process memory; layouts land in the
+//  ObjectManager cache). The second formats one package per rayon task,
+//  writing each type straight into that package's buffered file, so no
+//  package is ever held in memory as a whole.
+// ═══════════════════════════════════════════════════════════════
+
+const FILE_BUFFER: usize = 256 * 1024;
+/// Layout pass: one progress event per this many types
+const PROGRESS_STEP: usize = 256;
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct SdkFormat {
+    pub headers: bool,
+    pub json: bool,
+}
+
+impl SdkFormat {
+    pub fn parse(format: &str) -> Result<Self, String> {
+        match format {
+            "cpp" | "headers" => Ok(Self { headers: true, json: false }),
+            "json" => Ok(Self { headers: false, json: true }),
+            "" | "both" => Ok(Self { headers: true, json: true }),
+            other => Err(format!("Unknown SDK format '{}' (expected cpp, json or both)", other)),
+        }
+    }
+}
+
+#[derive(Debug, Default, serde::Serialize)]
+pub struct SdkReport {
+    pub output_dir: String,
+    pub packages: usize,
+    pub classes: usize,
+    pub structs: usize,
+    pub enums: usize,
+    pub functions: usize,
+    pub files: usize,
+    pub bytes_written: u64,
+    pub elapsed_ms: f64,
+    /// Packages whose files could not be written, with the error
+    pub failed: Vec<String>,
+}
+
+#[derive(Clone, serde::Serialize)]
+struct ProgressPayload {
+    current_packages: usize,
+    total_packages: usize,
+    current_objects: usize,
+    total_objects: usize,
+}
+
+// ─── Enum and function readers (also behind get_object_details) ──
+
+pub struct EnumInfo {
+    /// Name of the underlying type's object, "Byte" when it has a type object without a readable name
+    pub underlying_type: String,
+    /// Entry names as stored ("EAxis::X") and their values
+    pub values: Vec<(String, i64)>,
+}
+
+impl EnumInfo {
+    pub fn read(process: &Process, names: &FNamePool, offsets: &UEOffset, address: usize) -> Self {
+        let memory = &process.memory;
+        let mut underlying_type = String::new();
+        let enum_type_addr = memory.try_read_pointer(address.wrapping_add(offsets.enum_type)).unwrap_or(0);
+        if enum_type_addr > 0x10000 {
+            let type_name_id = memory.try_read::<i32>(enum_type_addr.wrapping_add(offsets.fname_index)).unwrap_or(0);
+            underlying_type = names.get_name(process, type_name_id as u32).unwrap_or("Byte".to_string());
+        }
+
+        // Entries: list at enum_list, count at enum_size
+        let mut values = Vec::new();
+        let list_ptr = memory.try_read_pointer(address.wrapping_add(offsets.enum_list)).unwrap_or(0);
+        let list_count = memory.try_read::<i32>(address.wrapping_add(offsets.enum_size)).unwrap_or(0);
+        if list_ptr > 0x10000 && list_count > 0 && list_count < 10000 {
+            for i in 0..list_count as usize {
+                let entry_addr = list_ptr.wrapping_add(i * offsets.enum_prop_mul);
+                let name_id = memory.try_read::<i32>(entry_addr.wrapping_add(offsets.enum_prop_name)).unwrap_or(0);
+                let name = names.get_name(process, name_id as u32).unwrap_or_default();
+                let value = memory.try_read::<i64>(entry_addr.wrapping_add(offsets.enum_prop_index)).unwrap_or(0);
+                if !name.is_empty() {
+                    values.push((name, value));
+                }
+            }
+        }
+        Self { underlying_type, values }
+    }
+}
+
+pub struct FunctionParam {
+    pub name: String,
+    pub type_name: String,
+    /// Cached object behind Property_0 (the class, struct or enum of the parameter), 0 if there is none
+    pub type_address: usize,
+}
+
+pub struct FunctionInfo {
+    /// Native function pointer (UFunction::Func)
+    pub address: usize,
+    pub params: Vec<FunctionParam>,
+    pub return_value: Option<FunctionParam>,
+}
+
+impl FunctionInfo {
+    /// Walk the ChildProperty chain under the function at `address`
+    pub fn read(process: &Process, names: &FNamePool, objects: &ObjectManager, offsets: &UEOffset, address: usize) -> Self {
+        let memory = &process.memory;
+        let mut info = Self { address: memory.try_read_pointer(address.wrapping_add(offsets.funct)).unwrap_or(0), params: Vec::new(), return_value: None };
+
+        let mut param_addr = memory.try_read_pointer(address.wrapping_add(offsets.funct_para)).unwrap_or(0);
+        let mut safety = 0;
+        while param_addr > 0x10000 && safety < 200 {
+            safety += 1;
+
+            let param_name_id = memory.try_read::<i32>(param_addr.wrapping_add(offsets.member_fname_index)).unwrap_or(0);
+            let name = names.get_name(process, param_name_id as u32).unwrap_or_default();
+            let type_ptr = memory.try_read_pointer(param_addr.wrapping_add(offsets.member_type_offset)).unwrap_or(0);
+            let type_id = memory.try_read::<i32>(type_ptr.wrapping_add(offsets.member_type)).unwrap_or(0);
+            let type_name = names.get_name(process, type_id as u32).unwrap_or_default();
+
+            let prop_0 = memory.try_read_pointer(param_addr.wrapping_add(offsets.property)).unwrap_or(0);
+            let type_address = if prop_0 > 0x10000 { objects.get(prop_0, names).map(|o| o.address()).unwrap_or(0) } else { 0 };
+
+            let param = FunctionParam { name, type_name, type_address };
+            if param.name == "ReturnValue" {
+                info.return_value = Some(param);
+            } else if !param.name.is_empty() && !param.type_name.is_empty() {
+                info.params.push(param);
+            }
+            param_addr = memory.try_read_pointer(param_addr.wrapping_add(offsets.next_member)).unwrap_or(0);
+        }
+        info
+    }
+}
+
+// ─── C++ naming ──────────────────────────────────────────────────
+
+const PRIMITIVES: [(&str, &str); 18] = [
+    ("Int8Property", "int8_t"),
+    ("Int16Property", "int16_t"),
+    ("IntProperty", "int32_t"),
+    ("Int64Property", "int64_t"),
+    ("UInt16Property", "uint16_t"),
+    ("UInt32Property", "uint32_t"),
+    ("UInt64Property", "uint64_t"),
+    ("FloatProperty", "float"),
+    ("DoubleProperty", "double"),
+    ("BoolProperty", "bool"),
+    ("NameProperty", "FName"),
+    ("StrProperty", "FString"),
+    ("TextProperty", "FText"),
+    ("DelegateProperty", "FScriptDelegate"),
+    ("MulticastInlineDelegateProperty", "FMulticastInlineDelegate"),
+    ("MulticastSparseDelegateProperty", "FMulticastSparseDelegate"),
+    ("MulticastDelegateProperty", "FMulticastDelegate"),
+    ("FieldPathProperty", "FFieldPath"),
+];
+
+/// `name` as a C++ identifier
+fn ident(name: &str) -> String {
+    let mut out: String = name.chars().map(|c| if c.is_ascii_alphanumeric() || c == '_' { c } else { '_' }).collect();
+    if out.is_empty() || out.starts_with(|c: char| c.is_ascii_digit()) {
+        out.insert(0, '_');
+    }
+    out
+}
+
+/// "/Script/Engine" → "Script_Engine"
+fn file_stem(package: &str) -> String {
+    ident(package.trim_start_matches('/'))
+}
+
+/// One file stem per package, in order. Paths that sanitize alike ("/Script/A-B", "/Script/A_B") get a "_2", "_3"...
+/// suffix, compared case-insensitively since the output may land on a case-insensitive filesystem
+fn unique_file_stems(packages: &[&PackageEntry]) -> Vec<String> {
+    let mut taken = HashSet::new();
+    packages
+        .iter()
+        .map(|package| {
+            let base = file_stem(&package.name);
+            let mut stem = base.clone();
+            let mut n = 1;
+            while !taken.insert(stem.to_ascii_lowercase()) {
+                n += 1;
+                stem = format!("{}_{}", base, n);
+            }
+            stem
+        })
+        .collect()
+}
+
+fn json_escape(text: &str) -> String {
+    serde_json::to_string(text).unwrap_or_else(|_| "\"\"".to_string())
+}
+
+struct Namer<'a> {
+    objects: &'a ObjectManager,
+    names: &'a FNamePool,
+}
+
+impl<'a> Namer<'a> {
+    /// UE prefix convention: A for actors, U for other classes, F for structs, E for enums
+    fn cpp_name(&self, obj: &ObjectView<'_>) -> String {
+        let t = obj.type_name();
+        let name = ident(obj.name());
+        if t.contains("Function") {
+            name
+        } else if t.contains("Class") {
+            let mut current = Some(*obj);
+            let mut depth = 0;
+            while let Some(class) = current.filter(|_| depth < 64) {
+                if class.name() == "Actor" {
+                    return format!("A{}", name);
+                }
+                current = class.super_struct();
+                depth += 1;
+            }
+            format!("U{}", name)
+        } else if t.contains("Struct") {
+            format!("F{}", name)
+        } else if t.contains("Enum") && !name.starts_with('E') {
+            format!("E{}", name)
+        } else {
+            name
+        }
+    }
+
+    fn name_at(&self, address: usize) -> Option<String> {
+        (address > 0x10000).then(|| self.objects.get(address, self.names)).flatten().map(|obj| self.cpp_name(&obj))
+    }
+
+    /// C++ spelling of a property; `sub_address` is its class/struct/enum object, `inner` the element types of a container.
+    /// None for types without a C++ counterpart here.
+    fn cpp_type(&self, type_name: &str, sub_address: usize, inner: &str) -> Option<String> {
+        if let Some((_, cpp)) = PRIMITIVES.iter().find(|(ue, _)| *ue == type_name) {
+            return Some(cpp.to_string());
+        }
+        let sub = || self.name_at(sub_address).unwrap_or_else(|| if inner.is_empty() { "UObject".to_string() } else { ident(inner) });
+        let element = |part: &str| -> String {
+            let part = part.trim();
+            PRIMITIVES.iter().find(|(ue, _)| ue.strip_suffix("Property") == Some(part)).map(|(_, cpp)| cpp.to_string()).unwrap_or_else(|| if part == "Byte" { "uint8_t".to_string() } else { ident(part) })
+        };
+        Some(match type_name {
+            "ByteProperty" => match self.objects.get(sub_address, self.names).filter(|o| o.type_name().contains("Enum")) {
+                Some(e) => format!("TEnumAsByte<{}>", self.cpp_name(&e)),
+                None => "uint8_t".to_string(),
+            },
+            "ObjectProperty" | "ObjectPtrProperty" => format!("class {}*", sub()),
+            "ClassProperty" | "ClassPtrProperty" => format!("TSubclassOf<class {}>", sub()),
+            "SoftObjectProperty" => format!("TSoftObjectPtr<class {}>", sub()),
+            "SoftClassProperty" => format!("TSoftClassPtr<class {}>", sub()),
+            "WeakObjectProperty" => format!("TWeakObjectPtr<class {}>", sub()),
+            "LazyObjectProperty" => format!("TLazyObjectPtr<class {}>", sub()),
+            "InterfaceProperty" => format!("TScriptInterface<class {}>", sub()),
+            "StructProperty" => format!("struct {}", sub()),
+            "EnumProperty" => sub(),
+            "ArrayProperty" => format!("TArray<{}>", element(inner)),
+            "SetProperty" => format!("TSet<{}>", element(inner)),
+            "MapProperty" => {
+                let mut parts = inner.splitn(2, ',');
+                let (key, value) = (parts.next().unwrap_or(""), parts.next().unwrap_or(""));
+                format!("TMap<{}, {}>", element(key), element(value))
+            }
+            _ => return None,
+        })
+    }
+}
+
+// ─── Generator ───────────────────────────────────────────────────
+
+pub struct SdkGenerator<'a> {
+    pub process: &'a Process,
+    pub names: &'a FNamePool,
+    pub objects: &'a ObjectManager,
+    pub offsets: &'a UEOffset,
+    pub format: SdkFormat,
+}
+
+#[derive(Default)]
+struct Counts {
+    classes: AtomicUsize,
+    structs: AtomicUsize,
+    enums: AtomicUsize,
+    functions: AtomicUsize,
+    files: AtomicUsize,
+    bytes: AtomicU64,
+}
+
+/// BufWriter that counts what it wrote
+struct Output {
+    path: PathBuf,
+    out: BufWriter<std::fs::File>,
+    bytes: u64,
+}
+
+impl Output {
+    fn create(path: PathBuf) -> Result<Self, String> {
+        let file = std::fs::File::create(&path).map_err(|e| format!("Failed to create {}: {}", path.display(), e))?;
+        Ok(Self { path, out: BufWriter::with_capacity(FILE_BUFFER, file), bytes: 0 })
+    }
+
+    fn finish(mut self) -> Result<u64, String> {
+        self.out.flush().map_err(|e| format!("Failed to write {}: {}", self.path.display(), e))?;
+        Ok(self.bytes)
+    }
+}
+
+impl Write for Output {
+    fn write(&mut self, buf: &[u8]) -> std::io::Result<usize> {
+        let n = self.out.write(buf)?;
+        self.bytes += n as u64;
+        Ok(n)
+    }
+
+    fn flush(&mut self) -> std::io::Result<()> {
+        self.out.flush()
+    }
+}
+
+impl<'a> SdkGenerator<'a> {
+    pub fn generate(&self, dir: &Path, app_handle: &tauri::AppHandle) -> Result<SdkReport, String> {
+        let start = Instant::now();
+        std::fs::create_dir_all(dir).map_err(|e| format!("Failed to create {}: {}", dir.display(), e))?;
+
+        let index = self.objects.package_index(self.names);
+        let packages: Vec<&PackageEntry> = index.packages().collect();
+        let (class_slot, struct_slot) = (category_slot("Class").unwrap(), category_slot("Struct").unwrap());
+
+        // ═══ Pass 1: layouts of every class and struct, in parallel ═══
+        let typed: Vec<usize> = packages.iter().flat_map(|p| p.category(class_slot).iter().chain(p.category(struct_slot))).filter_map(|&h| self.objects.view(h, self.names)).map(|o| o.address()).collect();
+        let total_objects = typed.len() + packages.iter().map(|p| p.object_count).sum::<usize>();
+        let laid_out = AtomicUsize::new(0);
+        let progress = |current_packages: usize, current_objects: usize| {
+            app_handle.emit("sdk-progress", ProgressPayload { current_packages, total_packages: packages.len(), current_objects, total_objects }).ok();
+        };
+        typed.par_iter().for_each(|&address| {
+            self.objects.class_layout(address, self.process, self.names, self.offsets);
+            let done = laid_out.fetch_add(1, Ordering::Relaxed) + 1;
+            if done % PROGRESS_STEP == 0 {
+                progress(0, done);
+            }
+        });
+
+        // ═══ Pass 2: one package per task, streamed to its files ═══
+        let counts = Counts::default();
+        let (packages_done, objects_done) = (AtomicUsize::new(0), AtomicUsize::new(typed.len()));
+        let failed = Mutex::new(Vec::new());
+        // Decided up front so no two tasks share a file, and SDK.hpp includes exactly the files written
+        let stems = unique_file_stems(&packages);
+        packages.par_iter().zip(stems.par_iter()).for_each(|(package, stem)| {
+            if let Err(e) = self.write_package(dir, package, stem, &counts) {
+                failed.lock().unwrap().push(format!("{}: {}", package.name, e));
+            }
+            let objects = objects_done.fetch_add(package.object_count, Ordering::Relaxed) + package.object_count;
+            progress(packages_done.fetch_add(1, Ordering::Relaxed) + 1, objects);
+        });
+
+        if self.format.headers {
+            let mut sdk = Output::create(dir.join("SDK.hpp"))?;
+            let io = |e: std::io::Error| e.to_string();
+            writeln!(sdk, "#pragma once\n\n// Generated by UEDP from {}\n// Engine types (FName, FString, TArray...) are expected from the engine headers\n", self.process.name).map_err(io)?;
+            for stem in &stems {
+                writeln!(sdk, "#include \"{}.hpp\"", stem).map_err(io)?;
+            }
+            counts.bytes.fetch_add(sdk.finish()?, Ordering::Relaxed);
+            counts.files.fetch_add(1, Ordering::Relaxed);
+        }
+        progress(packages.len(), total_objects);
+
+        let report = SdkReport {
+            output_dir: dir.display().to_string(),
+            packages: packages.len(),
+            classes: counts.classes.into_inner(),
+            structs: counts.structs.into_inner(),
+            enums: counts.enums.into_inner(),
+            functions: counts.functions.into_inner(),
+            files: counts.files.into_inner(),
+            bytes_written: counts.bytes.into_inner(),
+            elapsed_ms: start.elapsed().as_secs_f64() * 1000.0,
+            failed: failed.into_inner().unwrap(),
+        };
+        Ok(report)
+    }
+
+    fn write_package(&self, dir: &Path, package: &PackageEntry, stem: &str, counts: &Counts) -> Result<(), String> {
+        let namer = Namer { objects: self.objects, names: self.names };
+        let views = |category: &str| -> Vec<ObjectView<'_>> { package.category(category_slot(category).unwrap()).iter().filter_map(|&h| self.objects.view(h, self.names)).collect() };
+        let (enums, structs, classes, functions) = (views("Enum"), supers_first(views("Struct")), supers_first(views("Class")), views("Function"));
+
+        // Functions are written with the class that owns them
+        let mut by_owner: HashMap<usize, Vec<ObjectView<'_>>> = HashMap::new();
+        for function in &functions {
+            by_owner.entry(function.outer_address()).or_default().push(*function);
+        }
+        let owned: HashSet<usize> = classes.iter().chain(&structs).map(|o| o.address()).collect();
+        let free: Vec<ObjectView<'_>> = functions.iter().filter(|f| !owned.contains(&f.outer_address())).copied().collect();
+        let function_infos: HashMap<usize, FunctionInfo> = functions.iter().map(|f| (f.address(), FunctionInfo::read(self.process, self.names, self.objects, self.offsets, f.address()))).collect();
+
+        let io = |e: std::io::Error| e.to_string();
+        if self.format.headers {
+            let mut out = Output::create(dir.join(format!("{}.hpp", stem)))?;
+            writeln!(out, "#pragma once\n\n// Package: {}\n// Enums {}, structs {}, classes {}, functions {}\n", package.name, enums.len(), structs.len(), classes.len(), functions.len()).map_err(io)?;
+            for obj in &enums {
+                self.write_enum(&mut out, &namer, obj).map_err(io)?;
+            }
+            for obj in structs.iter().chain(&classes) {
+                self.write_struct(&mut out, &namer, obj, by_owner.get(&obj.address()).map(Vec::as_slice).unwrap_or(&[]), &function_infos).map_err(io)?;
+            }
+            if !free.is_empty() {
+                writeln!(out, "// Functions without an owner in this package (delegate signatures...)").map_err(io)?;
+                for function in &free {
+                    writeln!(out, "// {};", self.signature(&namer, function, &function_infos)).map_err(io)?;
+                }
+            }
+            counts.bytes.fetch_add(out.finish()?, Ordering::Relaxed);
+            counts.files.fetch_add(1, Ordering::Relaxed);
+        }
+        if self.format.json {
+            let mut out = Output::create(dir.join(format!("{}.json", stem)))?;
+            self.write_json(&mut out, &namer, package, &enums, &structs, &classes, &functions, &function_infos).map_err(io)?;
+            counts.bytes.fetch_add(out.finish()?, Ordering::Relaxed);
+            counts.files.fetch_add(1, Ordering::Relaxed);
+        }
+
+        counts.enums.fetch_add(enums.len(), Ordering::Relaxed);
+        counts.structs.fetch_add(structs.len(), Ordering::Relaxed);
+        counts.classes.fetch_add(classes.len(), Ordering::Relaxed);
+        counts.functions.fetch_add(functions.len(), Ordering::Relaxed);
+        Ok(())
+    }
+
+    fn write_enum(&self, out: &mut impl Write, namer: &Namer<'_>, obj: &ObjectView<'_>) -> std::io::Result<()> {
+        let info = EnumInfo::read(self.process, self.names, self.offsets, obj.address());
+        let (min, max) = info.values.iter().fold((0i64, 0i64), |(lo, hi), (_, v)| (lo.min(*v), hi.max(*v)));
+        let underlying = if min >= 0 && max <= u8::MAX as i64 {
+            "uint8_t"
+        } else if min >= i32::MIN as i64 && max <= i32::MAX as i64 {
+            "int32_t"
+        } else {
+            "int64_t"
+        };
+        writeln!(out, "// {} {}\nenum class {} : {}\n{{", obj.type_name(), obj.full_name(), namer.cpp_name(obj), underlying)?;
+        for (name, value) in &info.values {
+            let short = name.rsplit("::").next().unwrap_or(name);
+            writeln!(out, "    {} = {},", ident(short), value)?;
+        }
+        writeln!(out, "}};\n")
+    }
+
+    fn write_struct(&self, out: &mut impl Write, namer: &Namer<'_>, obj: &ObjectView<'_>, functions: &[ObjectView<'_>], infos: &HashMap<usize, FunctionInfo>) -> std::io::Result<()> {
+        let layout = self.objects.class_layout(obj.address(), self.process, self.names, self.offsets);
+        let inherited = layout.parent.as_ref().map_or(0, |p| p.prop_size);
+        let keyword = if obj.type_name().contains("Class") { "class" } else { "struct" };
+        let base = obj.super_struct().map(|s| format!(" : public {}", namer.cpp_name(&s))).unwrap_or_default();
+
+        writeln!(out, "// {} {}\n// Size 0x{:04X} (0x{:04X} - 0x{:04X})", obj.type_name(), obj.full_name(), layout.prop_size.saturating_sub(inherited), inherited, layout.prop_size)?;
+        writeln!(out, "{} {}{}\n{{\npublic:", keyword, namer.cpp_name(obj), base)?;
+        self.write_members(out, namer, &layout, inherited)?;
+
+        if !functions.is_empty() {
+            writeln!(out, "\n    // Functions")?;
+            for function in functions {
+                let native = infos.get(&function.address()).map_or(0, |i| i.address);
+                writeln!(out, "    {}; // 0x{:X}", self.signature(namer, function, infos), native)?;
+            }
+        }
+        writeln!(out, "}};\n")
+    }
+
+    /// Own members in offset order, with explicit padding for the gaps and bit padding inside shared bool bytes
+    fn write_members(&self, out: &mut impl Write, namer: &Namer<'_>, layout: &ClassLayout, inherited: usize) -> std::io::Result<()> {
+        let mut members: Vec<&LayoutMember> = layout.own.iter().filter(|m| m.is_property).collect();
+        members.sort_by_key(|m| (m.offset, m.bit_mask.trailing_zeros()));
+
+        let mut cursor = inherited;
+        // Byte currently being filled by bool bitfields, and its next free bit
+        let mut bits: Option<(usize, u32)> = None;
+        let mut pads = 0;
+        for m in members {
+            let is_bit = m.type_name == "BoolProperty" && m.bit_mask != 0 && m.bit_mask != 0xFF;
+            if is_bit && bits.is_some_and(|(byte, next)| byte == m.offset && m.bit_mask.trailing_zeros() >= next) {
+                let (byte, next) = bits.unwrap();
+                let bit = m.bit_mask.trailing_zeros();
+                if bit > next {
+                    writeln!(out, "    uint8_t {:<44} : {};", format!("BitPad_{:X}_{}", byte, next), bit - next)?;
+                }
+                writeln!(out, "    uint8_t {:<44} : 1; // 0x{:04X}:{} BoolProperty", ident(&m.name), m.offset, bit)?;
+                bits = Some((byte, bit + 1));
+                continue;
+            }
+            bits = None;
+            if m.offset < cursor {
+                writeln!(out, "    // 0x{:04X}(0x{:04X}) {} {} overlaps the previous member", m.offset, m.element_size, m.type_name, m.name)?;
+                continue;
+            }
+            if m.offset > cursor {
+                writeln!(out, "    uint8_t {:<52} // 0x{:04X}(0x{:04X})", format!("Pad_{:X}[0x{:X}];", pads, m.offset - cursor), cursor, m.offset - cursor)?;
+                pads += 1;
+            }
+            let size = m.element_size.max(1);
+            if is_bit {
+                let bit = m.bit_mask.trailing_zeros();
+                if bit > 0 {
+                    writeln!(out, "    uint8_t {:<44} : {};", format!("BitPad_{:X}_0", m.offset), bit)?;
+                }
+                writeln!(out, "    uint8_t {:<44} : 1; // 0x{:04X}:{} BoolProperty", ident(&m.name), m.offset, bit)?;
+                bits = Some((m.offset, bit + 1));
+            } else {
+                match namer.cpp_type(&m.type_name, m.detail_sub_type_address, &m.sub_type) {
+                    Some(cpp) => writeln!(out, "    {:<52} // 0x{:04X}(0x{:04X}) {}", format!("{} {};", cpp, ident(&m.name)), m.offset, size, m.type_name)?,
+                    None => writeln!(out, "    {:<52} // 0x{:04X}(0x{:04X}) {}", format!("uint8_t {}[0x{:X}];", ident(&m.name), size), m.offset, size, m.type_name)?,
+                }
+            }
+            cursor = m.offset + size;
+        }
+        if layout.prop_size > cursor {
+            writeln!(out, "    uint8_t {:<52} // 0x{:04X}(0x{:04X})", format!("Pad_{:X}[0x{:X}];", pads, layout.prop_size - cursor), cursor, layout.prop_size - cursor)?;
+        }
+        Ok(())
+    }
+
+    fn signature(&self, namer: &Namer<'_>, function: &ObjectView<'_>, infos: &HashMap<usize, FunctionInfo>) -> String {
+        let param_type = |p: &FunctionParam| namer.cpp_type(&p.type_name, p.type_address, "").unwrap_or_else(|| format!("/* {} */ void*", p.type_name));
+        let Some(info) = infos.get(&function.address()) else { return format!("void {}()", ident(function.name())) };
+        let ret = info.return_value.as_ref().map(&param_type).unwrap_or_else(|| "void".to_string());
+        let params: Vec<String> = info.params.iter().map(|p| format!("{} {}", param_type(p), ident(&p.name))).collect();
+        format!("{} {}({})", ret, ident(function.name()), params.join(", "))
+    }
+
+    #[allow(clippy::too_many_arguments)]
+    fn write_json(&self, out: &mut impl Write, namer: &Namer<'_>, package: &PackageEntry, enums: &[ObjectView<'_>], structs: &[ObjectView<'_>], classes: &[ObjectView<'_>], functions: &[ObjectView<'_>], infos: &HashMap<usize, FunctionInfo>) -> std::io::Result<()> {
+        write!(out, "{{\"package\":{},\"enums\":[", json_escape(&package.name))?;
+        for (i, obj) in enums.iter().enumerate() {
+            let info = EnumInfo::read(self.process, self.names, self.offsets, obj.address());
+            let values: Vec<String> = info.values.iter().map(|(name, value)| format!("{{\"name\":{},\"value\":{}}}", json_escape(name), value)).collect();
+            write!(out, "{}\n{{\"name\":{},\"full_name\":{},\"address\":{},\"underlying_type\":{},\"values\":[{}]}}", if i > 0 { "," } else { "" }, json_escape(obj.name()), json_escape(&obj.full_name()), obj.address(), json_escape(&info.underlying_type), values.join(","))?;
+        }
+        for (key, list) in [("structs", structs), ("classes", classes)] {
+            write!(out, "],\"{}\":[", key)?;
+            for (i, obj) in list.iter().enumerate() {
+                let layout = self.objects.class_layout(obj.address(), self.process, self.names, self.offsets);
+                let super_name = obj.super_struct().map(|s| s.name().to_string()).unwrap_or_default();
+                write!(
+                    out,
+                    "{}\n{{\"name\":{},\"cpp_name\":{},\"full_name\":{},\"address\":{},\"super\":{},\"size\":{},\"members\":[",
+                    if i > 0 { "," } else { "" },
+                    json_escape(obj.name()),
+                    json_escape(&namer.cpp_name(obj)),
+                    json_escape(&obj.full_name()),
+                    obj.address(),
+                    json_escape(&super_name),
+                    layout.prop_size
+                )?;
+                for (k, m) in layout.own.iter().filter(|m| m.is_property).enumerate() {
+                    write!(out, "{}{{\"name\":{},\"type\":{},\"sub_type\":{},\"offset\":{},\"size\":{},\"bit_mask\":{}}}", if k > 0 { "," } else { "" }, json_escape(&m.name), json_escape(&m.type_name), json_escape(&m.sub_type), m.offset, m.element_size, m.bit_mask)?;
+                }
+                write!(out, "]}}")?;
+            }
+        }
+        write!(out, "],\"functions\":[")?;
+        for (i, function) in functions.iter().enumerate() {
+            let owner = function.outer().map(|o| o.name().to_string()).unwrap_or_default();
+            let param = |p: &FunctionParam| format!("{{\"name\":{},\"type\":{},\"type_address\":{}}}", json_escape(&p.name), json_escape(&p.type_name), p.type_address);
+            let (native, params, ret) = match infos.get(&function.address()) {
+                Some(info) => (info.address, info.params.iter().map(param).collect::<Vec<_>>().join(","), info.return_value.as_ref().map(param).unwrap_or_else(|| "null".to_string())),
+                None => (0, String::new(), "null".to_string()),
+            };
+            write!(out, "{}\n{{\"name\":{},\"owner\":{},\"address\":{},\"native\":{},\"params\":[{}],\"return\":{}}}", if i > 0 { "," } else { "" }, json_escape(function.name()), json_escape(&owner), function.address(), native, params, ret)?;
+        }
+        writeln!(out, "]}}")
+    }
+}
+
+/// Order types so a base declared in the same package comes before its subclasses (names stay sorted otherwise)
+fn supers_first(types: Vec<ObjectView<'_>>) -> Vec<ObjectView<'_>> {
+    let index: HashMap<usize, usize> = types.iter().enumerate().map(|(i, o)| (o.address(), i)).collect();
+    let mut placed = vec![false; types.len()];
+    let mut ordered = Vec::with_capacity(types.len());
+    for start in 0..types.len() {
+        // Walk up to the first unplaced ancestor in this package, then place the chain root first
+        let mut chain = Vec::new();
+        let mut current = Some(start);
+        while let Some(i) = current.filter(|&i| !placed[i] && !chain.contains(&i)) {
+            chain.push(i);
+            current = types[i].super_struct().and_then(|s| index.get(&s.address()).copied());
+        }
+        for &i in chain.iter().rev() {
+            placed[i] = true;
+            ordered.push(types[i]);
+        }
+    }
+    ordered
+}
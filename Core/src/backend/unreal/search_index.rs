@@ -0,0 +1,221 @@
+use crate::backend::commands::package::extract_package_name;
+use crate::backend::os::memory::{CachedMemory, PAGE_64K};
+use crate::backend::os::process::Process;
+use crate::backend::unreal::name_pool::FNamePool;
+use crate::backend::unreal::object_array::{ObjectHandle, ObjectManager};
+use crate::backend::unreal::offsets::UEOffset;
+use std::collections::HashMap;
+
+// ═══════════════════════════════════════════════════════════════
+//  SearchIndex — inverted name index behind global_search
+//  Entries are stored in final result order (type priority, name, package), so the
+//  first `limit` matching ranks are the answer. Distinct lowercase names are indexed
+//  by byte trigrams; queries shorter than a trigram scan the distinct names instead.
+// ═══════════════════════════════════════════════════════════════
+
+/// C++ UI order: Class -> Struct -> Enum -> Function -> rest
+pub fn type_priority(type_name: &str) -> u8 {
+    let t = type_name.to_lowercase();
+    if t.contains("class") {
+        0
+    } else if t.contains("struct") {
+        1
+    } else if t.contains("enum") || t == "userenum" {
+        2
+    } else if t.contains("function") {
+        3
+    } else {
+        4
+    }
+}
+
+/// Types global_search lists as objects. Property rows are left out: their names are members, which Member mode covers.
+pub fn is_searchable_type(type_name: &str) -> bool {
+    let t = type_name.to_lowercase();
+    !t.contains("property") && (t.contains("class") || t.contains("struct") || t.contains("enum") || t == "userenum" || t.contains("function"))
+}
+
+pub struct SearchEntry {
+    pub handle: ObjectHandle,
+    pub package: u32,
+    /// FName id of the matched member (Member mode only)
+    pub member: Option<u32>,
+}
+
+/// One searchable column: entries in rank order plus the trigram index over their names
+struct NameIndex {
+    entries: Vec<SearchEntry>,
+    /// Distinct lowercase names, concatenated; name i is text[ends[i - 1]..ends[i]]
+    text: String,
+    ends: Vec<u32>,
+    grams: HashMap<[u8; 3], Vec<u32>>,
+    /// Ranks of the entries carrying each distinct name: ranks[starts[i]..starts[i + 1]]
+    starts: Vec<u32>,
+    ranks: Vec<u32>,
+}
+
+impl NameIndex {
+    /// `keyed` is (name id, entry), already in rank order; ids that don't resolve are searched as `fallback`
+    fn build(keyed: Vec<(u32, SearchEntry)>, names: &FNamePool, process: &Process, fallback: &str) -> Self {
+        let mut distinct: HashMap<u32, u32> = HashMap::new();
+        let mut text = String::new();
+        let mut ends = Vec::new();
+        let mut name_of_rank = Vec::with_capacity(keyed.len());
+        let mut entries = Vec::with_capacity(keyed.len());
+
+        for (name_id, entry) in keyed {
+            let idx = *distinct.entry(name_id).or_insert_with(|| {
+                text.push_str(&names.name(process, name_id).unwrap_or(fallback).to_lowercase());
+                ends.push(text.len() as u32);
+                ends.len() as u32 - 1
+            });
+            name_of_rank.push(idx);
+            entries.push(entry);
+        }
+
+        let mut starts = vec![0u32; ends.len() + 1];
+        for &idx in &name_of_rank {
+            starts[idx as usize + 1] += 1;
+        }
+        for i in 0..ends.len() {
+            starts[i + 1] += starts[i];
+        }
+        let mut ranks = vec![0u32; name_of_rank.len()];
+        let mut fill = starts.clone();
+        for (rank, &idx) in name_of_rank.iter().enumerate() {
+            ranks[fill[idx as usize] as usize] = rank as u32;
+            fill[idx as usize] += 1;
+        }
+
+        let mut index = Self { entries, text, ends, grams: HashMap::new(), starts, ranks };
+        let mut seen = Vec::new();
+        for idx in 0..index.ends.len() {
+            seen.clear();
+            seen.extend(index.name(idx).as_bytes().windows(3).map(|w| [w[0], w[1], w[2]]));
+            seen.sort_unstable();
+            seen.dedup();
+            for gram in &seen {
+                index.grams.entry(*gram).or_default().push(idx as u32);
+            }
+        }
+        index
+    }
+
+    fn name(&self, idx: usize) -> &str {
+        let start = if idx == 0 { 0 } else { self.ends[idx - 1] as usize };
+        &self.text[start..self.ends[idx] as usize]
+    }
+
+    /// The best `limit` entries whose name contains `query` (already lowercase), in rank order
+    fn query(&self, query: &str, limit: usize) -> Vec<&SearchEntry> {
+        let candidates: Box<dyn Iterator<Item = usize> + '_> = if query.len() >= 3 {
+            // Every trigram of the query must be present; verify on the rarest list
+            let mut rarest: Option<&Vec<u32>> = None;
+            for w in query.as_bytes().windows(3) {
+                match self.grams.get(&[w[0], w[1], w[2]]) {
+                    Some(list) if rarest.map_or(true, |r| list.len() < r.len()) => rarest = Some(list),
+                    Some(_) => {}
+                    None => return Vec::new(),
+                }
+            }
+            Box::new(rarest.into_iter().flatten().map(|&i| i as usize))
+        } else {
+            Box::new(0..self.ends.len())
+        };
+
+        let mut ranks: Vec<u32> = Vec::new();
+        for idx in candidates.filter(|&i| self.name(i).contains(query)) {
+            ranks.extend_from_slice(&self.ranks[self.starts[idx] as usize..self.starts[idx + 1] as usize]);
+        }
+        if ranks.len() > limit {
+            ranks.select_nth_unstable(limit);
+            ranks.truncate(limit);
+        }
+        ranks.sort_unstable();
+        ranks.into_iter().map(|r| &self.entries[r as usize]).collect()
+    }
+}
+
+pub struct SearchIndex {
+    objects: NameIndex,
+    members: NameIndex,
+    packages: Vec<String>,
+    /// ObjectManager::index_revision of the table this was built from
+    built_from: u64,
+}
+
+impl SearchIndex {
+    /// Object names come from the table; member names need one walk of each class/struct member chain
+    pub fn build(objects: &ObjectManager, names: &FNamePool, process: &Process, offsets: &UEOffset) -> Self {
+        let built_from = objects.index_revision();
+        let mem = CachedMemory::new(&process.memory, PAGE_64K);
+
+        let mut packages: Vec<String> = Vec::new();
+        let mut package_ids: HashMap<String, u32> = HashMap::new();
+        let mut full_name = String::new();
+
+        // (priority, lowercase name, package, name id, handle) for every searchable object
+        let mut owners = Vec::new();
+        for obj in objects.iter(names) {
+            if !is_searchable_type(obj.type_name()) {
+                continue;
+            }
+            let priority = type_priority(obj.type_name());
+            obj.write_full_name(&mut full_name);
+            let package = extract_package_name(&full_name);
+            let package_id = match package_ids.get(&package) {
+                Some(&id) => id,
+                None => {
+                    packages.push(package.clone());
+                    package_ids.insert(package, packages.len() as u32 - 1);
+                    packages.len() as u32 - 1
+                }
+            };
+            owners.push((priority, obj.name().to_lowercase(), package_id, obj.name_id(), obj.handle()));
+        }
+        owners.sort_by(|a, b| a.0.cmp(&b.0).then_with(|| a.1.cmp(&b.1)).then_with(|| packages[a.2 as usize].cmp(&packages[b.2 as usize])));
+
+        let mut object_keys = Vec::with_capacity(owners.len());
+        let mut member_keys = Vec::new();
+        for &(priority, _, package, name_id, handle) in &owners {
+            object_keys.push((name_id, SearchEntry { handle, package, member: None }));
+
+            // Member mode only looks inside classes and structs
+            if priority > 1 {
+                continue;
+            }
+            let Some(obj) = objects.view(handle, names) else { continue };
+            let mut child_addr = mem.try_read_pointer(obj.address().wrapping_add(offsets.member)).unwrap_or(0);
+            let mut safety = 0;
+            while child_addr > 0x10000 && safety < 2000 {
+                safety += 1;
+                let child_name_id = mem.try_read::<i32>(child_addr.wrapping_add(offsets.member_fname_index)).unwrap_or(0) as u32;
+                member_keys.push((child_name_id, SearchEntry { handle, package, member: Some(child_name_id) }));
+                child_addr = mem.try_read_pointer(child_addr.wrapping_add(offsets.next_member)).unwrap_or(0);
+            }
+        }
+
+        let stats = mem.stats();
+        println!("[ SearchIndex ] {} objects, {} members ({} page reads)", object_keys.len(), member_keys.len(), stats.misses);
+
+        Self { objects: NameIndex::build(object_keys, names, process, "InvalidName"), members: NameIndex::build(member_keys, names, process, ""), packages, built_from }
+    }
+
+    pub fn is_current(&self, objects: &ObjectManager) -> bool {
+        self.built_from == objects.index_revision()
+    }
+
+    pub fn package(&self, entry: &SearchEntry) -> &str {
+        &self.packages[entry.package as usize]
+    }
+
+    /// Objects (class/struct/enum/function) whose name contains `query`, best `limit` first
+    pub fn search_objects(&self, query: &str, limit: usize) -> Vec<&SearchEntry> {
+        self.objects.query(&query.to_lowercase(), limit)
+    }
+
+    /// Class/struct members whose name contains `query`, best `limit` first
+    pub fn search_members(&self, query: &str, limit: usize) -> Vec<&SearchEntry> {
+        self.members.query(&query.to_lowercase(), limit)
+    }
+}
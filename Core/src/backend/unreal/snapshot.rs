@@ -0,0 +1,303 @@
+use crate::backend::os::image::{MappedFile, MemoryImage, IMAGE_PAGE_SIZE};
+use crate::backend::os::memory::Memory;
+use crate::backend::os::process::Process;
+use crate::backend::unreal::name_pool::{FNamePool, NAME_BLOCK_SIZE, NAME_MAX_BLOCKS};
+use crate::backend::unreal::object_array::{GUObjectArray, ObjectManager, RowRecord};
+use crate::backend::unreal::offsets::UEOffset;
+use std::collections::BTreeMap;
+use std::io::Write;
+use std::path::Path;
+use std::sync::Arc;
+
+// ═══════════════════════════════════════════════════════════════
+//  Snapshot — a dump that can be reopened without the game
+//  The file holds the pages of process memory the dump depends on (name blocks, object
+//  headers, member chains, enum lists), the object table rows and the offsets. Opening one
+//  maps the file; memory reads are served from the mapped pages through `Memory`, so the
+//  regular commands run against it unchanged.
+//
+//  Layout (little-endian):
+//    0x0000  header: magic, version, section count, then (kind, offset, len) per section
+//    0x1000  META        JSON SnapshotMeta
+//            PAGE_TABLE  sorted u64 page addresses
+//            ROWS        RowRecord per object table row, in handle order
+//            PAGE_DATA   IMAGE_PAGE_SIZE bytes per page, page-aligned in the file
+// ═══════════════════════════════════════════════════════════════
+
+const SNAPSHOT_MAGIC: [u8; 8] = *b"UEDPSNAP";
+/// Bump on any layout change; older files are rejected instead of misread
+pub const SNAPSHOT_VERSION: u32 = 1;
+const HEADER_SIZE: usize = 0x1000;
+
+const SECTION_META: u32 = 1;
+const SECTION_PAGE_TABLE: u32 = 2;
+const SECTION_ROWS: u32 = 3;
+const SECTION_PAGE_DATA: u32 = 4;
+
+/// Everything about the dump that is not bulk data
+#[derive(Debug, Clone, serde::Serialize, serde::Deserialize)]
+pub struct SnapshotMeta {
+    pub process_name: String,
+    pub exe_path: String,
+    pub main_module_base: usize,
+    pub main_module_size: usize,
+    pub fname_pool: usize,
+    pub guobject_array: Option<usize>,
+    pub guobject_element_size: Option<usize>,
+    pub gworld: Option<usize>,
+    pub offsets: UEOffset,
+    /// Seconds since the Unix epoch
+    pub created: u64,
+    pub object_count: usize,
+    pub row_count: usize,
+    pub page_count: usize,
+}
+
+/// Bytes from the start of an object or field that the object commands read with these offsets
+fn header_span(offsets: &UEOffset) -> usize {
+    let o = offsets;
+    let ends = [o.id + 4, o.class + 8, o.fname_index + 4, o.outer + 8, o.super_struct + 8, o.member + 8, o.member_type_offset + 8, o.member_fname_index + 4, o.next_member + 8, o.offset + 4, o.prop_size + 4, o.property + 16, o.type_object + 8, o.bit_mask + 1, o.enum_list + 8, o.enum_size + 4, o.enum_type + 8, o.funct + 8, o.funct_para + 8];
+    ends.into_iter().max().unwrap_or(0x100).min(0x400)
+}
+
+/// Pages read from the process, kept so the capture walk and the file see the same bytes
+struct PageCapture<'a> {
+    memory: &'a Memory,
+    /// None: unreadable, not written to the file
+    pages: BTreeMap<usize, Option<Box<[u8]>>>,
+}
+
+impl<'a> PageCapture<'a> {
+    fn touch(&mut self, address: usize, len: usize) -> bool {
+        if address < 0x10000 || len == 0 {
+            return false;
+        }
+        let first = address & !(IMAGE_PAGE_SIZE - 1);
+        let last = address.saturating_add(len - 1) & !(IMAGE_PAGE_SIZE - 1);
+        let mut readable = true;
+        let mut page = first;
+        loop {
+            let memory = self.memory;
+            readable &= self.pages.entry(page).or_insert_with(|| memory.read_bytes(page, IMAGE_PAGE_SIZE).ok().map(Vec::into_boxed_slice)).is_some();
+            if page >= last {
+                break;
+            }
+            page += IMAGE_PAGE_SIZE;
+        }
+        readable
+    }
+
+    fn read<T: Copy>(&mut self, address: usize) -> Option<T> {
+        let size = std::mem::size_of::<T>();
+        if !self.touch(address, size) {
+            return None;
+        }
+        let mut bytes = vec![0u8; size];
+        for (k, byte) in bytes.iter_mut().enumerate() {
+            let at = address + k;
+            let page = self.pages.get(&(at & !(IMAGE_PAGE_SIZE - 1)))?.as_ref()?;
+            *byte = page[at & (IMAGE_PAGE_SIZE - 1)];
+        }
+        Some(unsafe { std::ptr::read_unaligned(bytes.as_ptr() as *const T) })
+    }
+
+    fn read_pointer(&mut self, address: usize) -> usize {
+        self.read::<u64>(address).unwrap_or(0) as usize
+    }
+
+    /// A ChildProperty chain as get_object_details walks it
+    fn capture_fields(&mut self, first: usize, offsets: &UEOffset, span: usize) {
+        let mut child = first;
+        let mut safety = 0;
+        while child > 0x10000 && safety < 2000 {
+            safety += 1;
+            self.touch(child, span);
+            let type_ptr = self.read_pointer(child.wrapping_add(offsets.member_type_offset));
+            self.touch(type_ptr.wrapping_add(offsets.member_type), 4);
+            for sub in [self.read_pointer(child.wrapping_add(offsets.property)), self.read_pointer(child.wrapping_add(offsets.property + 8)), self.read_pointer(child.wrapping_add(offsets.type_object))] {
+                self.touch(sub, span);
+            }
+            child = self.read_pointer(child.wrapping_add(offsets.next_member));
+        }
+    }
+}
+
+pub struct Snapshot {
+    pub meta: SnapshotMeta,
+    file: Arc<MappedFile>,
+    image: Arc<MemoryImage>,
+    rows: (usize, usize),
+}
+
+impl Snapshot {
+    /// Capture the current dump of `process` into `path`. Returns the metadata written.
+    pub fn save(path: &Path, process: &Process, name_pool: &FNamePool, objects: &ObjectManager, offsets: &UEOffset, guobject: (Option<usize>, Option<usize>), gworld: Option<usize>) -> Result<SnapshotMeta, String> {
+        let start = std::time::Instant::now();
+        let span = header_span(offsets);
+        let rows = objects.export_rows();
+        let mut capture = PageCapture { memory: &process.memory, pages: BTreeMap::new() };
+
+        // ─── Name arena: the block table, then the walked part of each block (whole block if never decoded) ───
+        let pool = name_pool.base_address();
+        capture.touch(pool, 0x10 + NAME_MAX_BLOCKS * 8);
+        for block in 0..NAME_MAX_BLOCKS {
+            let block_address = capture.read_pointer(pool.wrapping_add(0x10 + block * 8));
+            if block_address > 0x10000 {
+                // Slack past the walked end keeps names resolved late (appended after decoding)
+                let len = name_pool.decoded_bytes(block).map_or(NAME_BLOCK_SIZE, |walked| (walked + 0x400).min(NAME_BLOCK_SIZE));
+                capture.touch(block_address, len);
+            }
+        }
+
+        // ─── GUObjectArray: what parse_array reads, so a replay can parse the array again ───
+        if let (Some(base), Some(element_size)) = guobject {
+            for (address, len) in GUObjectArray::new(base).parse_ranges(process, element_size) {
+                capture.touch(address, len);
+            }
+        }
+
+        // ─── Objects: every header, plus what get_object_details follows for classes, structs, enums and functions ───
+        for row in &rows {
+            let address = row.address as usize;
+            if !capture.touch(address, span) {
+                continue;
+            }
+            let type_name = name_pool.cached_name(row.type_name).unwrap_or_default().to_lowercase();
+            if type_name.contains("class") || type_name.contains("struct") {
+                let first = capture.read_pointer(address.wrapping_add(offsets.member));
+                capture.capture_fields(first, offsets, span);
+            } else if type_name.starts_with("enum") || type_name == "userenum" {
+                let enum_type = capture.read_pointer(address.wrapping_add(offsets.enum_type));
+                capture.touch(enum_type.wrapping_add(offsets.fname_index), 4);
+                let list = capture.read_pointer(address.wrapping_add(offsets.enum_list));
+                let count = capture.read::<i32>(address.wrapping_add(offsets.enum_size)).unwrap_or(0);
+                if count > 0 && count < 10000 {
+                    capture.touch(list, count as usize * offsets.enum_prop_mul);
+                }
+            }
+            if type_name.contains("function") {
+                let first = capture.read_pointer(address.wrapping_add(offsets.funct_para));
+                capture.capture_fields(first, offsets, span);
+            }
+        }
+
+        let pages: Vec<(usize, Box<[u8]>)> = std::mem::take(&mut capture.pages).into_iter().filter_map(|(page, data)| Some((page, data?))).collect();
+        let meta = SnapshotMeta {
+            process_name: process.name.clone(),
+            exe_path: process.exe_path.clone(),
+            main_module_base: process.main_module_base,
+            main_module_size: process.main_module_size,
+            fname_pool: pool,
+            guobject_array: guobject.0,
+            guobject_element_size: guobject.1,
+            gworld,
+            offsets: offsets.clone(),
+            created: std::time::SystemTime::now().duration_since(std::time::UNIX_EPOCH).map(|d| d.as_secs()).unwrap_or(0),
+            object_count: objects.len(),
+            row_count: rows.len(),
+            page_count: pages.len(),
+        };
+
+        Self::write(path, &meta, &pages, &rows)?;
+        println!("[ Snapshot ] Saved {} objects, {} rows, {} pages ({} MB) in {:?}", meta.object_count, meta.row_count, meta.page_count, pages.len() * IMAGE_PAGE_SIZE / (1024 * 1024), start.elapsed());
+        Ok(meta)
+    }
+
+    fn write(path: &Path, meta: &SnapshotMeta, pages: &[(usize, Box<[u8]>)], rows: &[RowRecord]) -> Result<(), String> {
+        let align = |at: usize, to: usize| (at + to - 1) & !(to - 1);
+        let meta_json = serde_json::to_vec(meta).map_err(|e| e.to_string())?;
+
+        let meta_at = HEADER_SIZE;
+        let table_at = align(meta_at + meta_json.len(), 8);
+        let rows_at = table_at + pages.len() * 8;
+        let rows_len = rows.len() * std::mem::size_of::<RowRecord>();
+        let data_at = align(rows_at + rows_len, IMAGE_PAGE_SIZE);
+        let sections = [(SECTION_META, meta_at, meta_json.len()), (SECTION_PAGE_TABLE, table_at, pages.len() * 8), (SECTION_ROWS, rows_at, rows_len), (SECTION_PAGE_DATA, data_at, pages.len() * IMAGE_PAGE_SIZE)];
+
+        let mut header = Vec::with_capacity(HEADER_SIZE);
+        header.extend_from_slice(&SNAPSHOT_MAGIC);
+        header.extend_from_slice(&SNAPSHOT_VERSION.to_le_bytes());
+        header.extend_from_slice(&(sections.len() as u32).to_le_bytes());
+        for (kind, offset, len) in sections {
+            header.extend_from_slice(&kind.to_le_bytes());
+            header.extend_from_slice(&0u32.to_le_bytes());
+            header.extend_from_slice(&(offset as u64).to_le_bytes());
+            header.extend_from_slice(&(len as u64).to_le_bytes());
+        }
+        header.resize(HEADER_SIZE, 0);
+
+        // Write then rename so a failed save never leaves a truncated snapshot behind
+        let tmp = path.with_extension("tmp");
+        let file = std::fs::File::create(&tmp).map_err(|e| format!("Failed to create {}: {}", tmp.display(), e))?;
+        let mut out = std::io::BufWriter::with_capacity(1 << 20, file);
+        let io = |e: std::io::Error| format!("Failed to write snapshot: {}", e);
+
+        out.write_all(&header).map_err(io)?;
+        out.write_all(&meta_json).map_err(io)?;
+        out.write_all(&vec![0u8; table_at - (meta_at + meta_json.len())]).map_err(io)?;
+        for (page, _) in pages {
+            out.write_all(&(*page as u64).to_le_bytes()).map_err(io)?;
+        }
+        for row in rows {
+            // SAFETY: RowRecord is repr(C) plain data without padding
+            out.write_all(unsafe { std::slice::from_raw_parts(row as *const RowRecord as *const u8, std::mem::size_of::<RowRecord>()) }).map_err(io)?;
+        }
+        out.write_all(&vec![0u8; data_at - (rows_at + rows_len)]).map_err(io)?;
+        for (_, data) in pages {
+            out.write_all(data).map_err(io)?;
+        }
+        out.flush().map_err(io)?;
+        drop(out);
+
+        std::fs::rename(&tmp, path).map_err(|e| format!("Failed to commit snapshot: {}", e))
+    }
+
+    /// Map a snapshot file; nothing is decoded until it is read
+    pub fn open(path: &Path) -> Result<Self, String> {
+        let file = Arc::new(MappedFile::open(path)?);
+        let bytes = file.bytes();
+        if bytes.len() < HEADER_SIZE || bytes[..8] != SNAPSHOT_MAGIC {
+            return Err(format!("{} is not a UEDP snapshot", path.display()));
+        }
+        let u32_at = |at: usize| u32::from_le_bytes(bytes[at..at + 4].try_into().unwrap());
+        let u64_at = |at: usize| u64::from_le_bytes(bytes[at..at + 8].try_into().unwrap()) as usize;
+
+        let version = u32_at(8);
+        if version != SNAPSHOT_VERSION {
+            return Err(format!("Snapshot version {} is not supported (expected {})", version, SNAPSHOT_VERSION));
+        }
+        let count = (u32_at(12) as usize).min((HEADER_SIZE - 16) / 24);
+        let mut sections = std::collections::HashMap::new();
+        for k in 0..count {
+            let at = 16 + k * 24;
+            let (offset, len) = (u64_at(at + 8), u64_at(at + 16));
+            if offset.checked_add(len).map_or(true, |end| end > bytes.len()) {
+                return Err("Snapshot is truncated".to_string());
+            }
+            sections.insert(u32_at(at), (offset, len));
+        }
+        let section = |kind: u32, name: &str| sections.get(&kind).copied().ok_or_else(|| format!("Snapshot has no {} section", name));
+
+        let (meta_at, meta_len) = section(SECTION_META, "META")?;
+        let meta: SnapshotMeta = serde_json::from_slice(&bytes[meta_at..meta_at + meta_len]).map_err(|e| format!("Snapshot metadata is invalid: {}", e))?;
+        let (table_at, table_len) = section(SECTION_PAGE_TABLE, "PAGE_TABLE")?;
+        let (data_at, _) = section(SECTION_PAGE_DATA, "PAGE_DATA")?;
+        let (rows_at, rows_len) = section(SECTION_ROWS, "ROWS")?;
+
+        let image = Arc::new(MemoryImage::new(Arc::clone(&file), table_at, table_len / 8, data_at)?);
+        Ok(Self { meta, file, image, rows: (rows_at, rows_len / std::mem::size_of::<RowRecord>()) })
+    }
+
+    /// Read-only Memory over the captured pages
+    pub fn memory(&self) -> Memory {
+        Memory::from_image(Arc::clone(&self.image))
+    }
+
+    /// The object table rows, read straight from the mapping
+    pub fn rows(&self) -> impl Iterator<Item = RowRecord> + '_ {
+        let (at, count) = self.rows;
+        let bytes = self.file.bytes();
+        // SAFETY: the ROWS section was bounds-checked in `open`; read_unaligned tolerates any file offset
+        (0..count).map(move |k| unsafe { std::ptr::read_unaligned(bytes.as_ptr().add(at + k * std::mem::size_of::<RowRecord>()) as *const RowRecord) })
+    }
+}
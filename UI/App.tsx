@@ -14,10 +14,23 @@ const INITIAL_FUNCTIONS: AnalyzerFunction[] = [
   { id: '7', name: 'GetGWorld', category: 'Info', enabled: false, status: 'idle' },
   { id: '1', name: 'ShowBaseAddress', category: 'Info', enabled: false, status: 'idle' },
   { id: '3', name: 'AutoConfig', category: 'Auto', enabled: false, status: 'idle' },
+  { id: '11', name: 'RediscoverOffsets', category: 'Auto', enabled: false, status: 'idle' },
   { id: '8', name: 'ParseFNamePool', category: 'Info', enabled: true, status: 'idle' },
   { id: '9', name: 'ParseGUObjectArray', category: 'Info', enabled: true, status: 'idle' },
+  { id: '10', name: 'ResyncGUObjectArray', category: 'Info', enabled: false, status: 'idle' },
 ];
 
+interface ObjectArrayDelta {
+  added: number;
+  freed: number;
+  reused: number;
+  slots_scanned: number;
+  total_objects: number;
+  elapsed_ms: number;
+  added_addresses: string[];
+  removed_addresses: string[];
+}
+
 export default function App() {
   const [attachedProcess, setAttachedProcess] = useState<string | null>(null);
   const [functions, setFunctions] = useState<AnalyzerFunction[]>(INITIAL_FUNCTIONS);
@@ -72,8 +85,15 @@ export default function App() {
       setObjTotalCount({ current: current_objects, total: total_objects });
     });
 
+    const unlistenDelta = listen<ObjectArrayDelta>('guobject-array-delta', (event) => {
+      const { added, freed, reused, total_objects } = event.payload;
+      console.log(`[ GUObjectArray Resync ] +${added} -${freed} ~${reused}`);
+      setObjTotalCount({ current: total_objects, total: total_objects });
+    });
+
     return () => {
       unlistenProcess.then(f => f());
+      unlistenDelta.then(f => f());
       unlistenFNamePool.then(f => f());
       unlistenGUObject.then(f => f());
     };
@@ -136,6 +156,10 @@ export default function App() {
       } else if (func.name === 'AutoConfig') {
         console.log("Starting AutoConfig...");
         await invoke('run_auto_config');
+      } else if (func.name === 'RediscoverOffsets') {
+        // Ignores offsets restored from the build cache and scans again
+        console.log("Rediscovering offsets...");
+        await invoke('run_auto_config', { force: true });
       } else if (func.name === 'GetGWorld') {
         const addr: number = await invoke('get_gworld_address');
         console.log("GWorld Base:", "0x" + addr.toString(16).toUpperCase());
@@ -150,6 +174,9 @@ export default function App() {
         setObjTotalProgress(100);
         setObjCurrentCount(c => ({ current: c.total, total: c.total }));
         setObjTotalCount({ current: count, total: count });
+      } else if (func.name === 'ResyncGUObjectArray') {
+        const delta: ObjectArrayDelta = await invoke('resync_guobject_array');
+        console.log("[ GUObjectArray Resync ]", delta.slots_scanned, "slots in", delta.elapsed_ms, "ms");
       } else {
         // Simulate finish for others
         await new Promise(resolve => setTimeout(resolve, 1000));
@@ -166,6 +193,40 @@ export default function App() {
     }
   };
 
+  const handleSaveSnapshot = async () => {
+    try {
+      const { save } = await import('@tauri-apps/plugin-dialog');
+      const filePath = await save({
+        filters: [{ name: 'UEDP Snapshot', extensions: ['uedpsnap'] }],
+        defaultPath: `${(attachedProcess ?? 'snapshot').replace(/\.exe$/i, '')}.uedpsnap`,
+      });
+      if (filePath) {
+        const meta = await invoke<{ object_count: number, page_count: number }>('save_snapshot', { path: filePath });
+        console.log(`Snapshot saved: ${meta.object_count} objects, ${meta.page_count} pages`);
+      }
+    } catch (err) {
+      console.error("Failed to save snapshot:", err);
+      alert("Save snapshot failed: " + err);
+    }
+  };
+
+  const handleOpenSnapshot = async () => {
+    try {
+      const { open } = await import('@tauri-apps/plugin-dialog');
+      const filePath = await open({
+        multiple: false,
+        filters: [{ name: 'UEDP Snapshot', extensions: ['uedpsnap'] }],
+      });
+      if (typeof filePath === 'string') {
+        const label = await invoke<string>('load_snapshot', { path: filePath });
+        setAttachedProcess(label);
+      }
+    } catch (err) {
+      console.error("Failed to open snapshot:", err);
+      alert("Open snapshot failed: " + err);
+    }
+  };
+
   const handleRunAllEnabled = async () => {
     console.log("Running all enabled sequentially...");
 
@@ -200,6 +261,8 @@ export default function App() {
         attachedProcess={attachedProcess}
         onOpenSelector={handleOpenSelector}
         onRunAllEnabled={handleRunAllEnabled}
+        onSaveSnapshot={handleSaveSnapshot}
+        onOpenSnapshot={handleOpenSnapshot}
       />
 
       <FunctionTable
@@ -1,9 +1,16 @@
 import React, { useState, useRef, useEffect } from 'react';
 import { invoke } from '@tauri-apps/api/core';
+import { listen } from '@tauri-apps/api/event';
 import { Download, Upload, Search, Activity, Trash2, Cpu, Copy, Edit3, Box, Play, Square, WifiHigh, X, Database } from 'lucide-react';
 import { useApiStore, ApiPropertyInfo } from '../../store/apiStore';
 import { motion } from 'framer-motion';
 
+type LiveFrame = {
+    seq: number;
+    full: boolean;
+    changes: { instance: string; path: string; memory_address: string; value: unknown; text: string }[];
+};
+
 type TreeNode = {
     name: string;
     path: string;
@@ -161,42 +168,46 @@ export function ApiPanel() {
     const [isLocating, setIsLocating] = useState(false);
     const [portInput, setPortInput] = useState(serverPort.toString());
 
+    // Live values are not part of the read plan: leave them out, so pushed values don't re-sync (and re-plan) the backend
+    const syncedConfig = JSON.stringify(apiGroups, (key, value) => key === 'live_value' ? undefined : value);
+
     useEffect(() => {
         if (serverRunning) {
-            invoke('sync_api_config', { config: apiGroups }).catch(err => {
+            invoke('sync_api_config', { config: JSON.parse(syncedConfig) }).catch(err => {
                 console.error("Failed to sync API config:", err);
             });
         }
-    }, [apiGroups, serverRunning]);
+    }, [syncedConfig, serverRunning]);
 
-    // Poll live values from backend when server is running
+    // Live values are pushed by the backend sampler (only changed parameters, a full frame after each sync).
+    // Subscribed once per server run; groups are read from the store so frames never land between listeners.
     useEffect(() => {
         if (!serverRunning) return;
 
-        const intervalId = setInterval(async () => {
-            try {
-                const valuesMap = await invoke<Record<string, string>>('fetch_api_live_values');
-
-                const groupsArray = Object.values(apiGroups);
-                for (const group of groupsArray) {
-                    if (group.instanceAddress !== "N/A") {
-                        for (const classData of group.data) {
-                            for (const param of classData.parameters) {
-                                const newVal = valuesMap[param.memory_address];
-                                if (newVal !== undefined && newVal !== param.live_value) {
-                                    updateParameterLiveValue(group.instanceObjectId, classData.classObjectId, param.full_path, newVal);
-                                }
+        const unlisten = listen<LiveFrame>('api-live-values', ({ payload }) => {
+            const valuesMap: Record<string, string> = {};
+            for (const change of payload.changes) {
+                valuesMap[change.memory_address] = change.text;
+            }
+
+            const { apiGroups, updateParameterLiveValue } = useApiStore.getState();
+            const groupsArray = Object.values(apiGroups);
+            for (const group of groupsArray) {
+                if (group.instanceAddress !== "N/A") {
+                    for (const classData of group.data) {
+                        for (const param of classData.parameters) {
+                            const newVal = valuesMap[param.memory_address];
+                            if (newVal !== undefined && newVal !== param.live_value) {
+                                updateParameterLiveValue(group.instanceObjectId, classData.classObjectId, param.full_path, newVal);
                             }
                         }
                     }
                 }
-            } catch (err) {
-                // Ignore silent polling errors
             }
-        }, 1000);
+        });
 
-        return () => clearInterval(intervalId);
-    }, [serverRunning, apiGroups, updateParameterLiveValue]);
+        return () => { unlisten.then(fn => fn()); };
+    }, [serverRunning]);
 
     const copyToClipboard = async (text: string) => {
         try {
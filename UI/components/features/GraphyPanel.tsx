@@ -1,6 +1,6 @@
 import React, { useState, useEffect, useRef, useCallback } from 'react';
 import ForceGraph2D from 'react-force-graph-2d';
-import { Search, ZoomIn, ZoomOut, Maximize, Activity, Trash2 } from 'lucide-react';
+import { Search, ZoomIn, ZoomOut, Maximize, Activity, Trash2, Plus, X } from 'lucide-react';
 import { invoke } from '@tauri-apps/api/core';
 
 interface NodeData {
@@ -24,6 +24,151 @@ interface GraphData {
     links: LinkData[];
 }
 
+type WatchType = 'bool' | 'i8' | 'u8' | 'i16' | 'u16' | 'i32' | 'u32' | 'i64' | 'u64' | 'f32' | 'f64';
+
+interface WatchInfo {
+    id: number;
+    address: number;
+    value_type: WatchType;
+    label: string;
+    samples: number;
+    failures: number;
+}
+
+interface WatchSeries {
+    id: number;
+    next: number;
+    dropped: number;
+    covered: number;
+    t0_us: number;
+    dt_us: number[];
+    values: number[];
+    min: number;
+    max: number;
+}
+
+/** Points kept per watch on the client; older ones scroll out */
+const WATCH_HISTORY = 600;
+
+function Sparkline({ points }: { points: [number, number][] }) {
+    if (points.length < 2) return <div className="h-8" />;
+    const t0 = points[0][0];
+    const span = Math.max(points[points.length - 1][0] - t0, 1);
+    let lo = Infinity, hi = -Infinity;
+    for (const [, v] of points) { lo = Math.min(lo, v); hi = Math.max(hi, v); }
+    const range = hi - lo || 1;
+    const d = points.map(([t, v]) => `${(((t - t0) / span) * 100).toFixed(2)},${(30 - ((v - lo) / range) * 28).toFixed(2)}`).join(' ');
+    return (
+        <svg viewBox="0 0 100 32" preserveAspectRatio="none" className="w-full h-8">
+            <polyline points={d} fill="none" stroke="rgba(34,211,238,0.8)" strokeWidth="1" vectorEffect="non-scaling-stroke" />
+        </svg>
+    );
+}
+
+/** Background value watchers: the sampler runs in the backend, this only fetches thinned windows */
+function WatchPanel() {
+    const [watches, setWatches] = useState<WatchInfo[]>([]);
+    const [address, setAddress] = useState('');
+    const [valueType, setValueType] = useState<WatchType>('f32');
+    const [rate, setRate] = useState(100);
+    const [history, setHistory] = useState<Record<number, [number, number][]>>({});
+    const cursors = useRef<Record<number, number>>({});
+
+    const refresh = useCallback(() => invoke<WatchInfo[]>('list_watches').then(setWatches).catch(() => { }), []);
+
+    useEffect(() => { refresh(); }, [refresh]);
+
+    useEffect(() => {
+        if (watches.length === 0) return;
+        let cancelled = false;
+        const poll = async () => {
+            try {
+                const series = await invoke<WatchSeries[]>('get_watch_series', { since: cursors.current, maxPoints: 200 });
+                if (cancelled) return;
+                setHistory(prev => {
+                    const next = { ...prev };
+                    for (const s of series) {
+                        cursors.current[s.id] = s.next;
+                        if (s.values.length === 0) continue;
+                        const points = s.values.map((v, i) => [s.t0_us + s.dt_us[i], v] as [number, number]);
+                        next[s.id] = [...(next[s.id] ?? []), ...points].slice(-WATCH_HISTORY);
+                    }
+                    return next;
+                });
+            } catch (e) {
+                console.warn(e);
+            }
+        };
+        const timer = setInterval(poll, 250);
+        return () => { cancelled = true; clearInterval(timer); };
+    }, [watches.length]);
+
+    const handleAdd = async (e: React.FormEvent) => {
+        e.preventDefault();
+        if (!address.trim()) return;
+        try {
+            await invoke('add_watch', { address: address.trim(), valueType });
+            setAddress('');
+            refresh();
+        } catch (err) {
+            console.error("add_watch failed:", err);
+        }
+    };
+
+    const handleRemove = async (id: number) => {
+        await invoke('remove_watches', { ids: [id] }).catch(() => { });
+        delete cursors.current[id];
+        setHistory(prev => { const next = { ...prev }; delete next[id]; return next; });
+        refresh();
+    };
+
+    const handleRate = (hz: number) => {
+        setRate(hz);
+        invoke('set_watch_rate', { rateHz: hz }).catch(() => { });
+    };
+
+    return (
+        <div className="bg-[#0a0f16]/90 backdrop-blur-xl border border-white/5 rounded-xl p-4 shadow-[0_4px_20px_rgba(0,0,0,0.5)]">
+            <h4 className="text-[10px] uppercase tracking-widest text-slate-500 font-bold mb-3 flex items-center gap-2">
+                <Activity size={12} className="text-cyan-400" />
+                Value Watchers
+                <select value={rate} onChange={e => handleRate(Number(e.target.value))} className="ml-auto bg-transparent text-slate-400 text-[10px] outline-none">
+                    {[10, 60, 100, 500, 1000].map(hz => <option key={hz} value={hz} className="bg-[#0a0f16]">{hz} Hz</option>)}
+                </select>
+            </h4>
+            <form onSubmit={handleAdd} className="flex items-center gap-2 mb-3">
+                <input
+                    type="text"
+                    placeholder="0x..."
+                    className="flex-1 min-w-0 bg-slate-900/80 border border-slate-700/50 rounded-md px-2 py-1 text-xs text-slate-200 font-mono outline-none focus:border-cyan-500/40"
+                    value={address}
+                    onChange={e => setAddress(e.target.value)}
+                />
+                <select value={valueType} onChange={e => setValueType(e.target.value as WatchType)} className="bg-slate-900/80 border border-slate-700/50 rounded-md px-1 py-1 text-xs text-slate-300 outline-none">
+                    {(['bool', 'i8', 'u8', 'i16', 'u16', 'i32', 'u32', 'i64', 'u64', 'f32', 'f64'] as WatchType[]).map(t => <option key={t} value={t}>{t}</option>)}
+                </select>
+                <button type="submit" className="p-1.5 text-cyan-400 hover:bg-cyan-500/10 rounded transition-all"><Plus size={14} /></button>
+            </form>
+            <div className="flex flex-col gap-2 max-h-72 overflow-y-auto">
+                {watches.map(w => {
+                    const points = history[w.id] ?? [];
+                    const last = points.length > 0 ? points[points.length - 1][1] : undefined;
+                    return (
+                        <div key={w.id} className="border border-white/5 rounded-md px-2 py-1.5">
+                            <div className="flex items-center gap-2 text-[11px]">
+                                <span className="text-slate-300 font-mono truncate flex-1">{w.label}</span>
+                                <span className="text-amber-300 font-mono">{last === undefined ? '—' : Number.isInteger(last) ? last : last.toFixed(3)}</span>
+                                <button onClick={() => handleRemove(w.id)} className="text-slate-500 hover:text-rose-400"><X size={12} /></button>
+                            </div>
+                            <Sparkline points={points} />
+                        </div>
+                    );
+                })}
+            </div>
+        </div>
+    );
+}
+
 export function GraphyPanel() {
     const [graphData, setGraphData] = useState<GraphData>({ nodes: [], links: [] });
     const fgRef = useRef<any>(null);
@@ -229,6 +374,8 @@ export function GraphyPanel() {
                         <Trash2 size={14} />
                     </button>
                 </div>
+
+                <WatchPanel />
             </div>
 
             {/* View Controls (Bottom Right) */}
@@ -3,6 +3,7 @@ import { invoke } from '@tauri-apps/api/core';
 import { Search, Plus, Copy, ChevronRight, ChevronDown, Activity, Trash2, Cpu, Edit3, Crosshair, ScanEye, X, Terminal, Server, List } from 'lucide-react';
 import { ObjectAnalyzerPanel } from './ObjectAnalyzerPanel';
 import { useApiStore } from '../../store/apiStore';
+import { streamCursor } from '../../store/resultCursor';
 // --- Types ---
 interface InstanceSearchResult {
     instance_address: string;
@@ -212,8 +213,13 @@ export function Inspector({ isAnalyzerOpen, onToggleAnalyzer }: InspectorProps)
     const [isHunterOpen, setIsHunterOpen] = useState(false);
     const [hunterQuery, setHunterQuery] = useState('');
     const [hunterResults, setHunterResults] = useState<InstanceSearchResult[]>([]);
+    // A hunt's pages are appended to its own hunterResults array in place; this re-renders after each one
+    const [, setHuntPages] = useState(0);
     const [isHunting, setIsHunting] = useState(false);
     const [huntTimeMs, setHuntTimeMs] = useState(0);
+    // Bumped by every hunt and on unmount: only the latest hunt may keep paging into the results
+    const huntGeneration = useRef(0);
+    useEffect(() => () => { huntGeneration.current++; }, []);
 
     // --- State: Middle Column (Tracked Instances) ---
     const [addInstanceInput, setAddInstanceInput] = useState('');
@@ -241,9 +247,12 @@ export function Inspector({ isAnalyzerOpen, onToggleAnalyzer }: InspectorProps)
 
     const handleHunt = async () => {
         if (!hunterQuery.trim()) return;
+        const generation = ++huntGeneration.current;
+        const isCancelled = () => huntGeneration.current !== generation;
+        const results: InstanceSearchResult[] = [];
         setIsHunting(true);
         setHuntTimeMs(0);
-        setHunterResults([]);
+        setHunterResults(results);
 
         const startTime = Date.now();
         let animationFrameId: number;
@@ -255,15 +264,20 @@ export function Inspector({ isAnalyzerOpen, onToggleAnalyzer }: InspectorProps)
         animationFrameId = requestAnimationFrame(updateTimer);
 
         try {
-            const results = await invoke<InstanceSearchResult[]>('search_object_instances', { objectAddress: hunterQuery.trim() });
-            setHunterResults(results);
+            // Popular classes have tens of thousands of instances: show them as the pages arrive
+            await streamCursor<InstanceSearchResult>({ kind: 'instances', object_address: hunterQuery.trim() }, 2000, page => {
+                for (const row of page) results.push(row);
+                setHuntPages(n => n + 1);
+            }, isCancelled);
         } catch (error) {
             console.error("Hunt failed:", error);
-            setHunterResults([]);
+            if (!isCancelled()) setHunterResults([]);
         } finally {
             cancelAnimationFrame(animationFrameId);
-            setHuntTimeMs(Date.now() - startTime);
-            setIsHunting(false);
+            if (!isCancelled()) {
+                setHuntTimeMs(Date.now() - startTime);
+                setIsHunting(false);
+            }
         }
     };
 
@@ -376,10 +390,15 @@ export function Inspector({ isAnalyzerOpen, onToggleAnalyzer }: InspectorProps)
                     const countStr = prop.live_value.replace(/[^0-9]/g, '');
                     const count = parseInt(countStr) || 0;
 
-                    props = await invoke<InstancePropertyInfo[]>('get_array_elements', {
-                        arrayAddress: prop.object_instance_address,
-                        innerType: prop.sub_type || typeLower.replace('property', ''),
+                    // Paged through a cursor so big arrays render their first elements right away
+                    await streamCursor<InstancePropertyInfo>({
+                        kind: 'array_elements',
+                        array_address: prop.object_instance_address,
+                        inner_type: prop.sub_type || typeLower.replace('property', ''),
                         count: count
+                    }, 500, page => {
+                        for (const row of page) props.push(row);
+                        setClassProperties(prev => ({ ...prev, [nodeKey]: props }));
                     });
                 } else {
                     props = await invoke<InstancePropertyInfo[]>('get_instance_details', {
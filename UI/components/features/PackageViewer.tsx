@@ -8,6 +8,7 @@ import { ObjectAnalyzerPanel } from './ObjectAnalyzerPanel';
 
 interface PackageInfo { name: string; object_count: number; }
 interface ObjectSummary { address: number; name: string; full_name: string; type_name: string; }
+interface ObjectPage { total: number; offset: number; objects: ObjectSummary[]; }
 interface InheritanceItem { name: string; address: number; }
 interface ObjectPropertyInfo { property_name: string; property_type: string; offset: string; sub_type: string; sub_type_address: number; }
 interface EnumValueItem { name: string; value: number; }
@@ -46,6 +47,9 @@ interface InspectorTab {
     loading: boolean;
 }
 
+/** get_objects_page slice size; big enough that most packages arrive in one round trip */
+const OBJECT_PAGE_SIZE = 2000;
+
 // Global styles for custom scrollbar and animations
 const globalStyles = `
   @keyframes scanline {
@@ -105,7 +109,7 @@ export function PackageViewer({ isAnalyzerOpen, onToggleAnalyzer }: PackageViewe
     // --- Object References State ---
     const [isReferenceSearchOpen, setIsReferenceSearchOpen] = useState(false);
     const [referenceSearchAddress, setReferenceSearchAddress] = useState('');
-    const [referenceSearchMode, setReferenceSearchMode] = useState<"Inheritance" | "Member">("Inheritance");
+    const [referenceSearchMode, setReferenceSearchMode] = useState<"Inheritance" | "Member" | "Pointer">("Inheritance");
     const [referenceSearchResults, setReferenceSearchResults] = useState<GlobalSearchResult[]>([]);
     const [isReferenceSearching, setIsReferenceSearching] = useState(false);
 
@@ -330,13 +334,23 @@ export function PackageViewer({ isAnalyzerOpen, onToggleAnalyzer }: PackageViewe
     }, [loadPackages]);
 
     useEffect(() => {
-        if (selectedPackage) {
-            invoke<ObjectSummary[]>('get_objects', { packageName: selectedPackage, category: selectedCategory })
-                .then(objs => setObjects(objs))
-                .catch(err => console.error("Failed to load objects", err));
-        } else {
+        if (!selectedPackage) {
             setObjects([]);
+            return;
         }
+        // Large packages arrive page by page: the first page renders immediately, the rest is appended
+        let cancelled = false;
+        const loadFrom = async (offset: number, loaded: ObjectSummary[]) => {
+            const page = await invoke<ObjectPage>('get_objects_page', { packageName: selectedPackage, category: selectedCategory, offset, limit: OBJECT_PAGE_SIZE });
+            if (cancelled) return;
+            const next = offset === 0 ? page.objects : loaded.concat(page.objects);
+            setObjects(next);
+            if (page.objects.length > 0 && offset + page.objects.length < page.total) {
+                await loadFrom(offset + page.objects.length, next);
+            }
+        };
+        loadFrom(0, []).catch(err => console.error("Failed to load objects", err));
+        return () => { cancelled = true; };
     }, [selectedPackage, selectedCategory]);
 
     // Categories
@@ -514,6 +528,12 @@ export function PackageViewer({ isAnalyzerOpen, onToggleAnalyzer }: PackageViewe
                         >
                             Member
                         </button>
+                        <button
+                            onClick={() => setReferenceSearchMode("Pointer")}
+                            className={`flex-1 text-[10px] uppercase tracking-widest py-1.5 rounded-md transition-all font-bold ${referenceSearchMode === 'Pointer' ? 'bg-cyan-500/20 text-cyan-300 shadow-sm border border-cyan-500/20' : 'text-slate-500 hover:text-slate-300'}`}
+                        >
+                            Pointer
+                        </button>
                     </div>
 
                     <div className="flex items-center gap-2">
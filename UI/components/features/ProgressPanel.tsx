@@ -1,3 +1,16 @@
+import { useEffect, useState } from 'react';
+import { invoke } from '@tauri-apps/api/core';
+
+// Shape of get_runtime_metrics (commands/metrics.rs), only the fields shown here
+interface LookupStats { hits: number; misses: number; contended: number; hit_ratio: number; }
+interface OpMetrics { op: string; calls: number; bytes: number; failures: number; mean_ns: number; p50_ns: number; p99_ns: number; }
+interface RuntimeMetrics {
+    io: OpMetrics[];
+    page_cache: LookupStats;
+    name_pool: { blocks: LookupStats; late: LookupStats } | null;
+    objects: { addresses: LookupStats; ids: LookupStats; layout_cache: LookupStats };
+}
+
 interface ProgressBarProps {
     label: string;
     progress: number; // 0 to 100
@@ -63,6 +76,68 @@ interface ProgressPanelProps {
     seqRunning: boolean;
 }
 
+function formatCount(n: number): string {
+    if (n >= 1e9) return `${(n / 1e9).toFixed(1)}G`;
+    if (n >= 1e6) return `${(n / 1e6).toFixed(1)}M`;
+    if (n >= 1e3) return `${(n / 1e3).toFixed(1)}K`;
+    return `${n}`;
+}
+
+function formatNanos(ns: number): string {
+    if (ns >= 1e6) return `${(ns / 1e6).toFixed(1)}ms`;
+    if (ns >= 1e3) return `${(ns / 1e3).toFixed(1)}µs`;
+    return `${ns}ns`;
+}
+
+function formatRatio(stats: LookupStats | undefined): string {
+    return stats && stats.hits + stats.misses > 0 ? `${(stats.hit_ratio * 100).toFixed(1)}%` : '—';
+}
+
+function MetricCell({ label, value, hint }: { label: string; value: string; hint?: string }) {
+    return (
+        <div data-tauri-drag-region className="flex flex-col gap-0.5 min-w-0" title={hint}>
+            <span data-tauri-drag-region className="text-[8px] font-semibold tracking-widest text-slate-500 uppercase truncate">{label}</span>
+            <span data-tauri-drag-region className="text-[11px] font-mono font-bold text-slate-300 truncate">{value}</span>
+        </div>
+    );
+}
+
+/** Memory syscall, cache and contention counters, polled from the backend while the panel is shown */
+function MetricsStrip({ running }: { running: boolean }) {
+    const [metrics, setMetrics] = useState<RuntimeMetrics | null>(null);
+
+    useEffect(() => {
+        let cancelled = false;
+        const poll = () => invoke<RuntimeMetrics>('get_runtime_metrics').then(m => { if (!cancelled) setMetrics(m); }).catch(() => { });
+        poll();
+        const timer = setInterval(poll, running ? 500 : 2000);
+        return () => { cancelled = true; clearInterval(timer); };
+    }, [running]);
+
+    if (!metrics) return null;
+    const reads = metrics.io.filter(o => o.op === 'read_bytes' || o.op === 'try_read');
+    const calls = reads.reduce((n, o) => n + o.calls, 0);
+    const bytes = reads.reduce((n, o) => n + o.bytes, 0);
+    const failures = reads.reduce((n, o) => n + o.failures, 0);
+    const typed = metrics.io.find(o => o.op === 'try_read');
+    const queries = metrics.io.find(o => o.op === 'query');
+    const lookups = [metrics.page_cache, metrics.objects.addresses, metrics.objects.ids, metrics.objects.layout_cache, metrics.name_pool?.late].filter((l): l is LookupStats => !!l);
+    const contended = lookups.reduce((n, l) => n + l.contended, 0);
+
+    return (
+        <div data-tauri-drag-region className="grid grid-cols-8 gap-x-4 pt-3 border-t border-[#1c2838]">
+            <MetricCell label="Reads" value={formatCount(calls)} hint="ReadProcessMemory calls (read_bytes + try_read)" />
+            <MetricCell label="Read" value={`${formatCount(bytes)}B`} />
+            <MetricCell label="Failed" value={calls > 0 ? `${((failures / calls) * 100).toFixed(1)}%` : '—'} />
+            <MetricCell label="p50 / p99" value={typed && typed.calls > 0 ? `${formatNanos(typed.p50_ns)} / ${formatNanos(typed.p99_ns)}` : '—'} hint="try_read latency, histogram bucket bounds" />
+            <MetricCell label="Queries" value={formatCount(queries?.calls ?? 0)} hint="VirtualQueryEx calls" />
+            <MetricCell label="Page Cache" value={formatRatio(metrics.page_cache)} hint="CachedMemory page hit ratio" />
+            <MetricCell label="Names / Objs" value={`${formatRatio(metrics.name_pool?.blocks)} / ${formatRatio(metrics.objects.addresses)}`} hint="FNamePool decoded-block and ObjectManager address hit ratios" />
+            <MetricCell label="Contended" value={formatCount(contended)} hint="Lookups that found a DashMap or page cache shard locked" />
+        </div>
+    );
+}
+
 function formatElapsed(ms: number): string {
     const totalSec = ms / 1000;
     if (totalSec < 60) return `${totalSec.toFixed(2)}s`;
@@ -122,6 +197,7 @@ export function ProgressPanel({ namePoolChunkProgress, namePoolTotalProgress, na
                     subLabel={objectPoolTotalCount.current.toLocaleString()}
                 />
             </div>
+            <MetricsStrip running={seqRunning} />
         </div>
     );
 }
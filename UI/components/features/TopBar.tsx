@@ -1,4 +1,4 @@
-import { Activity, Target, Play, X, Boxes } from 'lucide-react';
+import { Activity, Target, Play, X, Boxes, Save, FolderOpen } from 'lucide-react';
 import { getCurrentWindow } from '@tauri-apps/api/window';
 import { WebviewWindow } from '@tauri-apps/api/webviewWindow';
 
@@ -6,9 +6,11 @@ interface TopBarProps {
     attachedProcess: string | null;
     onOpenSelector: () => void;
     onRunAllEnabled: () => void;
+    onSaveSnapshot: () => void;
+    onOpenSnapshot: () => void;
 }
 
-export function TopBar({ attachedProcess, onOpenSelector, onRunAllEnabled }: TopBarProps) {
+export function TopBar({ attachedProcess, onOpenSelector, onRunAllEnabled, onSaveSnapshot, onOpenSnapshot }: TopBarProps) {
     const handleClose = () => {
         getCurrentWindow().close();
     };
@@ -70,6 +72,20 @@ export function TopBar({ attachedProcess, onOpenSelector, onRunAllEnabled }: Top
                 >
                     <Boxes size={17} strokeWidth={2} className="group-hover:drop-shadow-[0_0_8px_rgba(34,211,238,0.8)] transition-all" />
                 </button>
+                <button
+                    onClick={onSaveSnapshot}
+                    title="Save Snapshot"
+                    className="group flex items-center justify-center w-9 h-9 bg-white/5 hover:bg-cyan-500/10 text-slate-300 hover:text-cyan-300 rounded-lg transition-all duration-300 border border-white/5 hover:border-cyan-500/50 hover:shadow-[0_0_15px_rgba(6,182,212,0.3)] active:scale-95"
+                >
+                    <Save size={16} className="group-hover:drop-shadow-[0_0_8px_rgba(34,211,238,0.8)] transition-all" />
+                </button>
+                <button
+                    onClick={onOpenSnapshot}
+                    title="Open Snapshot"
+                    className="group flex items-center justify-center w-9 h-9 bg-white/5 hover:bg-cyan-500/10 text-slate-300 hover:text-cyan-300 rounded-lg transition-all duration-300 border border-white/5 hover:border-cyan-500/50 hover:shadow-[0_0_15px_rgba(6,182,212,0.3)] active:scale-95"
+                >
+                    <FolderOpen size={16} className="group-hover:drop-shadow-[0_0_8px_rgba(34,211,238,0.8)] transition-all" />
+                </button>
                 <div className="w-[1px] h-6 bg-white/10 mx-1"></div>
                 <button
                     onClick={handleClose}
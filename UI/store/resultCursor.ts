@@ -0,0 +1,79 @@
+import { invoke } from '@tauri-apps/api/core';
+
+// Client for the backend result cursors (commands/cursor.rs).
+// A cursor is opened once; rows are then fetched by range, packed into an ArrayBuffer.
+
+export type CursorQuery =
+    | { kind: 'objects'; package_name: string; category: string }
+    | { kind: 'global_search'; query: string; search_mode: string }
+    | { kind: 'instances'; object_address: string }
+    | { kind: 'array_elements'; array_address: string; inner_type: string; count: number };
+
+export interface CursorColumn { name: string; kind: 'u64' | 'i32' | 'bool' | 'str'; }
+export interface CursorInfo { id: number; total: number; columns: CursorColumn[]; }
+/** One page; `next` is where the following page starts (rows evicted since the cursor opened are skipped, not counted) */
+export interface CursorRows<T> { rows: T[]; next: number; }
+
+const utf8 = new TextDecoder();
+
+/** Decode one fetch_cursor_packed page into row objects keyed by column name */
+export function decodePacked<T>(buffer: ArrayBuffer, columns: CursorColumn[]): CursorRows<T> {
+    const view = new DataView(buffer);
+    const bytes = new Uint8Array(buffer);
+    const count = view.getUint32(0, true);
+    const next = Number(view.getBigUint64(4, true));
+    const rows: T[] = new Array(count);
+    let at = 12;
+    for (let r = 0; r < count; r++) {
+        const row: Record<string, unknown> = {};
+        for (const col of columns) {
+            switch (col.kind) {
+                case 'u64': row[col.name] = Number(view.getBigUint64(at, true)); at += 8; break;
+                case 'i32': row[col.name] = view.getInt32(at, true); at += 4; break;
+                case 'bool': row[col.name] = bytes[at] !== 0; at += 1; break;
+                case 'str': {
+                    const len = view.getUint32(at, true);
+                    row[col.name] = utf8.decode(bytes.subarray(at + 4, at + 4 + len));
+                    at += 4 + len;
+                    break;
+                }
+            }
+        }
+        rows[r] = row as T;
+    }
+    return { rows, next };
+}
+
+export function openCursor(query: CursorQuery): Promise<CursorInfo> {
+    return invoke<CursorInfo>('open_cursor', { query });
+}
+
+export async function fetchRows<T>(cursor: CursorInfo, offset: number, limit: number): Promise<CursorRows<T>> {
+    const buffer = await invoke<ArrayBuffer>('fetch_cursor_packed', { id: cursor.id, offset, limit });
+    return decodePacked<T>(buffer, cursor.columns);
+}
+
+export function closeCursor(cursor: CursorInfo): Promise<void> {
+    return invoke('close_cursor', { id: cursor.id });
+}
+
+/**
+ * Run `query` and deliver its rows page by page: `onPage` gets each page's new rows once, for the caller to append.
+ * Stops early when `isCancelled` turns true; the cursor is closed either way.
+ */
+export async function streamCursor<T>(query: CursorQuery, pageSize: number, onPage: (rows: T[], total: number) => void, isCancelled: () => boolean = () => false): Promise<void> {
+    const cursor = await openCursor(query);
+    try {
+        if (cursor.total === 0) onPage([], 0);
+        let offset = 0;
+        while (offset < cursor.total && !isCancelled()) {
+            const page = await fetchRows<T>(cursor, offset, pageSize);
+            if (isCancelled()) break;
+            onPage(page.rows, cursor.total);
+            if (page.next <= offset) break;
+            offset = page.next;
+        }
+    } finally {
+        closeCursor(cursor).catch(() => { });
+    }
+}